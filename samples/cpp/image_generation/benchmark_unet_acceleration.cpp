@@ -0,0 +1,102 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
+
+#include "imwrite.hpp"
+
+namespace {
+
+// peak signal-to-noise ratio of u8 images, higher is closer
+double psnr(const ov::Tensor& reference, const ov::Tensor& image) {
+    OPENVINO_ASSERT(reference.get_shape() == image.get_shape(), "Images must have the same shape");
+
+    const uint8_t* reference_data = reference.data<const uint8_t>();
+    const uint8_t* image_data = image.data<const uint8_t>();
+
+    double squared_error = 0.0;
+    for (size_t i = 0; i < reference.get_size(); ++i) {
+        const double diff = static_cast<double>(reference_data[i]) - image_data[i];
+        squared_error += diff * diff;
+    }
+
+    const double mse = squared_error / reference.get_size();
+    return mse == 0.0 ? INFINITY : 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+// returns the last generated image and mean generation time in ms
+std::pair<ov::Tensor, double> benchmark(ov::genai::Text2ImagePipeline& pipe, const std::string& prompt, const ov::AnyMap& properties, size_t num_iter) {
+    ov::Tensor image;
+    double total_ms = 0.0;
+
+    for (size_t i = 0; i < num_iter; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        // the same seed produces the same initial latent for both modes
+        ov::Tensor generated = pipe.generate(prompt, properties);
+        total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // generated image may be overwritten by the next generation
+        image = ov::Tensor(generated.get_element_type(), generated.get_shape());
+        generated.copy_to(image);
+    }
+
+    return {image, total_ms / num_iter};
+}
+
+} // namespace
+
+int32_t main(int32_t argc, char* argv[]) try {
+    OPENVINO_ASSERT(argc >= 3 && argc <= 6, "Usage: ", argv[0], " <MODEL_DIR> '<PROMPT>' [UNET_CACHE_INTERVAL] [GUIDANCE_END] [NUM_ITER]");
+
+    const std::string models_path = argv[1], prompt = argv[2];
+    const size_t unet_cache_interval = argc > 3 ? std::stoul(argv[3]) : 2;
+    const float guidance_end = argc > 4 ? std::stof(argv[4]) : 0.8f;
+    const size_t num_iter = argc > 5 ? std::stoul(argv[5]) : 3;
+    const std::string device = "CPU";  // GPU can be used as well
+
+    ov::genai::Text2ImagePipeline pipe(models_path, device);
+
+    const ov::AnyMap default_properties = {
+        ov::genai::width(512),
+        ov::genai::height(512),
+        ov::genai::num_inference_steps(20),
+        ov::genai::rng_seed(42)
+    };
+    ov::AnyMap accelerated_properties = default_properties;
+    accelerated_properties[ov::genai::unet_cache_interval.name()] = unet_cache_interval;
+    accelerated_properties[ov::genai::guidance_end.name()] = guidance_end;
+
+    // warmup, accelerated generation also infers UNet with half batch once guidance ends, which is another shape
+    pipe.generate(prompt, default_properties);
+    pipe.generate(prompt, accelerated_properties);
+
+    auto [reference, default_ms] = benchmark(pipe, prompt, default_properties, num_iter);
+    auto [accelerated, accelerated_ms] = benchmark(pipe, prompt, accelerated_properties, num_iter);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Default generation time: " << default_ms << " ms" << std::endl;
+    std::cout << "Accelerated generation time (unet_cache_interval = " << unet_cache_interval
+              << ", guidance_end = " << guidance_end << "): " << accelerated_ms << " ms" << std::endl;
+    std::cout << "Speedup: " << default_ms / accelerated_ms << "x" << std::endl;
+    std::cout << "PSNR against default image: " << psnr(reference, accelerated) << " dB" << std::endl;
+
+    imwrite("default_%d.bmp", reference, true);
+    imwrite("accelerated_%d.bmp", accelerated, true);
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
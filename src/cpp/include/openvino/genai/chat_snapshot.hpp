@@ -0,0 +1,74 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+#include "openvino/genai/tokenizer.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Snapshot of a chat of LLMPipeline: KV cache of the model and history of the chat.
+ * Restoring the snapshot continues the chat without processing its history by the model again.
+ * A snapshot taken right after start_chat(system_message) holds KV cache of the system message only
+ * and can seed any number of new chats with the system message already processed.
+ * The snapshot is valid only for the same model, device and LoRA adapters.
+ */
+class OPENVINO_GENAI_EXPORTS ChatSnapshot {
+public:
+    ChatSnapshot() = default;
+
+    /**
+     * @brief Writes the snapshot into a file, KV cache tensors are stored as is after a json header.
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Reads a snapshot saved by save(). KV cache tensors are memory mapped and copied only when they are restored.
+     */
+    static ChatSnapshot load(const std::filesystem::path& path);
+
+    const ChatHistory& get_history() const {
+        return m_history;
+    }
+
+    /**
+     * @brief Number of tokens in KV cache.
+     */
+    size_t get_kv_cache_length() const {
+        return m_kv_cache_length;
+    }
+
+private:
+    friend class StatefulLLMPipeline;
+
+    // utils::GenerationChatInputsType
+    int m_chat_input_type = 0;
+    ChatHistory m_history;
+    std::string m_templated_history;
+    std::vector<int64_t> m_tokenized_history;
+    size_t m_answer_tokens_offset = 0;
+    std::optional<int64_t> m_last_disappeared_token;
+    // utils::HistoryRemoveManager
+    size_t m_num_tokens_to_remove_from_kv_cache = 0;
+    size_t m_trusted_history_length = 0;
+    size_t m_kv_cache_length = 0;
+    // KV cache by names of model states
+    std::map<std::string, ov::Tensor> m_kv_cache;
+    // keeps memory mapped file of a loaded snapshot alive
+    std::shared_ptr<void> m_mapped_file;
+};
+
+} // namespace genai
+} // namespace ov
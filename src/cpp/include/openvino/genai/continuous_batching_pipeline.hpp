@@ -69,6 +69,10 @@ protected:
     ContinuousBatchingPipeline() = default;
 
 public:
+    /**
+    * @brief Constructs a ContinuousBatchingPipeline from the dir with model, tokenizer and generation_config.json.
+    * If the dir contains a visual language model (openvino_language_model.xml and vision models), requests may contain images.
+    */
     ContinuousBatchingPipeline(const std::filesystem::path& models_path,
                                const SchedulerConfig& scheduler_config,
                                const std::string& device,
@@ -130,6 +134,11 @@ public:
 
     GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params);
+    /**
+    * @brief Adds a request with images, which is supported only by pipelines created from visual language models.
+    * Requests with the same images reuse KV cache blocks of each other if prefix caching is enabled.
+    */
+    GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const std::vector<ov::Tensor>& rgbs, const ov::genai::GenerationConfig& sampling_params);
 
     void step();
 
@@ -138,6 +147,7 @@ public:
     // more high level interface, which can process multiple prompts in continuous batching manner
     std::vector<EncodedGenerationResult> generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
     std::vector<GenerationResult> generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
+    std::vector<GenerationResult> generate(const std::vector<std::string>& prompts, const std::vector<std::vector<ov::Tensor>>& rgbs, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
 
     /**
     * @brief start chat with keeping history in kv cache.
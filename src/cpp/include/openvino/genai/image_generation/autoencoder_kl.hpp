@@ -116,6 +116,13 @@ public:
 
     AutoencoderKL(const AutoencoderKL&);
 
+    /**
+     * Creates VAE which shares compiled models with this one, but has its own infer requests, so both of them can be
+     * used concurrently. E.g. one image is decoded while the next one is being generated.
+     * @note Models must be compiled first.
+     */
+    AutoencoderKL clone() const;
+
     AutoencoderKL& reshape(int batch_size, int height, int width);
 
     AutoencoderKL& compile(const std::string& device, const ov::AnyMap& properties = {});
@@ -129,8 +136,21 @@ public:
 
     ov::Tensor decode(ov::Tensor latent);
 
+    /**
+     * Decodes latent by overlapping tiles of `tile_size` x `tile_size` image pixels, neighboring tiles
+     * share `tile_overlap` pixels which are blended. Tiles are inferred in parallel by several infer requests.
+     * Falls back to 'decode()' if latent fits into a single tile.
+     */
+    ov::Tensor decode_tiled(ov::Tensor latent, size_t tile_size, size_t tile_overlap);
+
     ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
 
+    /**
+     * Encodes image by overlapping tiles, see 'decode_tiled()'. Tiles of latent distribution parameters are blended
+     * before sampling.
+     */
+    ov::Tensor encode_tiled(ov::Tensor image, std::shared_ptr<Generator> generator, size_t tile_size, size_t tile_overlap);
+
     const Config& get_config() const;
 
     size_t get_vae_scale_factor() const;
@@ -138,8 +158,12 @@ public:
 private:
     void merge_vae_image_post_processing() const;
 
+    ov::Tensor postprocess_encoder_output(ov::Tensor output, std::shared_ptr<Generator> generator);
+
     Config m_config;
     ov::InferRequest m_encoder_request, m_decoder_request;
+    // extra infer requests to run VAE tiles in parallel, created on first tiled call
+    std::vector<ov::InferRequest> m_encoder_tile_requests, m_decoder_tile_requests;
     std::shared_ptr<ov::Model> m_encoder_model = nullptr, m_decoder_model = nullptr;
 };
 
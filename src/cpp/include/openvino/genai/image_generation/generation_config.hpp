@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <random>
 #include <optional>
@@ -71,6 +72,39 @@ private:
     std::normal_distribution<float> m_normal;
 };
 
+/**
+ * Implementation of 'Generator' using counter-based Philox4x32-10 random generator and Box-Muller transform.
+ * Each group of 4 random values is computed from its own counter, so 'randn_tensor' fills tensors in parallel
+ * and produces the same values regardless of a number of threads.
+ */
+class OPENVINO_GENAI_EXPORTS PhiloxGenerator : public Generator {
+public:
+    /**
+     * Initializes Philox generator with a given seed
+     * @param seed A seed value used as Philox key
+     */
+    explicit PhiloxGenerator(uint64_t seed);
+
+    virtual float next() override;
+
+    /**
+     * Generates a tensor of normally distributed values continuing the random stream.
+     * Values left from the last counter by previous 'next()' or 'randn_tensor()' calls are used first,
+     * so the stream is the same regardless of how it's split between calls.
+     */
+    virtual ov::Tensor randn_tensor(const ov::Shape& shape) override;
+
+    virtual void seed(size_t new_seed) override;
+
+private:
+    uint64_t m_seed = 0;
+    // index of the next Philox counter to be used
+    uint64_t m_offset = 0;
+    // values of the last used counter, ones starting from m_cache_pos are not returned yet
+    std::array<float, 4> m_cache = {};
+    size_t m_cache_pos = 4;
+};
+
 /**
  * Generation config used for Image generation pipelines.
  * Note, that not all values are applicable for all pipelines and models - please, refer
@@ -122,6 +156,28 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
      */
     std::optional<AdapterConfig> adapters;
 
+    /**
+     * Runs VAE decoder / encoder on overlapping tiles instead of the whole image, so peak memory depends on
+     * tile size rather than on image size. Overlapping parts of neighboring tiles are blended with linear weights.
+     * Tile size and overlap are in image pixels and must be divisible by VAE scale factor.
+     * @note Call pipeline 'reshape()' after tiling is enabled in pipeline generation config, so VAE is reshaped
+     * to the tile size instead of the whole image size.
+     */
+    bool vae_tiling = false;
+    size_t vae_tile_size = 512;
+    size_t vae_tile_overlap = 64;
+
+    /**
+     * Trade image quality for speed of UNet based pipelines (Stable Diffusion, Latent Consistency Model, Stable Diffusion XL).
+     * 'unet_cache_interval' N > 1 infers UNet on every N-th denoising step only and reuses the last guided noise
+     * prediction on other steps.
+     * 'guidance_end' < 1 stops classifier free guidance after a given fraction of denoising steps, so late steps, where
+     * unconditional and conditional predictions converge, infer UNet with half batch size.
+     * @note 'guidance_end' has no effect when UNet is reshaped to static shapes, as its batch size is fixed.
+     */
+    size_t unet_cache_interval = 1;
+    float guidance_end = 1.0f;
+
     /**
      * Checks whether image generation config is valid, otherwise throws an exception.
      */
@@ -216,6 +272,7 @@ static constexpr ov::Property<float> strength{"strength"};
  * By default, 'CppStdGenerator' is used, but if you are running Image generation via
  * python code, you can additionally install 'torch' and use OpenVINO GenAI's 'TorchGenerator'
  * which ensures the generated images will look as in HuggingFace when the same sed value if used.
+ * 'PhiloxGenerator' generates random tensors in parallel, which is faster for large latents and stochastic schedulers.
  */
 static constexpr ov::Property<std::shared_ptr<Generator>> generator{"generator"};
 
@@ -236,11 +293,38 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
  */
 static constexpr ov::Property<int> max_sequence_length{"max_sequence_length"};
 
+/**
+ * Enables tiled VAE decoding / encoding, which keeps memory consumption bounded for high resolution images.
+ */
+static constexpr ov::Property<bool> vae_tiling{"vae_tiling"};
+
+/**
+ * Size of VAE tile in image pixels. Used only if 'vae_tiling' is enabled.
+ */
+static constexpr ov::Property<size_t> vae_tile_size{"vae_tile_size"};
+
+/**
+ * Overlap of neighboring VAE tiles in image pixels. Used only if 'vae_tiling' is enabled.
+ */
+static constexpr ov::Property<size_t> vae_tile_overlap{"vae_tile_overlap"};
+
+/**
+ * UNet is inferred on every 'unet_cache_interval'-th denoising step, other steps reuse the last noise prediction.
+ */
+static constexpr ov::Property<size_t> unet_cache_interval{"unet_cache_interval"};
+
+/**
+ * Fraction of denoising steps performed with classifier free guidance, the rest ones use conditional UNet branch only.
+ */
+static constexpr ov::Property<float> guidance_end{"guidance_end"};
+
 /**
  * User callback for image generation pipelines, which is called within a pipeline with the following arguments:
  * - Current inference step
  * - Total number of inference steps. Note, that in case of 'strength' parameter, the number of inference steps is reduced linearly
  * - Tensor representing current latent. Such latent can be converted to human-readable representation via image generation pipeline 'decode()' method
+ * @note The latent tensor is valid only within the callback call, as its memory is reused and overwritten by the next denoising steps.
+ * Copy it (e.g. via 'ov::Tensor::copy_to') to keep intermediate latents after the callback returns.
  */
 static constexpr ov::Property<std::function<bool(size_t, size_t, ov::Tensor&)>> callback{"callback"};
 
@@ -0,0 +1,98 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Process-wide LRU cache of text encoder outputs used by image generation pipelines.
+ * Text encoders (CLIPTextModel, CLIPTextModelWithProjection, T5EncoderModel) store all their outputs per
+ * (encoder, prompt, negative prompt, classifier free guidance, max sequence length), so generation with the same prompts
+ * and different seeds or generation parameters skips tokenization and text encoder inference.
+ * Encoders are identified by compiled model, so pipelines sharing compiled models (e.g. Image2ImagePipeline created
+ * from Text2ImagePipeline) share cached embeddings.
+ * @note Encoders with LoRA adapters bypass the cache as adapters may change between generate calls.
+ */
+class OPENVINO_GENAI_EXPORTS PromptEmbeddingCache {
+public:
+    struct OPENVINO_GENAI_EXPORTS Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t num_entries = 0;
+        size_t size_bytes = 0;
+        size_t capacity_bytes = 0;
+    };
+
+    struct OPENVINO_GENAI_EXPORTS Key {
+        size_t encoder_id;
+        std::string positive_prompt;
+        std::string negative_prompt;
+        bool do_classifier_free_guidance;
+        int max_sequence_length = -1;
+    };
+
+    static PromptEmbeddingCache& instance();
+
+    /**
+     * Sets cache budget in bytes and evicts least recently used entries exceeding it. 0 disables the cache.
+     * Default capacity is 256 MB.
+     */
+    void set_capacity(size_t capacity_bytes);
+
+    size_t get_capacity() const;
+
+    Statistics get_statistics() const;
+
+    void clear();
+
+    /**
+     * Returns encoder outputs stored for the key and marks the entry as recently used. Counts a hit or a miss.
+     * Returned tensors are shared with the cache and must not be modified.
+     */
+    std::optional<std::vector<ov::Tensor>> find(const Key& key);
+
+    /**
+     * Stores deep copies of encoder outputs. Entries larger than capacity are not stored.
+     */
+    void insert(const Key& key, const std::vector<ov::Tensor>& outputs);
+
+    /**
+     * Returns a new unique encoder identifier, text encoders request it when they are compiled.
+     */
+    size_t create_encoder_id();
+
+private:
+    struct Entry {
+        std::string key;
+        std::vector<ov::Tensor> outputs;
+        size_t size_bytes;
+    };
+
+    PromptEmbeddingCache();
+
+    void evict(size_t capacity_bytes);
+
+    mutable std::mutex m_mutex;
+    // most recently used entries are at the front
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    Statistics m_statistics;
+    size_t m_next_encoder_id = 0;
+};
+
+} // namespace genai
+} // namespace ov
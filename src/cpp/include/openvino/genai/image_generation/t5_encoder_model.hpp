@@ -78,6 +78,11 @@ private:
     std::shared_ptr<ov::Model> m_model;
 
     Tokenizer m_tokenizer;
+
+    // identifies the compiled model in PromptEmbeddingCache
+    size_t m_cache_encoder_id = 0;
+    // outputs of the last infer() call if they were taken from PromptEmbeddingCache
+    std::vector<ov::Tensor> m_cached_outputs;
 };
 
 } // namespace genai
@@ -3,11 +3,33 @@
 
 #pragma once
 
+#include <future>
+
 #include "openvino/genai/image_generation/image2image_pipeline.hpp"
 
 namespace ov {
 namespace genai {
 
+class DiffusionRequestQueue;
+class StaticShapesCache;
+
+/**
+ * Statistics of a static shapes cache enabled via 'Text2ImagePipeline::enable_static_shapes_cache()'
+ */
+struct OPENVINO_GENAI_EXPORTS StaticShapesCacheMetrics {
+    // 'generate()' calls which found pipeline compiled or being compiled for their shapes
+    size_t hits = 0;
+    // 'generate()' calls which started compilation for their shapes
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t num_entries = 0;
+    size_t num_compilations = 0;
+    // total time spent on reshape and compilation of all models, including background ones
+    float compile_time_ms = 0.0f;
+    // total time 'generate()' calls waited for compilation to finish
+    float wait_time_ms = 0.0f;
+};
+
 /**
  * Text to image pipelines which provides unified API to all supported models types.
  * Models specific aspects are hidden in image generation config, which includes multiple prompts support or
@@ -214,6 +236,29 @@ public:
         return generate(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Submits image generation request to the pipeline queue and returns immediately. Requests are processed by
+     * a background thread, which denoises concurrent requests with the same resolution, guidance mode and current timestep
+     * within a single UNet inference per step. New requests join between denoising steps and finished requests leave
+     * the batch, so requests with the same number of inference steps submitted together are denoised together.
+     * Finished requests are decoded by another background thread with dedicated VAE infer requests, so VAE decoding of
+     * one request runs concurrently with text encoding and denoising of the next ones.
+     * @param positive_prompt Prompt to generate image(s) from
+     * @param properties Image generation parameters specified as properties. 'callback' is called from the background thread.
+     * @returns A future with a tensor which has dimensions [num_images_per_prompt, height, width, 3]
+     * @note Batched denoising is supported by Stable Diffusion, Latent Consistency Model and Stable Diffusion XL pipelines
+     * which are not reshaped to static shapes, other pipelines process queued requests one by one.
+     * LoRA adapters cannot be changed per request. Requests must not be mixed with concurrent 'generate()' calls.
+     */
+    std::future<ov::Tensor> generate_async(const std::string& positive_prompt, const ov::AnyMap& properties = {});
+
+    template <typename... Properties>
+    ov::util::EnableIfAllStringAny<std::future<ov::Tensor>, Properties...> generate_async(
+            const std::string& positive_prompt,
+            Properties&&... properties) {
+        return generate_async(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
+    }
+
     /**
      * Performs latent image decoding. It can be useful to use within 'callback' which accepts current latent image
      * @param latent A latent image
@@ -221,8 +266,38 @@ public:
      */
     ov::Tensor decode(const ov::Tensor latent);
 
+    /**
+     * Enables LRU cache of pipelines compiled for static shapes. Each 'generate()' call uses models reshaped and compiled
+     * for its num_images_per_prompt, height, width, guidance_scale > 1 and max_sequence_length, so static shapes
+     * performance is available for several resolutions without 'reshape()' and 'compile()' calls on each change.
+     * Shapes which are not cached yet are compiled on the first 'generate()' call, see 'precompile()' to compile them in advance.
+     * @param device A device to compile models with
+     * @param properties A map of properties which affect models compilation
+     * @param capacity A maximum number of compiled pipelines to keep, least recently used ones are evicted
+     * @note Pipeline must be created from a models path, since models are read again for each static shape.
+     * Memory consumption grows with the number of cached shapes, as each one holds its own compiled models.
+     */
+    void enable_static_shapes_cache(const std::string& device, const ov::AnyMap& properties = {}, size_t capacity = 4);
+
+    /**
+     * Starts background compilation of pipelines for given shapes, so subsequent 'generate()' calls with these
+     * shapes don't wait for compilation. Returns immediately. Static shapes cache must be enabled.
+     * @param shapes A list of image generation parameters, e.g. {ov::genai::width(512), ov::genai::height(768)},
+     * missing values are taken from the default generation config
+     */
+    void precompile(const std::vector<ov::AnyMap>& shapes);
+
+    /**
+     * Returns statistics of static shapes cache. Static shapes cache must be enabled.
+     */
+    StaticShapesCacheMetrics get_static_shapes_cache_metrics() const;
+
 private:
     std::shared_ptr<DiffusionPipeline> m_impl;
+    std::shared_ptr<DiffusionRequestQueue> m_request_queue;
+    std::shared_ptr<StaticShapesCache> m_static_shapes_cache;
+    // empty for pipelines created from individual models
+    std::filesystem::path m_models_path;
 
     explicit Text2ImagePipeline(const std::shared_ptr<DiffusionPipeline>& impl);
 };
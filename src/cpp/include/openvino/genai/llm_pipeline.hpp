@@ -9,6 +9,7 @@
 #include <filesystem>
 
 #include "openvino/core/any.hpp"
+#include "openvino/genai/chat_snapshot.hpp"
 #include "openvino/genai/generation_config.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/genai/streamer_base.hpp"
@@ -276,6 +277,20 @@ public:
     * Turns off keeping KV cache between generate calls.
     */
     void finish_chat();
+
+    /**
+    * @brief takes snapshot of the current chat: KV cache and history.
+    * If it's called right after start_chat(system_message), the system message is processed by the model,
+    * so the snapshot can seed new chats with the system message at no cost of its processing.
+    * Supported only for stateful models.
+    */
+    ChatSnapshot get_chat_snapshot();
+
+    /**
+    * @brief starts chat from the snapshot, the current chat is finished.
+    * The snapshot is not modified and can be restored any number of times.
+    */
+    void restore_chat(const ChatSnapshot& snapshot);
 private:
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
 };
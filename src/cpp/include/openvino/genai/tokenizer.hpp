@@ -7,6 +7,7 @@
 #include <vector>
 #include <initializer_list>
 #include <filesystem>
+#include <functional>
 
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/genai/visibility.hpp"
@@ -122,6 +123,19 @@ public:
     TokenizedInputs encode(std::vector<std::string>&& prompts, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(std::initializer_list<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
 
+    /**
+    * @brief encode a large number of prompts batch by batch. Batches are tokenized in parallel by idle infer requests
+    * and passed to the callback in the order of prompts. Left padding is applied to each batch separately.
+    * @param prompts vector storing prompts, it must not be modified until the call returns
+    * @param batch_size number of prompts in a batch
+    * @param callback called with index of the first prompt of a batch and the encoded batch, returns true to stop encoding
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {"add_special_tokens", false}
+    */
+    void encode_batches(const std::vector<std::string>& prompts,
+                        size_t batch_size,
+                        const std::function<bool(size_t, TokenizedInputs)>& callback,
+                        const ov::AnyMap& tokenization_params = {});
+
     /**
     * @brief encode a single prompt
     * @param prompt std::string with input prompt
@@ -12,6 +12,12 @@ namespace ov::genai {
 struct OPENVINO_GENAI_EXPORTS VLMRawPerfMetrics {
     /** @brief Duration of preparation of embeddings */
     std::vector<MicroSeconds> prepare_embeddings_durations;
+    /** @brief Number of images which embeddings were taken from VisionEmbeddingCache */
+    size_t vision_embedding_cache_hits = 0;
+    /** @brief Number of images which were encoded by vision models */
+    size_t vision_embedding_cache_misses = 0;
+    /** @brief Size of VisionEmbeddingCache in bytes after the last generate call */
+    size_t vision_embedding_cache_size_bytes = 0;
 };
 
 struct OPENVINO_GENAI_EXPORTS VLMPerfMetrics : public PerfMetrics {
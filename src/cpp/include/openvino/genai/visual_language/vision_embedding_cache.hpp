@@ -0,0 +1,103 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Process-wide LRU cache of image embeddings used by VLMPipeline.
+ * Embeddings produced by vision encoder (and resampler for MiniCPM) are stored per (vision model, image content,
+ * preprocessing config), so an image sent again, e.g. on each chat turn or by another pipeline with the same model,
+ * skips preprocessing and vision models inference.
+ * Vision models loaded from the same directory for the same device and properties share cached embeddings.
+ */
+class OPENVINO_GENAI_EXPORTS VisionEmbeddingCache {
+public:
+    struct OPENVINO_GENAI_EXPORTS Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t num_entries = 0;
+        size_t size_bytes = 0;
+        size_t capacity_bytes = 0;
+    };
+
+    struct OPENVINO_GENAI_EXPORTS Key {
+        size_t encoder_id;
+        // SHA-256 of image bytes, so different images practically never share embeddings
+        std::string image_hash;
+        ov::Shape image_shape;
+        std::string processor_config;
+    };
+
+    static VisionEmbeddingCache& instance();
+
+    /**
+     * Sets cache budget in bytes and evicts least recently used entries exceeding it. 0 disables the cache.
+     * Default capacity is 256 MB.
+     */
+    void set_capacity(size_t capacity_bytes);
+
+    size_t get_capacity() const;
+
+    Statistics get_statistics() const;
+
+    void clear();
+
+    /**
+     * Returns embeddings stored for the key and marks the entry as recently used. Counts a hit or a miss.
+     * Returned tensors are shared with the cache and must not be modified.
+     */
+    std::optional<std::vector<ov::Tensor>> find(const Key& key);
+
+    /**
+     * Stores deep copies of embeddings, empty tensors are kept as is. Entries larger than capacity are not stored.
+     */
+    void insert(const Key& key, const std::vector<ov::Tensor>& embeddings);
+
+    /**
+     * Returns an identifier of vision models, which is the same for the same non-empty 'model_identity',
+     * e.g. models directory, device and properties. An empty identity always gets a new unique identifier.
+     */
+    size_t get_encoder_id(const std::string& model_identity);
+
+    /**
+     * Returns SHA-256 of image bytes as a hex string to build a cache key.
+     */
+    static std::string hash_image(const ov::Tensor& image);
+
+private:
+    struct Entry {
+        std::string key;
+        std::vector<ov::Tensor> embeddings;
+        size_t size_bytes;
+    };
+
+    VisionEmbeddingCache();
+
+    void evict(size_t capacity_bytes);
+
+    mutable std::mutex m_mutex;
+    // most recently used entries are at the front
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    std::unordered_map<std::string, size_t> m_encoder_ids;
+    Statistics m_statistics;
+    size_t m_next_encoder_id = 0;
+};
+
+} // namespace genai
+} // namespace ov
@@ -110,6 +110,44 @@ public:
     // A list containing the non-speech tokens that will be suppressed during generation.
     std::vector<int64_t> suppress_tokens;
 
+    // Beam search
+
+    // Number of beams decoded together as one batch. 1 means greedy decoding.
+    size_t num_beams = 1;
+
+    // Exponential penalty to the length: sequences are ranked by sum of log probabilities / length^length_penalty.
+    float length_penalty = 1.0f;
+
+    // Temperature fallback
+
+    /*
+     * Temperatures tried one after another while a decoded chunk fails `compression_ratio_threshold` or
+     * `logprob_threshold`. Temperature 0 means beam search (or greedy) decoding, other temperatures sample
+     * `num_beams` candidates and take the most probable one. All non-zero temperatures are decoded as one batch
+     * which runs only if the result of temperature 0 fails the thresholds.
+     *
+     * Example of quality mode with temperature fallback:
+     *  auto result = pipeline.generate(raw_speech,
+     *                                  ov::genai::num_beams(5),
+     *                                  ov::genai::temperatures({0.0f, 0.2f, 0.4f, 0.6f, 0.8f, 1.0f}),
+     *                                  ov::genai::compression_ratio_threshold(1.5f),
+     *                                  ov::genai::logprob_threshold(-1.0f));
+     */
+    std::vector<float> temperatures = {0.0f};
+
+    // Repetition threshold: the number of tokens divided by the number of LZ77 phrases needed to encode them.
+    // Looped hallucinations such as the same phrase repeated many times have a high ratio.
+    // Ordinary text of a 30 seconds chunk stays below 1.2, a phrase repeated 3 times or more gives 1.5 and above,
+    // so 1.5 is a reasonable threshold. Note that it isn't the gzip ratio of text bytes used by OpenAI Whisper,
+    // so OpenAI's threshold 2.4 misses most of the loops.
+    std::optional<float> compression_ratio_threshold = std::nullopt;
+
+    // Threshold of the average log probability of generated tokens.
+    std::optional<float> logprob_threshold = std::nullopt;
+
+    // Seed of the random generator used by temperature fallback.
+    size_t rng_seed = 0;
+
     /** @brief sets eos_token_id to tokenizer_eos_token_id if eos_token_id is less than 0.
      * Otherwise verifies eos_token_id == tokenizer_eos_token_id.
      */
@@ -147,6 +185,9 @@ static constexpr ov::Property<bool> return_timestamps{"return_timestamps"};
 static constexpr ov::Property<std::string> initial_prompt{"initial_prompt"};
 static constexpr ov::Property<std::string> hotwords{"hotwords"};
 static constexpr ov::Property<std::map<std::string, int64_t>> lang_to_id{"lang_to_id"};
+static constexpr ov::Property<std::vector<float>> temperatures{"temperatures"};
+static constexpr ov::Property<float> compression_ratio_threshold{"compression_ratio_threshold"};
+static constexpr ov::Property<float> logprob_threshold{"logprob_threshold"};
 
 }  // namespace genai
 }  // namespace ov
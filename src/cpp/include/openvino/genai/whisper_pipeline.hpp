@@ -169,6 +169,55 @@ public:
     }
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input, const ov::AnyMap& config_map);
 
+    /**
+     * @brief Batched generate that transcribes multiple raw speech inputs at once.
+     * Encoder runs on stacked chunks of all unfinished inputs and decoder runs with a dynamic batch where
+     * every input finishes independently. Consecutive chunks of one long-form input are still processed
+     * one after another because every next chunk starts at the last timestamp of the previous one.
+     *
+     * @param raw_speech_inputs raw speech inputs. Required to be normalized to near [-1, 1] range and have 16k Hz
+     * sampling rate.
+     * @param generation_config optional GenerationConfig, shared by all inputs
+     * @return decoded results, one per input. Perf metrics of every result describe its own input: feature extraction
+     * of the input, encoder and language detection inferences of batches the input took part in, and decoder steps
+     * where the input was still active. Durations of shared inferences are included into metrics of every input of
+     * the batch.
+     */
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                OptionalWhisperGenerationConfig generation_config = std::nullopt);
+
+    template <typename... Properties>
+    util::EnableIfAllStringAny<std::vector<WhisperDecodedResults>, Properties...> generate(
+        const std::vector<RawSpeechInput>& raw_speech_inputs,
+        Properties&&... properties) {
+        return generate(raw_speech_inputs, AnyMap{std::forward<Properties>(properties)...});
+    }
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                const ov::AnyMap& config_map);
+
+    /**
+     * @brief Starts transcription of audio which arrives in pieces, e.g. from a microphone.
+     * Stable text is sent to the streamer while audio is being pushed, the rest is finalized by finish_stream().
+     *
+     * @param generation_config optional GenerationConfig
+     * @param streamer optional streamer, receives text as soon as it is confirmed by two consecutive decodings
+     */
+    void start_stream(OptionalWhisperGenerationConfig generation_config = std::nullopt,
+                      ChunkStreamerVariant streamer = std::monostate());
+
+    /**
+     * @brief Appends audio to the started stream. Decoding runs after every 0.5 seconds of received audio.
+     *
+     * @param audio_chunk raw speech. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+     */
+    void push_audio(const RawSpeechInput& audio_chunk);
+
+    /**
+     * @brief Finishes the started stream: decodes the remaining audio and returns the whole transcription.
+     * @return WhisperDecodedResults decoded resulting text transcription
+     */
+    WhisperDecodedResults finish_stream();
+
     ov::genai::Tokenizer get_tokenizer();
     WhisperGenerationConfig get_generation_config() const;
     void set_generation_config(const WhisperGenerationConfig& config);
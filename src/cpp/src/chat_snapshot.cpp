@@ -0,0 +1,182 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/chat_snapshot.hpp"
+
+#include <cstring>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include "openvino/core/except.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+// file layout: magic, version, size of json header, json header, KV cache tensors aligned to ALIGNMENT
+constexpr char MAGIC[8] = {'O', 'V', 'G', 'C', 'H', 'A', 'T', '\0'};
+constexpr uint64_t VERSION = 1;
+constexpr size_t PREAMBLE_SIZE = sizeof(MAGIC) + 2 * sizeof(uint64_t);
+constexpr size_t ALIGNMENT = 64;
+
+size_t align(size_t offset) {
+    return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+// Copy on write mapping, so tensors can be set as model states by plugins, which modify them in place
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        OPENVINO_ASSERT(file != INVALID_HANDLE_VALUE, "Cannot open chat snapshot ", path);
+        LARGE_INTEGER file_size;
+        GetFileSizeEx(file, &file_size);
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        OPENVINO_ASSERT(mapping != nullptr, "Cannot map chat snapshot ", path);
+        m_data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+        CloseHandle(mapping);
+        OPENVINO_ASSERT(m_data != nullptr, "Cannot map chat snapshot ", path);
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        OPENVINO_ASSERT(fd != -1, "Cannot open chat snapshot ", path);
+        struct stat file_stat;
+        fstat(fd, &file_stat);
+        m_size = static_cast<size_t>(file_stat.st_size);
+        void* data = m_size > 0 ? mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        close(fd);
+        OPENVINO_ASSERT(data != MAP_FAILED, "Cannot map chat snapshot ", path);
+        m_data = static_cast<char*>(data);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(m_data, m_size);
+#endif
+    }
+
+    char* data() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+} // namespace
+
+void ChatSnapshot::save(const std::filesystem::path& path) const {
+    nlohmann::json header = {
+        {"chat_input_type", m_chat_input_type},
+        {"history", m_history},
+        {"templated_history", m_templated_history},
+        {"tokenized_history", m_tokenized_history},
+        {"answer_tokens_offset", m_answer_tokens_offset},
+        {"last_disappeared_token", m_last_disappeared_token.has_value() ? nlohmann::json(*m_last_disappeared_token) : nlohmann::json(nullptr)},
+        {"num_tokens_to_remove_from_kv_cache", m_num_tokens_to_remove_from_kv_cache},
+        {"trusted_history_length", m_trusted_history_length},
+        {"kv_cache_length", m_kv_cache_length},
+        {"kv_cache", nlohmann::json::array()}
+    };
+
+    size_t offset = 0;
+    for (const auto& [name, tensor] : m_kv_cache) {
+        OPENVINO_ASSERT(tensor.is_continuous(), "KV cache tensor '", name, "' of chat snapshot must be continuous");
+        header["kv_cache"].push_back({
+            {"name", name},
+            {"element_type", tensor.get_element_type().get_type_name()},
+            {"shape", std::vector<size_t>(tensor.get_shape().begin(), tensor.get_shape().end())},
+            {"offset", offset},
+            {"byte_size", tensor.get_byte_size()}
+        });
+        offset = align(offset + tensor.get_byte_size());
+    }
+
+    const std::string serialized_header = header.dump();
+    const uint64_t header_size = serialized_header.size();
+
+    std::ofstream file(path, std::ios::binary);
+    OPENVINO_ASSERT(file.is_open(), "Cannot open ", path, " to save chat snapshot");
+    file.write(MAGIC, sizeof(MAGIC));
+    file.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+    file.write(reinterpret_cast<const char*>(&header_size), sizeof(header_size));
+    file.write(serialized_header.data(), header_size);
+
+    const std::vector<char> padding(ALIGNMENT, 0);
+    // offsets of tensors are relative to the aligned end of the header
+    size_t position = PREAMBLE_SIZE + header_size;
+    for (const auto& [name, tensor] : m_kv_cache) {
+        file.write(padding.data(), align(position) - position);
+        file.write(static_cast<const char*>(tensor.data()), tensor.get_byte_size());
+        position = align(position) + tensor.get_byte_size();
+    }
+    OPENVINO_ASSERT(file.good(), "Failed to write chat snapshot into ", path);
+}
+
+ChatSnapshot ChatSnapshot::load(const std::filesystem::path& path) {
+    auto mapped_file = std::make_shared<MappedFile>(path);
+    const char* data = mapped_file->data();
+    OPENVINO_ASSERT(mapped_file->size() >= PREAMBLE_SIZE && std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0, path, " is not a chat snapshot");
+
+    uint64_t version = 0, header_size = 0;
+    std::memcpy(&version, data + sizeof(MAGIC), sizeof(version));
+    std::memcpy(&header_size, data + sizeof(MAGIC) + sizeof(version), sizeof(header_size));
+    OPENVINO_ASSERT(version == VERSION, "Unsupported version ", version, " of chat snapshot ", path);
+    OPENVINO_ASSERT(PREAMBLE_SIZE + header_size <= mapped_file->size(), "Chat snapshot ", path, " is truncated");
+
+    const nlohmann::json header = nlohmann::json::parse(data + PREAMBLE_SIZE, data + PREAMBLE_SIZE + header_size);
+    const size_t data_start = align(PREAMBLE_SIZE + header_size);
+
+    ChatSnapshot snapshot;
+    snapshot.m_chat_input_type = header.at("chat_input_type").get<int>();
+    snapshot.m_history = header.at("history").get<ChatHistory>();
+    snapshot.m_templated_history = header.at("templated_history").get<std::string>();
+    snapshot.m_tokenized_history = header.at("tokenized_history").get<std::vector<int64_t>>();
+    snapshot.m_answer_tokens_offset = header.at("answer_tokens_offset").get<size_t>();
+    if (!header.at("last_disappeared_token").is_null())
+        snapshot.m_last_disappeared_token = header.at("last_disappeared_token").get<int64_t>();
+    snapshot.m_num_tokens_to_remove_from_kv_cache = header.at("num_tokens_to_remove_from_kv_cache").get<size_t>();
+    snapshot.m_trusted_history_length = header.at("trusted_history_length").get<size_t>();
+    snapshot.m_kv_cache_length = header.at("kv_cache_length").get<size_t>();
+
+    for (const auto& state : header.at("kv_cache")) {
+        const size_t offset = data_start + state.at("offset").get<size_t>();
+        ov::Tensor tensor(ov::element::Type(state.at("element_type").get<std::string>()), ov::Shape(state.at("shape").get<std::vector<size_t>>()),
+                          mapped_file->data() + offset);
+        OPENVINO_ASSERT(tensor.get_byte_size() == state.at("byte_size").get<size_t>() && offset + tensor.get_byte_size() <= mapped_file->size(),
+                        "Chat snapshot ", path, " is truncated");
+        snapshot.m_kv_cache.emplace(state.at("name").get<std::string>(), tensor);
+    }
+    snapshot.m_mapped_file = mapped_file;
+    return snapshot;
+}
+
+} // namespace genai
+} // namespace ov
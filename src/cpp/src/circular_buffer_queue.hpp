@@ -63,6 +63,22 @@ public:
         return idle_future;
     }
 
+    // returns -1 instead of waiting if there is no idle element
+    int try_get_idle() {
+        std::unique_lock<std::mutex> lk(m_front_mut);
+        if (m_values[m_front_idx] < 0) {
+            return -1;
+        }
+        int value = m_values[m_front_idx];
+        m_values[m_front_idx] = -1;
+        m_front_idx = (m_front_idx + 1) % m_values.size();
+        return value;
+    }
+
+    size_t size() const {
+        return m_values.size();
+    }
+
     void return_to(int value) {
         std::unique_lock<std::mutex> lk(m_queue_mutex);
         if (m_promises.size()) {
@@ -91,6 +107,12 @@ public:
         m_value = m_queue->get_idle().get();   // blocking until we get the element
     }
 
+    // takes the element obtained by CircularBufferQueue::try_get_idle
+    CircularBufferQueueElementGuard(CircularBufferQueue<T>* queue, int value) : m_queue(queue), m_value(value) {}
+
+    CircularBufferQueueElementGuard(const CircularBufferQueueElementGuard&) = delete;
+    CircularBufferQueueElementGuard& operator=(const CircularBufferQueueElementGuard&) = delete;
+
     T& get() {
         return m_queue->get(m_value);
     }
@@ -1,15 +1,55 @@
 // Copyright (C) 2023-2024 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <array>
+
 #include "text_callback_streamer.hpp"
 #include "continuous_batching_impl.hpp"
 #include "utils.hpp"
 #include "utils/paged_attention_transformations.hpp"
+#include "openvino/genai/visual_language/perf_metrics.hpp"
+#include "openvino/genai/visual_language/vision_embedding_cache.hpp"
 
 namespace ov::genai {
 template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
+namespace {
+
+// Prompt ids of requests with images are the same for any images, so prefix caching hashes them mixed with SHA-256
+// of the images. Ids before the first image are kept, so requests with different images share KV blocks of a common
+// beginning, e.g. a system prompt, and prompts without images share KV blocks with the same prompts passed as text.
+TokenIds get_prompt_hash_ids(const ov::Tensor& prompt_ids, size_t num_prompt_tokens, const std::vector<ov::Tensor>& rgbs, size_t first_image_position) {
+    // each of 64 bit lanes combines a quarter of every image digest, so ids are mixed with whole digests
+    std::array<size_t, 4> images_hash{};
+    auto combine = [] (size_t& seed, size_t value) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    for (const ov::Tensor& rgb : rgbs) {
+        const std::string digest = VisionEmbeddingCache::hash_image(rgb);
+        const size_t lane_digits = digest.size() / images_hash.size();
+        for (size_t lane = 0; lane < images_hash.size(); ++lane) {
+            combine(images_hash[lane], std::stoull(digest.substr(lane * lane_digits, lane_digits), nullptr, 16));
+            for (size_t dim : rgb.get_shape()) {
+                combine(images_hash[lane], dim);
+            }
+        }
+    }
+
+    const int64_t* prompt_ids_data = prompt_ids.data<const int64_t>();
+    TokenIds hash_ids(prompt_ids_data, prompt_ids_data + prompt_ids.get_size());
+    // positions beyond tokenized prompt (embeddings of prompt can be longer than its ids) must not match any token
+    std::fill(hash_ids.begin() + num_prompt_tokens, hash_ids.end(), -1);
+    if (!rgbs.empty()) {
+        for (size_t i = std::min(first_image_position, hash_ids.size()); i < hash_ids.size(); ++i) {
+            hash_ids[i] ^= static_cast<int64_t>(images_hash[i % images_hash.size()]);
+        }
+    }
+    return hash_ids;
+}
+
+} // namespace
+
 ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
     const std::shared_ptr<ov::Model>& model,
     const Tokenizer& tokenizer,
@@ -36,6 +76,23 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
     init(model, scheduler_config, compile_properties, device_config, core);
 }
 
+ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
+    const std::shared_ptr<InputsEmbedder>& inputs_embedder,
+    const std::filesystem::path& models_path,
+    const SchedulerConfig& scheduler_config,
+    const std::string& device,
+    const ov::AnyMap& properties)
+    : ContinuousBatchingImpl(utils::singleton_core().read_model((models_path / "openvino_language_model.xml").string()),
+                             inputs_embedder->get_tokenizer(),
+                             scheduler_config,
+                             device,
+                             properties,
+                             utils::from_config_json_if_exists(models_path)) {
+    m_inputs_embedder = inputs_embedder;
+    // the runner embeds generated tokens during step(), while add_request() may embed prompts from another thread
+    m_model_runner->set_embedding_model(m_inputs_embedder->get_embedding_model().clone());
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
     m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
@@ -84,6 +141,15 @@ GenerationHandle
 ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
                                                                const ov::Tensor& input_ids,
                                                                ov::genai::GenerationConfig sampling_params) {
+    return _add_request(request_id, input_ids, sampling_params);
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::ContinuousBatchingImpl::_add_request(uint64_t request_id,
+                                                                const ov::Tensor& input_ids,
+                                                                ov::genai::GenerationConfig sampling_params,
+                                                                const ov::Tensor& prompt_embeds,
+                                                                const TokenIds& prompt_hash_ids) {
     // If eos_token_id was not provided, take value from default m_generation_config
     if (sampling_params.eos_token_id == -1)
         sampling_params.set_eos_token_id(m_generation_config.eos_token_id);
@@ -94,6 +160,9 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
                                                                         m_scheduler->get_block_size(),
                                                                         m_scheduler->get_config().enable_prefix_caching);
     sequence_group->set_sequence_group_ptr(sequence_group);
+    if (prompt_embeds) {
+        sequence_group->set_prompt_embeds(prompt_embeds, prompt_hash_ids);
+    }
     if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
     }
@@ -116,6 +185,41 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
     return add_request(request_id, input_ids, sampling_params);
 }
 
+GenerationHandle
+ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
+                                                                const std::string& prompt,
+                                                                const std::vector<ov::Tensor>& rgbs,
+                                                                ov::genai::GenerationConfig sampling_params) {
+    OPENVINO_ASSERT(m_inputs_embedder, "Images are supported only by ContinuousBatchingPipeline created from a visual language model");
+
+    ov::Tensor inputs_embeds;
+    std::vector<int64_t> tokenized_prompt;
+    size_t first_image_position = 0;
+    {
+        static ManualTimer timer("get_inputs_embeds");
+        timer.start();
+        std::lock_guard<std::mutex> lock{m_inputs_embedder_mutex};
+        VLMPerfMetrics metrics;
+        ov::Tensor embeds = m_inputs_embedder->get_inputs_embeds(prompt, rgbs, metrics);
+        // embeddings may live in output tensor of the embedding model, which is overwritten by the next prompt
+        inputs_embeds = ov::Tensor(embeds.get_element_type(), embeds.get_shape());
+        embeds.copy_to(inputs_embeds);
+        tokenized_prompt = m_inputs_embedder->get_tokenized_history();
+        first_image_position = m_inputs_embedder->get_first_image_position();
+        timer.end();
+    }
+
+    // prompt ids are used by sampler only, e.g. to apply penalties, so image positions are filled with pad token
+    // the same way as VLMPipeline does
+    size_t prompt_len = inputs_embeds.get_shape().at(1);
+    size_t num_prompt_tokens = std::min(tokenized_prompt.size(), prompt_len);
+    ov::Tensor prompt_ids(ov::element::i64, {1, prompt_len});
+    std::fill_n(prompt_ids.data<int64_t>(), prompt_len, m_tokenizer.get_pad_token_id());
+    std::copy_n(tokenized_prompt.begin(), num_prompt_tokens, prompt_ids.data<int64_t>());
+
+    return _add_request(request_id, prompt_ids, sampling_params, inputs_embeds, get_prompt_hash_ids(prompt_ids, num_prompt_tokens, rgbs, first_image_position));
+}
+
 bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
     return !m_awaiting_requests.empty() || !m_requests.empty();
@@ -235,8 +339,48 @@ std::vector<EncodedGenerationResult>
 ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<ov::Tensor>& input_ids,
                                                              const std::vector<GenerationConfig>& sampling_params,
                                                              const StreamerVariant& streamer) {
+    return _generate(input_ids.size(), sampling_params, streamer, [&] (size_t request_id) {
+        OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
+        return add_request(request_id, input_ids[request_id], sampling_params[request_id]);
+    });
+}
+
+std::vector<GenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<std::string>& prompts,
+                                                             const std::vector<std::vector<ov::Tensor>>& rgbs,
+                                                             const std::vector<GenerationConfig>& sampling_params,
+                                                             const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!m_is_chat_conversation, "Chat mode is not supported for requests with images");
+    OPENVINO_ASSERT(prompts.size() == rgbs.size(), "Number of prompts and number of image lists must be the same");
+    std::vector<EncodedGenerationResult> encoded = _generate(prompts.size(), sampling_params, streamer, [&] (size_t request_id) {
+        return add_request(request_id, prompts[request_id], rgbs[request_id], sampling_params[request_id]);
+    });
+
+    std::vector<GenerationResult> decoded;
+    decoded.reserve(encoded.size());
+    for (EncodedGenerationResult& res : encoded) {
+        std::vector<std::string> generated;
+        generated.reserve(res.m_generation_ids.size());
+        for (const auto& generation_ids : res.m_generation_ids) {
+            generated.push_back(m_tokenizer.decode(generation_ids));
+        }
+        decoded.push_back(GenerationResult{
+            res.m_request_id,
+            std::move(generated),
+            std::move(res.m_scores),
+            res.m_status
+        });
+    }
+    return decoded;
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::_generate(size_t num_requests,
+                                                              const std::vector<GenerationConfig>& sampling_params,
+                                                              const StreamerVariant& streamer,
+                                                              const std::function<GenerationHandle(size_t)>& add_request_fn) {
     OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
-    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+    OPENVINO_ASSERT(num_requests == sampling_params.size());
     const std::shared_ptr<StreamerBase>& streamer_ptr = std::visit(overloaded{
         [](std::monostate) -> std::shared_ptr<StreamerBase> {
             return nullptr;
@@ -261,14 +405,13 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         m_requests.clear();
     };
 
-    OPENVINO_ASSERT(streamer_ptr == nullptr || input_ids.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
+    OPENVINO_ASSERT(streamer_ptr == nullptr || num_requests == 1 && sampling_params[0].num_return_sequences == 1 &&
         (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
         "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
 
     std::vector<GenerationHandle> generations;
-    for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
-        OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
-        generations.push_back(add_request(request_id, input_ids[request_id], sampling_params[request_id]));
+    for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+        generations.push_back(add_request_fn(request_id));
     }
     auto all_requests = m_awaiting_requests; // we need to store all requests to get results from them once generation has finished
 
@@ -333,7 +476,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         results.push_back(std::move(result));
     }
 
-    OPENVINO_ASSERT(results.size() == input_ids.size());
+    OPENVINO_ASSERT(results.size() == num_requests);
     return results;
 }
 
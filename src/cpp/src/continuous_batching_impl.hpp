@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <functional>
+
 #include "continuous_batching_impl_interface.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "cache_eviction.hpp"
+#include "visual_language/inputs_embedder.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingImpl : public ContinuousBatchingPipeline::ImplInterface {
@@ -22,6 +25,11 @@ protected:
     // Mutex protecting access to m_awaiting_requests, so add_request and step methods can be called from different threads
     std::mutex m_awaiting_requests_mutex;
 
+    // computes prompt embeddings of requests with images, set only for visual language models
+    std::shared_ptr<InputsEmbedder> m_inputs_embedder;
+    // Mutex protecting m_inputs_embedder, which keeps state of the last embedded prompt
+    std::mutex m_inputs_embedder_mutex;
+
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
     static const size_t AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS = 1000;
@@ -52,6 +60,19 @@ protected:
     virtual void _pull_awaiting_requests();
 
     void _fill_prompt_log_probs(std::vector<SequenceGroup::Ptr>& sequence_groups, ov::Tensor& logits);
+
+    GenerationHandle _add_request(uint64_t request_id,
+                                  const ov::Tensor& input_ids,
+                                  ov::genai::GenerationConfig sampling_params,
+                                  const ov::Tensor& prompt_embeds = {},
+                                  const TokenIds& prompt_hash_ids = {});
+
+    // adds requests via 'add_request_fn(request_id)' and runs steps until all of them are finished
+    std::vector<EncodedGenerationResult>
+    _generate(size_t num_requests,
+              const std::vector<GenerationConfig>& sampling_params,
+              const StreamerVariant& streamer,
+              const std::function<GenerationHandle(size_t)>& add_request_fn);
 public:
     ContinuousBatchingImpl(const std::shared_ptr<ov::Model>& model,
                            const Tokenizer& tokenizer,
@@ -61,12 +82,23 @@ public:
                            const ov::genai::GenerationConfig& generation_config,
                            bool is_validation_mode_enabled = false);
 
+    // creates the pipeline for the language model of a visual language model, which consumes inputs_embeds
+    ContinuousBatchingImpl(const std::shared_ptr<InputsEmbedder>& inputs_embedder,
+                           const std::filesystem::path& models_path,
+                           const SchedulerConfig& scheduler_config,
+                           const std::string& device,
+                           const ov::AnyMap& properties);
+
     GenerationHandle add_request(uint64_t request_id,
                                  const ov::Tensor& input_ids,
                                  ov::genai::GenerationConfig sampling_params) override;
     GenerationHandle add_request(uint64_t request_id,
                                  const std::string& prompt,
                                  ov::genai::GenerationConfig sampling_params) override;
+    GenerationHandle add_request(uint64_t request_id,
+                                 const std::string& prompt,
+                                 const std::vector<ov::Tensor>& rgbs,
+                                 ov::genai::GenerationConfig sampling_params) override;
 
     bool has_non_finished_requests() override;
 
@@ -76,5 +108,10 @@ public:
     generate(const std::vector<ov::Tensor>& input_ids,
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer) override;
+    std::vector<GenerationResult>
+    generate(const std::vector<std::string>& prompts,
+             const std::vector<std::vector<ov::Tensor>>& rgbs,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) override;
 };
 }
\ No newline at end of file
@@ -17,6 +17,21 @@ Tokenizer ContinuousBatchingPipeline::ImplInterface::get_tokenizer() {
     return m_tokenizer;
 }
 
+GenerationHandle ContinuousBatchingPipeline::ImplInterface::add_request(uint64_t request_id,
+                                                                      const std::string& prompt,
+                                                                      const std::vector<ov::Tensor>& rgbs,
+                                                                      ov::genai::GenerationConfig sampling_params) {
+    OPENVINO_THROW("Images are supported only by ContinuousBatchingPipeline created from a visual language model");
+}
+
+std::vector<GenerationResult>
+ContinuousBatchingPipeline::ImplInterface::generate(const std::vector<std::string>& prompts,
+                                                    const std::vector<std::vector<ov::Tensor>>& rgbs,
+                                                    const std::vector<GenerationConfig>& sampling_params,
+                                                    const StreamerVariant& streamer) {
+    OPENVINO_THROW("Images are supported only by ContinuousBatchingPipeline created from a visual language model");
+}
+
 void ContinuousBatchingPipeline::ImplInterface::start_chat(const std::string& system_message) {
     if (!system_message.empty()) {
         m_history.push_back({{"role", "system"}, {"content", system_message}});
@@ -49,6 +49,10 @@ public:
     virtual GenerationHandle add_request(uint64_t request_id,
                                          const std::string& prompt,
                                          ov::genai::GenerationConfig sampling_params) = 0;
+    virtual GenerationHandle add_request(uint64_t request_id,
+                                         const std::string& prompt,
+                                         const std::vector<ov::Tensor>& rgbs,
+                                         ov::genai::GenerationConfig sampling_params);
     
     virtual bool has_non_finished_requests() = 0;
 
@@ -62,6 +66,11 @@ public:
     generate(const std::vector<std::string>& prompts,
              std::vector<ov::genai::GenerationConfig> sampling_params,
              const StreamerVariant& streamer);
+    virtual std::vector<GenerationResult>
+    generate(const std::vector<std::string>& prompts,
+             const std::vector<std::vector<ov::Tensor>>& rgbs,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer);
 
     void start_chat(const std::string& system_message);
     void finish_chat();
@@ -16,6 +16,7 @@
 #include "utils.hpp"
 #include "debug_utils.hpp"
 #include "cache_state_dumper.hpp"
+#include "visual_language/inputs_embedder.hpp"
 
 using namespace ov::genai;
 
@@ -47,7 +48,16 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
-    
+
+    if (std::filesystem::exists(models_path / "openvino_language_model.xml")) {
+        OPENVINO_ASSERT(draft_model_desr.model == nullptr && !is_prompt_lookup_enabled,
+                        "Speculative decoding and prompt lookup decoding are not supported for visual language models");
+        auto vlm_config = utils::from_config_json_if_exists<VLMConfig>(models_path, "config.json");
+        auto inputs_embedder = std::make_shared<InputsEmbedder>(vlm_config, models_path, device, properties_without_draft_model);
+        m_impl = std::make_shared<ContinuousBatchingImpl>(inputs_embedder, models_path, scheduler_config, device, properties_without_draft_model);
+        return;
+    }
+
     std::filesystem::path openvino_model_name = "openvino_model.xml";
     auto model = utils::singleton_core().read_model((models_path / openvino_model_name).string());
     auto tokenizer = ov::genai::Tokenizer(models_path, tokenizer_properties);
@@ -131,6 +141,10 @@ GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, co
     return m_impl->add_request(request_id, input_ids, sampling_params);
 }
 
+GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const std::vector<ov::Tensor>& rgbs, const ov::genai::GenerationConfig& sampling_params) {
+    return m_impl->add_request(request_id, prompt, rgbs, sampling_params);
+}
+
 void ContinuousBatchingPipeline::step() {
     m_impl->step();
 }
@@ -147,6 +161,10 @@ std::vector<GenerationResult> ContinuousBatchingPipeline::generate(const std::ve
     return m_impl->generate(prompts, sampling_params, streamer);
 }
 
+std::vector<GenerationResult> ContinuousBatchingPipeline::generate(const std::vector<std::string>& prompts, const std::vector<std::vector<ov::Tensor>>& rgbs, const std::vector<ov::genai::GenerationConfig>& sampling_params, const StreamerVariant& streamer) {
+    return m_impl->generate(prompts, rgbs, sampling_params, streamer);
+}
+
 void ContinuousBatchingPipeline::start_chat(const std::string& system_message) {
     m_impl->start_chat(system_message);
 };
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <fstream>
+#include <functional>
+#include <map>
 #include <tuple>
 
 #include "image_generation/schedulers/ischeduler.hpp"
+#include "openvino/genai/image_generation/autoencoder_kl.hpp"
 #include "openvino/genai/image_generation/generation_config.hpp"
 
 #include "json_utils.hpp"
@@ -90,6 +94,58 @@ public:
 
     virtual ov::Tensor decode(const ov::Tensor latent) = 0;
 
+    // state of a text to image request which is denoised together with other requests, see DiffusionRequestQueue
+    struct DenoisingRequest {
+        ImageGenerationConfig generation_config;
+        std::function<bool(size_t, size_t, ov::Tensor&)> callback = nullptr;
+        std::shared_ptr<IScheduler> scheduler;
+        std::vector<std::int64_t> timesteps;
+        size_t inference_step = 0;
+        size_t batch_size_multiplier = 1;
+        ov::Tensor latent, denoised;
+        // guided model output of the current step, reused between steps, see 'reuse_buffer'
+        ov::Tensor noisy_residual;
+        // denoising model inputs besides sample and timestep, their batch is latent batch * batch_size_multiplier
+        std::map<std::string, ov::Tensor> hidden_states;
+        bool cancelled = false;
+
+        bool is_finished() const {
+            return cancelled || inference_step == timesteps.size();
+        }
+    };
+
+    // pipelines which don't support batched denoising process requests from DiffusionRequestQueue one by one via 'generate'
+    virtual bool is_batched_denoising_supported() const {
+        return false;
+    }
+
+    // computes text embeddings and initial latent of a request
+    // note, it resets models state of the pipeline: UNet inputs, cached hidden states and LoRA adapters
+    virtual std::shared_ptr<DenoisingRequest> create_denoising_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+        OPENVINO_THROW("Batched denoising is not supported by the pipeline");
+    }
+
+    // performs a single denoising step of several requests with a single denoising model inference
+    // note, requests must have the same current timestep, latent and hidden states shapes except batch dimension
+    virtual void denoise_step(const std::vector<std::shared_ptr<DenoisingRequest>>& requests) {
+        OPENVINO_THROW("Batched denoising is not supported by the pipeline");
+    }
+
+    // decoding of a final latent, which can be called from another thread concurrently with denoising of next requests
+    using LatentDecoder = std::function<ov::Tensor()>;
+
+    // returns decoding of final latent of a finished request, cancelled requests produce an empty tensor
+    virtual LatentDecoder finish_denoising_request(const DenoisingRequest& request) {
+        OPENVINO_THROW("Batched denoising is not supported by the pipeline");
+    }
+
+    // denoises a text to image request and returns decoding of its final latent, so DiffusionRequestQueue can
+    // decode it while the next request is denoised; pipelines which don't override it decode within 'generate'
+    virtual LatentDecoder generate_deferred(const std::string& positive_prompt, const ov::AnyMap& properties) {
+        ov::Tensor image = generate(positive_prompt, {}, {}, properties);
+        return [image] { return image; };
+    }
+
     virtual ~DiffusionPipeline() = default;
 
 protected:
@@ -99,6 +155,52 @@ protected:
 
     virtual void check_inputs(const ImageGenerationConfig& generation_config, ov::Tensor initial_image) const = 0;
 
+    // with VAE tiling, VAE is reshaped to a single tile which is the largest shape it's inferred with
+    void reshape_vae(AutoencoderKL& vae, const int num_images_per_prompt, const int height, const int width) const {
+        auto tiled = [this] (int size) {
+            const int tile_size = static_cast<int>(m_generation_config.vae_tile_size);
+            return m_generation_config.vae_tiling && size > 0 ? std::min(size, tile_size) : size;
+        };
+        vae.reshape(num_images_per_prompt, tiled(height), tiled(width));
+    }
+
+    ov::Tensor vae_decode(AutoencoderKL& vae, const ov::Tensor latent, const ImageGenerationConfig& generation_config) const {
+        if (generation_config.vae_tiling)
+            return vae.decode_tiled(latent, generation_config.vae_tile_size, generation_config.vae_tile_overlap);
+        return vae.decode(latent);
+    }
+
+    // decodes by VAE with its own infer requests, since 'vae' may be used to prepare the next request meanwhile
+    // note, an empty latent means a cancelled request
+    LatentDecoder deferred_vae_decode(const AutoencoderKL& vae, const ov::Tensor latent, const ImageGenerationConfig& generation_config) {
+        if (!latent) {
+            return [] { return ov::Tensor(ov::element::u8, {}); };
+        }
+
+        if (!m_deferred_vae) {
+            m_deferred_vae = std::make_shared<AutoencoderKL>(vae.clone());
+        }
+
+        // schedulers reuse latent buffers in the next denoising
+        ov::Tensor final_latent(latent.get_element_type(), latent.get_shape());
+        latent.copy_to(final_latent);
+
+        return [this, deferred_vae = m_deferred_vae, final_latent, generation_config] {
+            ov::Tensor image = vae_decode(*deferred_vae, final_latent, generation_config);
+
+            // VAE output is overwritten by the next decoding
+            ov::Tensor result(image.get_element_type(), image.get_shape());
+            image.copy_to(result);
+            return result;
+        };
+    }
+
+    ov::Tensor vae_encode(AutoencoderKL& vae, const ov::Tensor image, const ImageGenerationConfig& generation_config) const {
+        if (generation_config.vae_tiling)
+            return vae.encode_tiled(image, generation_config.generator, generation_config.vae_tile_size, generation_config.vae_tile_overlap);
+        return vae.encode(image, generation_config.generator);
+    }
+
     void blend_latents(ov::Tensor image_latent, ov::Tensor noise, ov::Tensor mask, ov::Tensor latent, size_t inference_step) {
         OPENVINO_ASSERT(m_pipeline_type == PipelineType::INPAINTING, "'prepare_mask_latents' can be called for inpainting pipeline only");
         OPENVINO_ASSERT(image_latent.get_shape() == latent.get_shape(), "Shapes for current", latent.get_shape(), "and initial image latents ", image_latent.get_shape(), " must match");
@@ -135,6 +237,8 @@ protected:
     PipelineType m_pipeline_type;
     std::shared_ptr<IScheduler> m_scheduler;
     ImageGenerationConfig m_generation_config;
+    // created by the first 'deferred_vae_decode' call
+    std::shared_ptr<AutoencoderKL> m_deferred_vae = nullptr;
 };
 
 } // namespace genai
@@ -0,0 +1,202 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/diffusion_request_queue.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+bool same_shape_except_batch(const ov::Tensor& lhs, const ov::Tensor& rhs) {
+    const ov::Shape lhs_shape = lhs.get_shape(), rhs_shape = rhs.get_shape();
+    return lhs.get_element_type() == rhs.get_element_type() && lhs_shape.size() == rhs_shape.size() &&
+        std::equal(lhs_shape.begin() + 1, lhs_shape.end(), rhs_shape.begin() + 1);
+}
+
+} // namespace
+
+DiffusionRequestQueue::DiffusionRequestQueue(std::shared_ptr<DiffusionPipeline> pipeline)
+    : m_pipeline(pipeline) {
+    OPENVINO_ASSERT(m_pipeline != nullptr, "Pipeline must be set to create request queue");
+}
+
+DiffusionRequestQueue::~DiffusionRequestQueue() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_one();
+
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+
+    // the worker doesn't add decoding requests anymore
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop_decoding = true;
+    }
+    m_decoding_cv.notify_one();
+
+    if (m_decoder.joinable()) {
+        m_decoder.join();
+    }
+}
+
+std::future<ov::Tensor> DiffusionRequestQueue::add_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    PendingRequest request{positive_prompt, properties, {}};
+    std::future<ov::Tensor> result = request.result.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(std::move(request));
+        if (!m_worker.joinable()) {
+            m_worker = std::thread(&DiffusionRequestQueue::run, this);
+            m_decoder = std::thread(&DiffusionRequestQueue::run_decoding, this);
+        }
+    }
+    m_cv.notify_one();
+
+    return result;
+}
+
+bool DiffusionRequestQueue::can_denoise_together(const DiffusionPipeline::DenoisingRequest& lhs, const DiffusionPipeline::DenoisingRequest& rhs) {
+    if (lhs.batch_size_multiplier != rhs.batch_size_multiplier ||
+        lhs.timesteps[lhs.inference_step] != rhs.timesteps[rhs.inference_step] ||
+        !same_shape_except_batch(lhs.latent, rhs.latent) ||
+        lhs.hidden_states.size() != rhs.hidden_states.size()) {
+        return false;
+    }
+
+    for (const auto& [name, hidden_state] : lhs.hidden_states) {
+        auto it = rhs.hidden_states.find(name);
+        if (it == rhs.hidden_states.end() || !same_shape_except_batch(hidden_state, it->second)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DiffusionRequestQueue::run() {
+    std::vector<RunningRequest> running;
+
+    while (true) {
+        std::deque<PendingRequest> pending;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // running requests are continued without waiting for new ones
+            m_cv.wait(lock, [&] { return m_stop || !m_pending.empty() || !running.empty(); });
+            if (m_pending.empty() && running.empty()) {
+                break;
+            }
+            pending.swap(m_pending);
+        }
+
+        admit(pending, running);
+        step(running);
+    }
+}
+
+void DiffusionRequestQueue::admit(std::deque<PendingRequest>& pending, std::vector<RunningRequest>& running) {
+    for (PendingRequest& request : pending) {
+        try {
+            if (!m_pipeline->is_batched_denoising_supported()) {
+                DiffusionPipeline::LatentDecoder decode = m_pipeline->generate_deferred(request.positive_prompt, request.properties);
+                add_decoding(std::move(decode), std::move(request.result));
+                continue;
+            }
+
+            running.push_back({m_pipeline->create_denoising_request(request.positive_prompt, request.properties), std::move(request.result)});
+        } catch (...) {
+            request.result.set_exception(std::current_exception());
+        }
+    }
+}
+
+void DiffusionRequestQueue::step(std::vector<RunningRequest>& running) {
+    std::vector<bool> scheduled(running.size(), false);
+
+    for (size_t i = 0; i < running.size(); ++i) {
+        if (scheduled[i] || running[i].state->is_finished()) {
+            continue;
+        }
+
+        std::vector<size_t> batch_indices;
+        std::vector<std::shared_ptr<DiffusionPipeline::DenoisingRequest>> batch;
+        for (size_t j = i; j < running.size(); ++j) {
+            if (!scheduled[j] && !running[j].state->is_finished() && can_denoise_together(*running[i].state, *running[j].state)) {
+                scheduled[j] = true;
+                batch_indices.push_back(j);
+                batch.push_back(running[j].state);
+            }
+        }
+
+        try {
+            m_pipeline->denoise_step(batch);
+        } catch (...) {
+            // all requests of the failed batch are finished with the error
+            for (size_t index : batch_indices) {
+                running[index].result.set_exception(std::current_exception());
+                running[index].state = nullptr;
+            }
+        }
+    }
+
+    // finished requests are passed to decoding and leave the batch, so next iteration can admit new ones
+    size_t num_running = 0;
+    for (RunningRequest& request : running) {
+        // a request of a failed batch already has the error set
+        if (request.state == nullptr) {
+            continue;
+        }
+        if (!request.state->is_finished()) {
+            if (&running[num_running] != &request) {
+                running[num_running] = std::move(request);
+            }
+            ++num_running;
+            continue;
+        }
+
+        try {
+            DiffusionPipeline::LatentDecoder decode = m_pipeline->finish_denoising_request(*request.state);
+            add_decoding(std::move(decode), std::move(request.result));
+        } catch (...) {
+            request.result.set_exception(std::current_exception());
+        }
+    }
+    running.resize(num_running);
+}
+
+void DiffusionRequestQueue::add_decoding(DiffusionPipeline::LatentDecoder decode, std::promise<ov::Tensor> result) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_decoding.push_back({std::move(decode), std::move(result)});
+    }
+    m_decoding_cv.notify_one();
+}
+
+void DiffusionRequestQueue::run_decoding() {
+    while (true) {
+        DecodingRequest request;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_decoding_cv.wait(lock, [&] { return m_stop_decoding || !m_decoding.empty(); });
+            if (m_decoding.empty()) {
+                break;
+            }
+            request = std::move(m_decoding.front());
+            m_decoding.pop_front();
+        }
+
+        try {
+            request.result.set_value(request.decode());
+        } catch (...) {
+            request.result.set_exception(std::current_exception());
+        }
+    }
+}
+
+} // namespace genai
+} // namespace ov
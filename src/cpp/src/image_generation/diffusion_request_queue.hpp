@@ -0,0 +1,86 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "image_generation/diffusion_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Queue of text to image requests processed by a background thread with iteration level batching.
+ * Each iteration new requests are admitted (text encoding and initial latent are computed), then running requests
+ * with the same timestep, image resolution and guidance mode are denoised by a single denoising model inference
+ * and finished requests are passed to a decoding thread. Requests with the same number of inference steps submitted
+ * together are denoised in the same batch during all steps.
+ * Pipelines which don't support batched denoising process requests one by one.
+ * VAE decoding runs with its own infer requests, so decoding of a finished request overlaps with text encoding and
+ * denoising of the next ones.
+ */
+class DiffusionRequestQueue {
+public:
+    explicit DiffusionRequestQueue(std::shared_ptr<DiffusionPipeline> pipeline);
+
+    // waits until all submitted requests are processed
+    ~DiffusionRequestQueue();
+
+    std::future<ov::Tensor> add_request(const std::string& positive_prompt, const ov::AnyMap& properties);
+
+    // whether two requests can be denoised by a single inference at the current step
+    static bool can_denoise_together(const DiffusionPipeline::DenoisingRequest& lhs, const DiffusionPipeline::DenoisingRequest& rhs);
+
+private:
+    struct PendingRequest {
+        std::string positive_prompt;
+        ov::AnyMap properties;
+        std::promise<ov::Tensor> result;
+    };
+
+    struct RunningRequest {
+        std::shared_ptr<DiffusionPipeline::DenoisingRequest> state;
+        std::promise<ov::Tensor> result;
+    };
+
+    struct DecodingRequest {
+        DiffusionPipeline::LatentDecoder decode;
+        std::promise<ov::Tensor> result;
+    };
+
+    void run();
+
+    void admit(std::deque<PendingRequest>& pending, std::vector<RunningRequest>& running);
+
+    void step(std::vector<RunningRequest>& running);
+
+    void add_decoding(DiffusionPipeline::LatentDecoder decode, std::promise<ov::Tensor> result);
+
+    void run_decoding();
+
+    std::shared_ptr<DiffusionPipeline> m_pipeline;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<PendingRequest> m_pending;
+    bool m_stop = false;
+    // started by the first request
+    std::thread m_worker;
+
+    std::condition_variable m_decoding_cv;
+    std::deque<DecodingRequest> m_decoding;
+    bool m_stop_decoding = false;
+    // started together with the worker
+    std::thread m_decoder;
+};
+
+} // namespace genai
+} // namespace ov
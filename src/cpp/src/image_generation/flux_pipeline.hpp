@@ -243,7 +243,7 @@ public:
         m_t5_text_encoder->reshape(1, m_generation_config.max_sequence_length);
         m_transformer->reshape(num_images_per_prompt, height, width, m_generation_config.max_sequence_length);
 
-        m_vae->reshape(num_images_per_prompt, height, width);
+        reshape_vae(*m_vae, num_images_per_prompt, height, width);
     }
 
     void compile(const std::string& device, const ov::AnyMap& properties) override {
@@ -319,6 +319,29 @@ public:
                         ov::Tensor initial_image,
                         ov::Tensor mask_image,
                         const ov::AnyMap& properties) override {
+        ov::Tensor latents = denoise(positive_prompt, initial_image, properties);
+        if (!latents) {
+            return ov::Tensor(ov::element::u8, {});
+        }
+        return vae_decode(*m_vae, latents, m_custom_generation_config);
+    }
+
+    LatentDecoder generate_deferred(const std::string& positive_prompt, const ov::AnyMap& properties) override {
+        ov::Tensor latents = denoise(positive_prompt, {}, properties);
+        return deferred_vae_decode(*m_vae, latents, m_custom_generation_config);
+    }
+
+    ov::Tensor decode(const ov::Tensor latent) override {
+        ov::Tensor unpacked_latent = unpack_latents(latent,
+                                                m_custom_generation_config.height,
+                                                m_custom_generation_config.width,
+                                                m_vae->get_vae_scale_factor());
+        return vae_decode(*m_vae, unpacked_latent, m_custom_generation_config);
+    }
+
+private:
+    // runs denoising loop and returns unpacked final latents to decode, an empty tensor if generation is cancelled by callback
+    ov::Tensor denoise(const std::string& positive_prompt, ov::Tensor initial_image, const ov::AnyMap& properties) {
         m_custom_generation_config = m_generation_config;
         m_custom_generation_config.update_generation_config(properties);
 
@@ -366,23 +389,13 @@ public:
             latents = scheduler_step_result["latent"];
 
             if (callback && callback(inference_step, timesteps.size(), latents)) {
-                return ov::Tensor(ov::element::u8, {});
+                return ov::Tensor();
             }
         }
 
-        latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
-        return m_vae->decode(latents);
-    }
-
-    ov::Tensor decode(const ov::Tensor latent) override {
-        ov::Tensor unpacked_latent = unpack_latents(latent,
-                                                m_custom_generation_config.height,
-                                                m_custom_generation_config.width,
-                                                m_vae->get_vae_scale_factor());
-        return m_vae->decode(unpacked_latent);
+        return unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
     }
 
-private:
     bool is_inpainting_model() const {
         assert(m_transformer != nullptr);
         assert(m_vae != nullptr);
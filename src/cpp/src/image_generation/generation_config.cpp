@@ -3,9 +3,14 @@
 
 #include "openvino/genai/image_generation/generation_config.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <ctime>
 #include <cstdlib>
 
+#include "openvino/core/parallel.hpp"
+
+#include "image_generation/philox.hpp"
 #include "utils.hpp"
 
 namespace ov {
@@ -38,6 +43,86 @@ void CppStdGenerator::seed(size_t new_seed) {
     m_gen.seed(new_seed);
 }
 
+namespace {
+
+// converts 4 random integers to 4 normally distributed values using Box-Muller transform
+void box_muller(const philox::Counter& random, float* normal) {
+    constexpr float two_pi = 6.283185307179586f;
+    // 24 bits of mantissa, where the first value is in (0, 1] to compute a logarithm
+    constexpr float scale = 1.0f / (1u << 24);
+
+    for (size_t i = 0; i < 4; i += 2) {
+        const float u1 = ((random[i] >> 8) + 1) * scale;
+        const float u2 = (random[i + 1] >> 8) * scale;
+
+        const float radius = std::sqrt(-2.0f * std::log(u1));
+        normal[i] = radius * std::cos(two_pi * u2);
+        normal[i + 1] = radius * std::sin(two_pi * u2);
+    }
+}
+
+} // namespace
+
+PhiloxGenerator::PhiloxGenerator(uint64_t seed)
+    : m_seed(seed) {
+}
+
+float PhiloxGenerator::next() {
+    if (m_cache_pos == m_cache.size()) {
+        box_muller(philox::philox4x32_10(philox::make_counter(m_offset++), philox::make_key(m_seed)), m_cache.data());
+        m_cache_pos = 0;
+    }
+    return m_cache[m_cache_pos++];
+}
+
+ov::Tensor PhiloxGenerator::randn_tensor(const ov::Shape& shape) {
+    ov::Tensor rand_tensor(ov::element::f32, shape);
+    float * rand_tensor_data = rand_tensor.data<float>();
+
+    // values left from the last used counter come first, so the stream doesn't depend on how it's split between calls
+    const size_t num_cached = std::min(rand_tensor.get_size(), m_cache.size() - m_cache_pos);
+    std::copy_n(m_cache.data() + m_cache_pos, num_cached, rand_tensor_data);
+    m_cache_pos += num_cached;
+
+    float * data = rand_tensor_data + num_cached;
+    const size_t size = rand_tensor.get_size() - num_cached, num_counters = (size + 3) / 4;
+    const philox::Key key = philox::make_key(m_seed);
+    const uint64_t offset = m_offset;
+
+    // every value depends only on its index, so work split between threads doesn't affect the result
+    constexpr size_t block_size = 1024;
+    ov::parallel_for((num_counters + block_size - 1) / block_size, [&](size_t block) {
+        const size_t begin = block * block_size, end = std::min(begin + block_size, num_counters);
+
+        // Philox rounds of a block run in a separate loop before Box-Muller transform, which is scalar
+        std::array<philox::Counter, block_size> random;
+        for (size_t i = begin; i < end; ++i) {
+            random[i - begin] = philox::philox4x32_10(philox::make_counter(offset + i), key);
+        }
+
+        for (size_t i = begin; i < end; ++i) {
+            float normal[4];
+            box_muller(random[i - begin], normal);
+            std::copy_n(normal, std::min<size_t>(4, size - i * 4), data + i * 4);
+        }
+    });
+
+    m_offset += num_counters;
+    // values of the last counter, which didn't fit into the tensor, are returned by subsequent 'next()' or 'randn_tensor()' calls
+    if (size % 4 != 0) {
+        box_muller(philox::philox4x32_10(philox::make_counter(m_offset - 1), key), m_cache.data());
+        m_cache_pos = size % 4;
+    }
+
+    return rand_tensor;
+}
+
+void PhiloxGenerator::seed(size_t new_seed) {
+    m_seed = new_seed;
+    m_offset = 0;
+    m_cache_pos = m_cache.size();
+}
+
 //
 // GenerationConfig
 //
@@ -66,6 +151,11 @@ void ImageGenerationConfig::update_generation_config(const ov::AnyMap& propertie
     read_anymap_param(properties, "strength", strength);
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "max_sequence_length", max_sequence_length);
+    read_anymap_param(properties, "vae_tiling", vae_tiling);
+    read_anymap_param(properties, "vae_tile_size", vae_tile_size);
+    read_anymap_param(properties, "vae_tile_overlap", vae_tile_overlap);
+    read_anymap_param(properties, "unet_cache_interval", unet_cache_interval);
+    read_anymap_param(properties, "guidance_end", guidance_end);
 
     // 'generator' has higher priority than 'seed' parameter
     const bool have_generator_param = properties.find(ov::genai::generator.name()) != properties.end();
@@ -93,6 +183,9 @@ void ImageGenerationConfig::validate() const {
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_2 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 2");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_3 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 3");
+    OPENVINO_ASSERT(!vae_tiling || vae_tile_overlap < vae_tile_size / 2, "VAE tile overlap must be less than half of tile size");
+    OPENVINO_ASSERT(unet_cache_interval > 0, "UNet cache interval must be greater than 0");
+    OPENVINO_ASSERT(guidance_end >= 0.0f && guidance_end <= 1.0f, "Guidance end must be within [0, 1] range");
 }
 
 }  // namespace genai
@@ -3,10 +3,15 @@
 
 #include "openvino/genai/image_generation/autoencoder_kl.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <memory>
+#include <optional>
+#include <type_traits>
 
 #include "openvino/runtime/core.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/op/clamp.hpp"
 #include "openvino/op/add.hpp"
@@ -19,6 +24,233 @@
 #include "json_utils.hpp"
 #include "lora_helper.hpp"
 
+namespace {
+
+// Starts of tiles covering [0, length). The last tile is shifted to end exactly at `length`, so all tiles have the same size.
+std::vector<size_t> get_tile_starts(size_t length, size_t tile, size_t overlap) {
+    if (length <= tile)
+        return {0};
+
+    std::vector<size_t> starts;
+    for (size_t start = 0; start + tile < length; start += tile - overlap)
+        starts.push_back(start);
+    starts.push_back(length - tile);
+    return starts;
+}
+
+// Linear weights ramping up over `overlap` elements at the sides shared with neighboring tiles
+std::vector<float> get_blend_weights(size_t size, size_t overlap, bool has_previous, bool has_next) {
+    std::vector<float> weights(size, 1.0f);
+    for (size_t i = 0; i < size; ++i) {
+        if (has_previous)
+            weights[i] = std::min(weights[i], static_cast<float>(i + 1) / (overlap + 1));
+        if (has_next)
+            weights[i] = std::min(weights[i], static_cast<float>(size - i) / (overlap + 1));
+    }
+    return weights;
+}
+
+// Tile in latent space coordinates
+struct Tile {
+    size_t y, x;
+    bool top, bottom, left, right;
+};
+
+class TileGrid {
+public:
+    TileGrid(size_t height, size_t width, size_t tile, size_t overlap)
+        : m_tile_height(std::min(height, tile)),
+          m_tile_width(std::min(width, tile)) {
+        std::vector<size_t> ys = get_tile_starts(height, tile, overlap), xs = get_tile_starts(width, tile, overlap);
+        for (size_t i = 0; i < ys.size(); ++i) {
+            for (size_t j = 0; j < xs.size(); ++j) {
+                m_tiles.push_back({ys[i], xs[j], i == 0, i + 1 == ys.size(), j == 0, j + 1 == xs.size()});
+            }
+        }
+    }
+
+    const std::vector<Tile>& tiles() const {
+        return m_tiles;
+    }
+
+    size_t tile_height() const {
+        return m_tile_height;
+    }
+
+    size_t tile_width() const {
+        return m_tile_width;
+    }
+
+private:
+    size_t m_tile_height, m_tile_width;
+    std::vector<Tile> m_tiles;
+};
+
+// Copies [y, y + height) x [x, x + width) spatial crop of f32 NCHW tensor
+ov::Tensor crop_nchw(const ov::Tensor& tensor, size_t y, size_t x, size_t height, size_t width) {
+    const ov::Shape shape = tensor.get_shape();
+    const size_t planes = shape[0] * shape[1], src_height = shape[2], src_width = shape[3];
+
+    ov::Tensor crop(ov::element::f32, {shape[0], shape[1], height, width});
+    const float * src_data = tensor.data<const float>();
+    float * crop_data = crop.data<float>();
+
+    for (size_t plane = 0; plane < planes; ++plane) {
+        for (size_t row = 0; row < height; ++row) {
+            const float * src_row = src_data + (plane * src_height + y + row) * src_width + x;
+            std::copy_n(src_row, width, crop_data + (plane * height + row) * width);
+        }
+    }
+
+    return crop;
+}
+
+// Accumulates weighted tiles of NCHW or NHWC output and normalizes by the sum of weights
+class TileBlender {
+public:
+    TileBlender(const ov::Shape& shape, bool channels_last, size_t overlap)
+        : m_shape(shape),
+          m_channels_last(channels_last),
+          m_overlap(overlap),
+          m_sum(ov::shape_size(shape), 0.0f),
+          m_weights(height() * width(), 0.0f) { }
+
+    void add(const ov::Tensor& tile_tensor, const Tile& tile, size_t scale) {
+        if (tile_tensor.get_element_type() == ov::element::u8)
+            add(tile_tensor.data<const uint8_t>(), tile_tensor.get_shape(), tile, scale);
+        else
+            add(tile_tensor.data<const float>(), tile_tensor.get_shape(), tile, scale);
+    }
+
+    ov::Tensor result(ov::element::Type element_type) const {
+        ov::Tensor output(element_type, m_shape);
+        if (element_type == ov::element::u8)
+            blend(output.data<uint8_t>());
+        else
+            blend(output.data<float>());
+        return output;
+    }
+
+private:
+    template <typename T>
+    void add(const T* tile_data, const ov::Shape& tile_shape, const Tile& tile, size_t scale) {
+        const size_t batch = m_shape[0], channels = this->channels();
+        const size_t tile_height = m_channels_last ? tile_shape[1] : tile_shape[2];
+        const size_t tile_width = m_channels_last ? tile_shape[2] : tile_shape[3];
+        const size_t y0 = tile.y * scale, x0 = tile.x * scale;
+
+        std::vector<float> row_weights = get_blend_weights(tile_height, m_overlap, !tile.top, !tile.bottom);
+        std::vector<float> column_weights = get_blend_weights(tile_width, m_overlap, !tile.left, !tile.right);
+
+        // rows of a tile cover different pixels, so they are accumulated in parallel
+        ov::parallel_for(tile_height, [&](size_t row) {
+            for (size_t column = 0; column < tile_width; ++column) {
+                const float weight = row_weights[row] * column_weights[column];
+                const size_t pixel = (y0 + row) * width() + x0 + column;
+                m_weights[pixel] += weight;
+
+                for (size_t b = 0; b < batch; ++b) {
+                    for (size_t c = 0; c < channels; ++c) {
+                        const size_t tile_index = m_channels_last ?
+                            ((b * tile_height + row) * tile_width + column) * channels + c :
+                            ((b * channels + c) * tile_height + row) * tile_width + column;
+                        m_sum[index(b, c, pixel)] += weight * static_cast<float>(tile_data[tile_index]);
+                    }
+                }
+            }
+        });
+    }
+
+    template <typename T>
+    void blend(T* output_data) const {
+        const size_t batch = m_shape[0], channels = this->channels(), width = this->width();
+
+        ov::parallel_for(height(), [&](size_t row) {
+            for (size_t pixel = row * width; pixel < (row + 1) * width; ++pixel) {
+                for (size_t b = 0; b < batch; ++b) {
+                    for (size_t c = 0; c < channels; ++c) {
+                        const size_t i = index(b, c, pixel);
+                        const float blended = m_sum[i] / m_weights[pixel];
+                        if constexpr (std::is_same_v<T, uint8_t>)
+                            output_data[i] = static_cast<uint8_t>(std::clamp(std::round(blended), 0.0f, 255.0f));
+                        else
+                            output_data[i] = blended;
+                    }
+                }
+            }
+        });
+    }
+
+    size_t height() const {
+        return m_channels_last ? m_shape[1] : m_shape[2];
+    }
+
+    size_t width() const {
+        return m_channels_last ? m_shape[2] : m_shape[3];
+    }
+
+    size_t channels() const {
+        return m_channels_last ? m_shape[3] : m_shape[1];
+    }
+
+    size_t index(size_t b, size_t c, size_t pixel) const {
+        const size_t plane = height() * width();
+        return m_channels_last ? (b * plane + pixel) * channels() + c : (b * channels() + c) * plane + pixel;
+    }
+
+    ov::Shape m_shape;
+    bool m_channels_last;
+    size_t m_overlap;
+    std::vector<float> m_sum, m_weights;
+};
+
+// Returns up to optimal number of infer requests of the compiled model, the first one is `request` itself
+std::vector<ov::InferRequest> get_tile_requests(ov::InferRequest& request, std::vector<ov::InferRequest>& tile_requests, size_t num_tiles) {
+    if (tile_requests.empty()) {
+        ov::CompiledModel compiled_model = request.get_compiled_model();
+        const size_t num_requests = std::max<uint32_t>(1u, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+
+        tile_requests.push_back(request);
+        while (tile_requests.size() < num_requests)
+            tile_requests.push_back(compiled_model.create_infer_request());
+    }
+
+    // use only as many requests as there are tiles, memory consumption grows with each running request
+    const size_t num_used = std::min(tile_requests.size(), std::max<size_t>(num_tiles, 1));
+    return {tile_requests.begin(), tile_requests.begin() + num_used};
+}
+
+// Runs tiles round robin on `requests` and passes outputs of finished ones to `on_output`.
+// `input_scale` converts latent coordinates of tiles to coordinates of `input`.
+template <typename OnOutput>
+void infer_tiles(std::vector<ov::InferRequest>& requests, const ov::Tensor& input, const TileGrid& grid, size_t input_scale, OnOutput on_output) {
+    const auto& tiles = grid.tiles();
+    const size_t num_requests = requests.size();
+
+    for (size_t i = 0; i < tiles.size() + num_requests; ++i) {
+        ov::InferRequest& request = requests[i % num_requests];
+
+        if (i >= num_requests) {
+            request.wait();
+            on_output(request.get_output_tensor(), tiles[i - num_requests]);
+        }
+
+        if (i < tiles.size()) {
+            request.set_input_tensor(crop_nchw(input, tiles[i].y * input_scale, tiles[i].x * input_scale,
+                grid.tile_height() * input_scale, grid.tile_width() * input_scale));
+            request.start_async();
+        }
+    }
+}
+
+void check_tiling(size_t tile_size, size_t tile_overlap, size_t vae_scale_factor) {
+    OPENVINO_ASSERT(tile_size % vae_scale_factor == 0 && tile_overlap % vae_scale_factor == 0,
+        "VAE tile size and overlap must be divisible by ", vae_scale_factor);
+    OPENVINO_ASSERT(tile_overlap < tile_size / 2, "VAE tile overlap must be less than half of tile size");
+}
+
+} // namespace
+
 namespace ov {
 namespace genai {
 
@@ -181,6 +413,24 @@ AutoencoderKL::AutoencoderKL(const std::string& vae_encoder_model,
 
 AutoencoderKL::AutoencoderKL(const AutoencoderKL&) = default;
 
+AutoencoderKL AutoencoderKL::clone() const {
+    OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot clone non-compiled model");
+
+    AutoencoderKL cloned(*this);
+    ov::InferRequest decoder_request = m_decoder_request;
+    cloned.m_decoder_request = decoder_request.get_compiled_model().create_infer_request();
+    if (m_encoder_request) {
+        ov::InferRequest encoder_request = m_encoder_request;
+        cloned.m_encoder_request = encoder_request.get_compiled_model().create_infer_request();
+    }
+
+    // tile requests are created on the first tiled call
+    cloned.m_encoder_tile_requests.clear();
+    cloned.m_decoder_tile_requests.clear();
+
+    return cloned;
+}
+
 AutoencoderKL& AutoencoderKL::reshape(int batch_size, int height, int width) {
     OPENVINO_ASSERT(m_decoder_model, "Model has been already compiled. Cannot reshape already compiled model");
 
@@ -235,13 +485,63 @@ ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
     return m_decoder_request.get_output_tensor();
 }
 
+ov::Tensor AutoencoderKL::decode_tiled(ov::Tensor latent, size_t tile_size, size_t tile_overlap) {
+    OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
+
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    check_tiling(tile_size, tile_overlap, vae_scale_factor);
+
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t height = latent_shape[2], width = latent_shape[3];
+    TileGrid grid(height, width, tile_size / vae_scale_factor, tile_overlap / vae_scale_factor);
+    if (grid.tiles().size() == 1)
+        return decode(latent);
+
+    // decoder output is u8 NHWC image
+    TileBlender blender({latent_shape[0], height * vae_scale_factor, width * vae_scale_factor, m_config.out_channels}, true, tile_overlap);
+    auto requests = get_tile_requests(m_decoder_request, m_decoder_tile_requests, grid.tiles().size());
+    infer_tiles(requests, latent, grid, 1, [&](const ov::Tensor& output, const Tile& tile) {
+        blender.add(output, tile, vae_scale_factor);
+    });
+
+    return blender.result(ov::element::u8);
+}
+
 ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator) {
     OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
 
     m_encoder_request.set_input_tensor(image);
     m_encoder_request.infer();
 
-    ov::Tensor output = m_encoder_request.get_output_tensor(), latent;
+    return postprocess_encoder_output(m_encoder_request.get_output_tensor(), generator);
+}
+
+ov::Tensor AutoencoderKL::encode_tiled(ov::Tensor image, std::shared_ptr<Generator> generator, size_t tile_size, size_t tile_overlap) {
+    OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
+
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    check_tiling(tile_size, tile_overlap, vae_scale_factor);
+
+    const ov::Shape image_shape = image.get_shape();
+    const size_t height = image_shape[2] / vae_scale_factor, width = image_shape[3] / vae_scale_factor;
+    TileGrid grid(height, width, tile_size / vae_scale_factor, tile_overlap / vae_scale_factor);
+    if (grid.tiles().size() == 1)
+        return encode(image, generator);
+
+    // encoder output is f32 NCHW latent or latent distribution parameters, number of channels is known from the first tile
+    std::optional<TileBlender> blender;
+    auto requests = get_tile_requests(m_encoder_request, m_encoder_tile_requests, grid.tiles().size());
+    infer_tiles(requests, image, grid, vae_scale_factor, [&](const ov::Tensor& output, const Tile& tile) {
+        if (!blender)
+            blender.emplace(ov::Shape{image_shape[0], output.get_shape()[1], height, width}, false, tile_overlap / vae_scale_factor);
+        blender->add(output, tile, 1);
+    });
+
+    return postprocess_encoder_output(blender->result(ov::element::f32), generator);
+}
+
+ov::Tensor AutoencoderKL::postprocess_encoder_output(ov::Tensor output, std::shared_ptr<Generator> generator) {
+    ov::Tensor latent;
 
     ov::CompiledModel compiled_model = m_encoder_request.get_compiled_model();
     auto outputs = compiled_model.outputs();
@@ -5,6 +5,8 @@
 
 #include <fstream>
 
+#include "openvino/genai/image_generation/prompt_embedding_cache.hpp"
+
 #include "lora_helper.hpp"
 #include "json_utils.hpp"
 #include "utils.hpp"
@@ -90,6 +92,7 @@ CLIPTextModelWithProjection& CLIPTextModelWithProjection::compile(const std::str
     }
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Clip Text with projection model");
     m_request = compiled_model.create_infer_request();
+    m_cache_encoder_id = PromptEmbeddingCache::instance().create_encoder_id();
     // release the original model
     m_model.reset();
 
@@ -105,6 +108,19 @@ void CLIPTextModelWithProjection::set_adapters(const std::optional<AdapterConfig
 ov::Tensor CLIPTextModelWithProjection::infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance) {
     OPENVINO_ASSERT(m_request, "CLIP text encoder model must be compiled first. Cannot infer non-compiled model");
 
+    // negative prompt is ignored without classifier free guidance
+    PromptEmbeddingCache::Key cache_key{m_cache_encoder_id, pos_prompt, do_classifier_free_guidance ? neg_prompt : std::string{},
+                                        do_classifier_free_guidance};
+    // LoRA adapters may change between calls, outputs of such encoders are not cached
+    const bool use_cache = !m_adapter_controller;
+    if (use_cache) {
+        if (auto cached_outputs = PromptEmbeddingCache::instance().find(cache_key)) {
+            m_cached_outputs = std::move(*cached_outputs);
+            return m_cached_outputs[0];
+        }
+    }
+    m_cached_outputs.clear();
+
     const int32_t pad_token_id = m_clip_tokenizer.get_pad_token_id();
     const size_t text_embedding_batch_size = do_classifier_free_guidance ? 2 : 1;
 
@@ -141,10 +157,22 @@ ov::Tensor CLIPTextModelWithProjection::infer(const std::string& pos_prompt, con
     // text embeddings
     m_request.infer();
 
+    if (use_cache) {
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = 0; idx < m_request.get_compiled_model().outputs().size(); ++idx) {
+            outputs.push_back(m_request.get_output_tensor(idx));
+        }
+        PromptEmbeddingCache::instance().insert(cache_key, outputs);
+    }
+
     return m_request.get_output_tensor(0);
 }
 
 ov::Tensor CLIPTextModelWithProjection::get_output_tensor(const size_t idx) {
+    if (!m_cached_outputs.empty()) {
+        OPENVINO_ASSERT(idx < m_cached_outputs.size(), "Output index ", idx, " is out of range");
+        return m_cached_outputs[idx];
+    }
     return m_request.get_output_tensor(idx);
 }
 
@@ -5,6 +5,8 @@
 
 #include <fstream>
 
+#include "openvino/genai/image_generation/prompt_embedding_cache.hpp"
+
 #include "json_utils.hpp"
 #include "lora_helper.hpp"
 #include "utils.hpp"
@@ -65,6 +67,7 @@ T5EncoderModel& T5EncoderModel::compile(const std::string& device, const ov::Any
     compiled_model = core.compile_model(m_model, device, properties);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "T5 encoder model");
     m_request = compiled_model.create_infer_request();
+    m_cache_encoder_id = PromptEmbeddingCache::instance().create_encoder_id();
     // release the original model
     m_model.reset();
 
@@ -74,6 +77,19 @@ T5EncoderModel& T5EncoderModel::compile(const std::string& device, const ov::Any
 ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance, int max_sequence_length) {
     OPENVINO_ASSERT(m_request, "T5 encoder model must be compiled first. Cannot infer non-compiled model");
 
+    // negative prompt is ignored without classifier free guidance
+    PromptEmbeddingCache::Key cache_key{m_cache_encoder_id, pos_prompt, do_classifier_free_guidance ? neg_prompt : std::string{},
+                                        do_classifier_free_guidance, max_sequence_length};
+    // LoRA adapters may change between calls, outputs of such encoders are not cached
+    const bool use_cache = !m_adapter_controller;
+    if (use_cache) {
+        if (auto cached_outputs = PromptEmbeddingCache::instance().find(cache_key)) {
+            m_cached_outputs = std::move(*cached_outputs);
+            return m_cached_outputs[0];
+        }
+    }
+    m_cached_outputs.clear();
+
     const int32_t pad_token_id = m_tokenizer.get_pad_token_id();
 
     auto perform_tokenization = [&](const std::string& prompt, ov::Tensor input_ids) {
@@ -121,10 +137,22 @@ ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::strin
     // text embeddings
     m_request.infer();
 
+    if (use_cache) {
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = 0; idx < m_request.get_compiled_model().outputs().size(); ++idx) {
+            outputs.push_back(m_request.get_output_tensor(idx));
+        }
+        PromptEmbeddingCache::instance().insert(cache_key, outputs);
+    }
+
     return m_request.get_output_tensor(0);
 }
 
 ov::Tensor T5EncoderModel::get_output_tensor(const size_t idx) {
+    if (!m_cached_outputs.empty()) {
+        OPENVINO_ASSERT(idx < m_cached_outputs.size(), "Output index ", idx, " is out of range");
+        return m_cached_outputs[idx];
+    }
     return m_request.get_output_tensor(idx);
 }
 
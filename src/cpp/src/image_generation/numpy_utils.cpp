@@ -1,5 +1,6 @@
 #include "image_generation/numpy_utils.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 
 namespace ov {
 namespace genai {
@@ -75,6 +76,11 @@ std::vector<float> interp(const std::vector<std::int64_t>& x, const std::vector<
 }
 
 ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis) {
+    ov::Tensor buffer;
+    return concat(tensor_1, tensor_2, axis, buffer);
+}
+
+ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis, ov::Tensor& buffer) {
     ov::Shape shape_1 = tensor_1.get_shape(), shape_2 = tensor_2.get_shape();
     size_t rank = shape_1.size();
 
@@ -103,7 +109,7 @@ ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis) {
         chunk_2 *= shape_2[d];
     }
 
-    ov::Tensor dst_tensor(tensor_1.get_element_type(), dst_shape);
+    ov::Tensor dst_tensor = reuse_buffer(buffer, tensor_1.get_element_type(), dst_shape);
     float * res = dst_tensor.data<float>();
 
     const float * data_1 = tensor_1.data<const float>();
@@ -135,6 +141,55 @@ void batch_copy(ov::Tensor src, ov::Tensor dst, size_t src_batch, size_t dst_bat
     ov::Tensor(src, src_start, src_end).copy_to(ov::Tensor(dst, dst_start, dst_end));
 }
 
+void channel_copy(ov::Tensor src, ov::Tensor dst, size_t dst_channel) {
+    const ov::Shape src_shape = src.get_shape(), dst_shape = dst.get_shape();
+    OPENVINO_ASSERT(src_shape.size() == 4 && dst_shape.size() == 4 && (src_shape[0] == dst_shape[0] || src_shape[0] == 1) &&
+                    src_shape[2] == dst_shape[2] && src_shape[3] == dst_shape[3] && dst_channel + src_shape[1] <= dst_shape[1],
+                    "Cannot copy channels of tensor with shape ", src_shape, " to tensor with shape ", dst_shape);
+
+    const size_t element_size = src.get_element_type().size();
+    const size_t src_chunk = ov::shape_size(src_shape) / src_shape[0] * element_size;
+    const size_t dst_chunk = ov::shape_size(dst_shape) / dst_shape[0] * element_size;
+    const size_t dst_offset = dst_channel * dst_shape[2] * dst_shape[3] * element_size;
+
+    const uint8_t* src_data = static_cast<const uint8_t*>(src.data());
+    uint8_t* dst_data = static_cast<uint8_t*>(dst.data());
+    const size_t src_batch_stride = src_shape[0] == 1 ? 0 : src_chunk;
+    for (size_t b = 0; b < dst_shape[0]; ++b) {
+        std::memcpy(dst_data + b * dst_chunk + dst_offset, src_data + b * src_batch_stride, src_chunk);
+    }
+}
+
+ov::Tensor reuse_buffer(ov::Tensor& buffer, const ov::element::Type& type, const ov::Shape& shape) {
+    if (!buffer || buffer.get_element_type() != type || buffer.get_shape() != shape) {
+        buffer = ov::Tensor(type, shape);
+    }
+    return buffer;
+}
+
+void parallel_for_range(size_t size, const std::function<void(size_t, size_t)>& body) {
+    constexpr size_t min_chunk_size = 16 * 1024;
+    const size_t max_chunks = static_cast<size_t>(std::max(ov::parallel_get_max_threads(), 1));
+    const size_t num_chunks = std::max<size_t>(std::min(max_chunks, size / min_chunk_size), 1);
+
+    if (num_chunks == 1) {
+        body(0, size);
+        return;
+    }
+
+    ov::parallel_for(num_chunks, [&](size_t chunk) {
+        body(size * chunk / num_chunks, size * (chunk + 1) / num_chunks);
+    });
+}
+
+void apply_guidance(const float* noise_pred_uncond, const float* noise_pred_text, float guidance_scale, float* noisy_residual, size_t size) {
+    parallel_for_range(size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            noisy_residual[i] = noise_pred_uncond[i] + guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
+        }
+    });
+}
+
 ov::Tensor repeat(const ov::Tensor input, const size_t n_times) {
     if (n_times == 1)
         return input;
@@ -149,6 +204,36 @@ ov::Tensor repeat(const ov::Tensor input, const size_t n_times) {
     return tensor_repeated;
 }
 
+ov::Tensor repeat_interleave(const ov::Tensor input, size_t n_times, ov::Tensor& buffer) {
+    if (n_times == 1)
+        return input;
+
+    ov::Shape repeated_shape = input.get_shape();
+    const size_t batch_size = repeated_shape[0];
+    repeated_shape[0] *= n_times;
+
+    ov::Tensor tensor_repeated = reuse_buffer(buffer, input.get_element_type(), repeated_shape);
+    const size_t chunk = input.get_byte_size() / batch_size;
+    const uint8_t* src_data = static_cast<const uint8_t*>(input.data());
+    uint8_t* dst_data = static_cast<uint8_t*>(tensor_repeated.data());
+
+    for (size_t b = 0; b < batch_size; ++b) {
+        for (size_t n = 0; n < n_times; ++n, dst_data += chunk) {
+            std::memcpy(dst_data, src_data + b * chunk, chunk);
+        }
+    }
+    return tensor_repeated;
+}
+
+ov::Tensor batch_view(const ov::Tensor& tensor, size_t batch, size_t batch_size) {
+    ov::Shape shape = tensor.get_shape();
+    OPENVINO_ASSERT(batch + batch_size <= shape[0], "Batch range [", batch, ", ", batch + batch_size, ") exceeds tensor shape ", shape);
+
+    const size_t chunk = tensor.get_byte_size() / shape[0];
+    shape[0] = batch_size;
+    return ov::Tensor(tensor.get_element_type(), shape, static_cast<uint8_t*>(tensor.data()) + batch * chunk);
+}
+
 
 } // namespace ov
 } // namespace genai
@@ -10,6 +10,7 @@
 #include <numeric>
 #include <algorithm>
 #include <cmath>
+#include <functional>
 
 #include "openvino/core/shape.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -48,10 +49,34 @@ std::vector<float> interp(const std::vector<std::int64_t>& x, const std::vector<
 
 // concats two tensors by a given dimension
 ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis);
+// the same, but result is written to 'buffer', which is reallocated only if result shape changes, see 'reuse_buffer'
+ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis, ov::Tensor& buffer);
 
 void batch_copy(ov::Tensor src, ov::Tensor dst, size_t src_batch, size_t dst_batch, size_t batch_size = 1);
 ov::Tensor repeat(const ov::Tensor input, const size_t num_images_per_prompt);
 
+// repeats each batch element 'n_times' in a row, e.g. [uncond, cond] -> [uncond, .., uncond, cond, .., cond],
+// result is written to 'buffer', see 'reuse_buffer'; 'input' is returned as is if 'n_times' is 1
+ov::Tensor repeat_interleave(const ov::Tensor input, size_t n_times, ov::Tensor& buffer);
+
+// returns a view of 'batch_size' batch elements starting from 'batch', which shares memory with 'tensor'
+ov::Tensor batch_view(const ov::Tensor& tensor, size_t batch, size_t batch_size);
+
+// copies 'src' [B, C_src, H, W] to channels [dst_channel, dst_channel + C_src) of 'dst' [B, C_dst, H, W]
+// 'src' with batch 1 is broadcasted to all batch elements of 'dst'
+void channel_copy(ov::Tensor src, ov::Tensor dst, size_t dst_channel);
+
+// returns 'buffer' if it has a given type and shape, otherwise allocates a new tensor and stores it to 'buffer'
+// used to reuse tensors between denoising steps instead of allocating them every step
+ov::Tensor reuse_buffer(ov::Tensor& buffer, const ov::element::Type& type, const ov::Shape& shape);
+
+// calls 'body(begin, end)' for chunks of [0, size) range in parallel, small ranges are processed by a calling thread
+// 'body' is expected to be a plain elementwise loop, which is vectorized by a compiler
+void parallel_for_range(size_t size, const std::function<void(size_t, size_t)>& body);
+
+// classifier free guidance: noisy_residual = noise_pred_uncond + guidance_scale * (noise_pred_text - noise_pred_uncond)
+void apply_guidance(const float* noise_pred_uncond, const float* noise_pred_text, float guidance_scale, float* noisy_residual, size_t size);
+
 } // namespace ov
 } // namespace genai
 } // namespace numpy_utils
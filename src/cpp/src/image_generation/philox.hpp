@@ -0,0 +1,49 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace genai {
+namespace philox {
+
+using Counter = std::array<uint32_t, 4>;
+using Key = std::array<uint32_t, 2>;
+
+// Philox4x32-10 counter-based random generator, see "Parallel Random Numbers: As Easy as 1, 2, 3" by Salmon et al.
+// Each counter value is mapped to 4 independent random values, so any part of a random stream can be computed separately
+inline Counter philox4x32_10(Counter counter, Key key) {
+    constexpr uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    constexpr uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+    for (size_t round = 0; round < 10; ++round) {
+        const uint64_t product_0 = static_cast<uint64_t>(M0) * counter[0];
+        const uint64_t product_1 = static_cast<uint64_t>(M1) * counter[2];
+
+        counter = {static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0],
+                   static_cast<uint32_t>(product_1),
+                   static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1],
+                   static_cast<uint32_t>(product_0)};
+
+        key[0] += W0;
+        key[1] += W1;
+    }
+
+    return counter;
+}
+
+inline Key make_key(uint64_t seed) {
+    return {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+}
+
+inline Counter make_counter(uint64_t offset) {
+    return {static_cast<uint32_t>(offset), static_cast<uint32_t>(offset >> 32), 0, 0};
+}
+
+} // namespace philox
+} // namespace genai
+} // namespace ov
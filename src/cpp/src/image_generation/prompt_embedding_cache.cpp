@@ -0,0 +1,121 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/image_generation/prompt_embedding_cache.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+constexpr size_t DEFAULT_CAPACITY_BYTES = 256 * 1024 * 1024;
+
+std::string serialize_key(const PromptEmbeddingCache::Key& key) {
+    // prompts are prefixed with their lengths, so different prompt splits can't produce the same key
+    return std::to_string(key.encoder_id) + ':' +
+           std::to_string(key.do_classifier_free_guidance) + ':' +
+           std::to_string(key.max_sequence_length) + ':' +
+           std::to_string(key.positive_prompt.size()) + ':' + key.positive_prompt +
+           std::to_string(key.negative_prompt.size()) + ':' + key.negative_prompt;
+}
+
+} // namespace
+
+PromptEmbeddingCache::PromptEmbeddingCache() {
+    m_statistics.capacity_bytes = DEFAULT_CAPACITY_BYTES;
+}
+
+PromptEmbeddingCache& PromptEmbeddingCache::instance() {
+    static PromptEmbeddingCache cache;
+    return cache;
+}
+
+void PromptEmbeddingCache::set_capacity(size_t capacity_bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.capacity_bytes = capacity_bytes;
+    evict(capacity_bytes);
+}
+
+size_t PromptEmbeddingCache::get_capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics.capacity_bytes;
+}
+
+PromptEmbeddingCache::Statistics PromptEmbeddingCache::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+void PromptEmbeddingCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_statistics.num_entries = 0;
+    m_statistics.size_bytes = 0;
+}
+
+std::optional<std::vector<ov::Tensor>> PromptEmbeddingCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_index.find(serialize_key(key));
+    if (it == m_index.end()) {
+        ++m_statistics.misses;
+        return std::nullopt;
+    }
+
+    ++m_statistics.hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->outputs;
+}
+
+void PromptEmbeddingCache::insert(const Key& key, const std::vector<ov::Tensor>& outputs) {
+    size_t size_bytes = 0;
+    for (const ov::Tensor& output : outputs) {
+        size_bytes += output.get_byte_size();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (size_bytes > m_statistics.capacity_bytes) {
+        return;
+    }
+
+    std::string serialized_key = serialize_key(key);
+    if (m_index.count(serialized_key)) {
+        return;
+    }
+
+    // copy outside of the infer request output buffers which are overwritten by the next inference
+    std::vector<ov::Tensor> copies;
+    copies.reserve(outputs.size());
+    for (const ov::Tensor& output : outputs) {
+        ov::Tensor copy(output.get_element_type(), output.get_shape());
+        output.copy_to(copy);
+        copies.push_back(copy);
+    }
+
+    evict(m_statistics.capacity_bytes - size_bytes);
+
+    m_entries.push_front({serialized_key, std::move(copies), size_bytes});
+    m_index.emplace(std::move(serialized_key), m_entries.begin());
+    m_statistics.size_bytes += size_bytes;
+    m_statistics.num_entries = m_entries.size();
+}
+
+size_t PromptEmbeddingCache::create_encoder_id() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_next_encoder_id++;
+}
+
+void PromptEmbeddingCache::evict(size_t capacity_bytes) {
+    while (!m_entries.empty() && m_statistics.size_bytes > capacity_bytes) {
+        const Entry& entry = m_entries.back();
+        m_statistics.size_bytes -= entry.size_bytes;
+        m_index.erase(entry.key);
+        m_entries.pop_back();
+        ++m_statistics.evictions;
+    }
+    m_statistics.num_entries = m_entries.size();
+}
+
+} // namespace genai
+} // namespace ov
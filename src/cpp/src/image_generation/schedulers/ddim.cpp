@@ -78,6 +78,7 @@ DDIMScheduler::DDIMScheduler(const Config& scheduler_config)
 
 void DDIMScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_timesteps.clear();
+    m_prev_sample = ov::Tensor();
 
     OPENVINO_ASSERT(num_inference_steps <= m_config.num_train_timesteps,
                     "`num_inference_steps` cannot be larger than `m_config.num_train_timesteps`");
@@ -139,35 +140,6 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
     float alpha_prod_t_prev = (prev_timestep >= 0) ? m_alphas_cumprod[prev_timestep] : m_final_alpha_cumprod;
     float beta_prod_t = 1 - alpha_prod_t;
 
-    // compute predicted original sample from predicted noise also called
-    // "predicted x_0" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    std::vector<float> pred_original_sample, pred_epsilon;
-    float pos_val, pe_val;
-    for (size_t j = 0; j < noise_pred.get_size(); j++) {
-        switch (m_config.prediction_type) {
-            case PredictionType::EPSILON:
-                pos_val = (latents.data<float>()[j] - std::sqrt(beta_prod_t) * noise_pred.data<float>()[j]) / std::sqrt(alpha_prod_t);
-                pe_val = noise_pred.data<float>()[j];
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            case PredictionType::SAMPLE:
-                pos_val = noise_pred.data<float>()[j];
-                pe_val = (latents.data<float>()[j] - std::sqrt(alpha_prod_t) * pos_val) / std::sqrt(beta_prod_t);
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            case PredictionType::V_PREDICTION:
-                pos_val = std::sqrt(alpha_prod_t) * latents.data<float>()[j] - std::sqrt(beta_prod_t) * noise_pred.data<float>()[j];
-                pe_val = std::sqrt(alpha_prod_t) * noise_pred.data<float>()[j] + std::sqrt(beta_prod_t) * latents.data<float>()[j];
-                pred_original_sample.push_back(pos_val);
-                pred_epsilon.push_back(pe_val);
-                break;
-            default:
-                OPENVINO_THROW("Unsupported value for 'PredictionType'");
-        }
-    }
-
     // TODO: support m_config.thresholding
     OPENVINO_ASSERT(!m_config.thresholding,
                     "Parameter 'thresholding' is not supported. Please, add support.");
@@ -175,17 +147,47 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
     OPENVINO_ASSERT(!m_config.clip_sample,
                     "Parameter 'clip_sample' is not supported. Please, add support.");
 
-    // compute "direction pointing to x_t" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    std::vector<float> pred_sample_direction(pred_epsilon.size());
-    std::transform(pred_epsilon.begin(), pred_epsilon.end(), pred_sample_direction.begin(), [alpha_prod_t_prev](auto x) {
-        return std::sqrt(1 - alpha_prod_t_prev) * x;
-    });
+    const float sqrt_alpha_prod_t = std::sqrt(alpha_prod_t), sqrt_beta_prod_t = std::sqrt(beta_prod_t);
+    const float sqrt_alpha_prod_t_prev = std::sqrt(alpha_prod_t_prev), sqrt_beta_prod_t_prev = std::sqrt(1 - alpha_prod_t_prev);
+
+    const float* model_output_data = noise_pred.data<const float>();
+    const float* sample_data = latents.data<const float>();
 
-    // compute x_t without "random noise" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
+    ov::Tensor prev_sample = numpy_utils::reuse_buffer(m_prev_sample, latents.get_element_type(), latents.get_shape());
     float* prev_sample_data = prev_sample.data<float>();
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = std::sqrt(alpha_prod_t_prev) * pred_original_sample[i] + pred_sample_direction[i];
+
+    // compute predicted original sample from predicted noise also called
+    // "predicted x_0" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
+    // then "direction pointing to x_t" and x_t without "random noise" of formula (12) within the same elementwise loop
+    auto ddim_step = [&](size_t i, float pred_original_sample, float pred_epsilon) {
+        prev_sample_data[i] = sqrt_alpha_prod_t_prev * pred_original_sample + sqrt_beta_prod_t_prev * pred_epsilon;
+    };
+
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            numpy_utils::parallel_for_range(noise_pred.get_size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    ddim_step(i, (sample_data[i] - sqrt_beta_prod_t * model_output_data[i]) / sqrt_alpha_prod_t, model_output_data[i]);
+                }
+            });
+            break;
+        case PredictionType::SAMPLE:
+            numpy_utils::parallel_for_range(noise_pred.get_size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    ddim_step(i, model_output_data[i], (sample_data[i] - sqrt_alpha_prod_t * model_output_data[i]) / sqrt_beta_prod_t);
+                }
+            });
+            break;
+        case PredictionType::V_PREDICTION:
+            numpy_utils::parallel_for_range(noise_pred.get_size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    ddim_step(i, sqrt_alpha_prod_t * sample_data[i] - sqrt_beta_prod_t * model_output_data[i],
+                                 sqrt_alpha_prod_t * model_output_data[i] + sqrt_beta_prod_t * sample_data[i]);
+                }
+            });
+            break;
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
     std::map<std::string, ov::Tensor> result{{"latent", prev_sample}};
@@ -205,6 +207,10 @@ void DDIMScheduler::scale_model_input(ov::Tensor sample, size_t inference_step)
     return;
 }
 
+std::shared_ptr<IScheduler> DDIMScheduler::clone() const {
+    return std::make_shared<DDIMScheduler>(*this);
+}
+
 void DDIMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     float sqrt_alpha_prod = std::sqrt(m_alphas_cumprod[latent_timestep]);
     float sqrt_one_minus_alpha_prod = std::sqrt(1.0 - m_alphas_cumprod[latent_timestep]);
@@ -47,6 +47,8 @@ public:
 
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t timestep) const override;
 
+    std::shared_ptr<IScheduler> clone() const override;
+
 private:
     Config m_config;
 
@@ -55,6 +57,9 @@ private:
 
     size_t m_num_inference_steps;
     std::vector<int64_t> m_timesteps;
+
+    // step output is reused between steps
+    ov::Tensor m_prev_sample;
 };
 
 } // namespace genai
@@ -218,6 +218,10 @@ size_t EulerAncestralDiscreteScheduler::_index_for_timestep(int64_t timestep) co
     OPENVINO_THROW("Failed to find index for timestep ", timestep);
 }
 
+std::shared_ptr<IScheduler> EulerAncestralDiscreteScheduler::clone() const {
+    return std::make_shared<EulerAncestralDiscreteScheduler>(*this);
+}
+
 void EulerAncestralDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     size_t index_for_timestep = _index_for_timestep(latent_timestep);
     const float sigma = m_sigmas[index_for_timestep];
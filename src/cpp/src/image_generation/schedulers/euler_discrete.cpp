@@ -110,6 +110,7 @@ void EulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float str
     m_timesteps.clear();
     m_sigmas.clear();
     m_step_index = m_begin_index = -1;
+    m_prev_sample = m_pred_original_sample = ov::Tensor();
 
     m_num_inference_steps = num_inference_steps;
     std::vector<float> sigmas;
@@ -221,45 +222,56 @@ std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_
     // TODO: hardcoded gamma
     float gamma = 0.0f;
     float sigma_hat = sigma * (gamma + 1);
+    float dt = m_sigmas[m_step_index + 1] - sigma_hat;
 
-    float* model_output_data = noise_pred.data<float>();
-    float* sample_data = latents.data<float>();
+    const float* model_output_data = noise_pred.data<const float>();
+    const float* sample_data = latents.data<const float>();
 
-    ov::Tensor pred_original_sample(noise_pred.get_element_type(), noise_pred.get_shape());
+    // 'latents' can be 'prev_sample' of a previous step, so both steps below are fused into a single elementwise loop
+    ov::Tensor pred_original_sample = numpy_utils::reuse_buffer(m_pred_original_sample, noise_pred.get_element_type(), noise_pred.get_shape());
     float* pred_original_sample_data = pred_original_sample.data<float>();
 
-    ov::Tensor prev_sample(noise_pred.get_element_type(), noise_pred.get_shape());
+    ov::Tensor prev_sample = numpy_utils::reuse_buffer(m_prev_sample, noise_pred.get_element_type(), noise_pred.get_shape());
     float* prev_sample_data = prev_sample.data<float>();
 
     // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
+    // 2. Convert to an ODE derivative
+    auto ode_step = [&](size_t i) {
+        prev_sample_data[i] = ((sample_data[i] - pred_original_sample_data[i]) / sigma_hat) * dt + sample_data[i];
+    };
+
     switch (m_config.prediction_type) {
     case PredictionType::EPSILON:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = sample_data[i] - model_output_data[i] * sigma_hat;
-        }
+        numpy_utils::parallel_for_range(noise_pred.get_size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                pred_original_sample_data[i] = sample_data[i] - model_output_data[i] * sigma_hat;
+                ode_step(i);
+            }
+        });
         break;
     case PredictionType::SAMPLE:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i];
-        }
+        numpy_utils::parallel_for_range(noise_pred.get_size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                pred_original_sample_data[i] = model_output_data[i];
+                ode_step(i);
+            }
+        });
         break;
-    case PredictionType::V_PREDICTION:
-        for (size_t i = 0; i < noise_pred.get_size(); ++i) {
-            pred_original_sample_data[i] = model_output_data[i] * (-sigma / std::pow((std::pow(sigma, 2) + 1), 0.5)) +
-                                           (sample_data[i] / (std::pow(sigma, 2) + 1));
-        }
+    case PredictionType::V_PREDICTION: {
+        const float model_output_scale = -sigma / std::pow((std::pow(sigma, 2) + 1), 0.5);
+        const float sample_scale = 1.0f / (std::pow(sigma, 2) + 1);
+        numpy_utils::parallel_for_range(noise_pred.get_size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                pred_original_sample_data[i] = model_output_data[i] * model_output_scale + sample_data[i] * sample_scale;
+                ode_step(i);
+            }
+        });
         break;
+    }
     default:
         OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
-    float dt = m_sigmas[m_step_index + 1] - sigma_hat;
-
-    // 2. Convert to an ODE derivative
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = ((sample_data[i] - pred_original_sample_data[i]) / sigma_hat) * dt + sample_data[i];
-    }
-
     m_step_index += 1;
 
     return {{"latent", prev_sample}, {"denoised", pred_original_sample}};
@@ -301,6 +313,10 @@ size_t EulerDiscreteScheduler::_index_for_timestep(int64_t timestep) const {
     OPENVINO_THROW("Failed to find index for timestep ", timestep);
 }
 
+std::shared_ptr<IScheduler> EulerDiscreteScheduler::clone() const {
+    return std::make_shared<EulerDiscreteScheduler>(*this);
+}
+
 void EulerDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     const float sigma = m_sigmas[_index_for_timestep(latent_timestep)];
 
@@ -49,6 +49,8 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
+    std::shared_ptr<IScheduler> clone() const override;
+
 private:
     Config m_config;
 
@@ -58,6 +60,9 @@ private:
 
     int m_step_index, m_begin_index;
 
+    // step outputs are reused between steps
+    ov::Tensor m_prev_sample, m_pred_original_sample;
+
     size_t _index_for_timestep(int64_t timestep) const;
 };
 
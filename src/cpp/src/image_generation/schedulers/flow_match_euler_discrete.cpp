@@ -71,6 +71,7 @@ double FlowMatchEulerDiscreteScheduler::sigma_to_t(double sigma) {
 void FlowMatchEulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_timesteps.clear();
     m_sigmas.clear();
+    m_prev_sample = ov::Tensor();
 
     m_num_inference_steps = num_inference_steps;
     int32_t num_train_timesteps = m_config.num_train_timesteps;
@@ -110,14 +111,16 @@ std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::step(ov::Tens
     if (m_step_index == -1)
         init_step_index();
 
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
+    ov::Tensor prev_sample = numpy_utils::reuse_buffer(m_prev_sample, latents.get_element_type(), latents.get_shape());
     float* prev_sample_data = prev_sample.data<float>();
 
     float sigma_diff = m_sigmas[m_step_index + 1] - m_sigmas[m_step_index];
 
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        prev_sample_data[i] = sample_data[i] + sigma_diff * model_output_data[i];
-    }
+    numpy_utils::parallel_for_range(prev_sample.get_size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            prev_sample_data[i] = sample_data[i] + sigma_diff * model_output_data[i];
+        }
+    });
 
     m_step_index++;
 
@@ -141,6 +144,10 @@ void FlowMatchEulerDiscreteScheduler::init_step_index() {
     m_step_index = (m_begin_index == -1) ? 0 : m_begin_index;
 }
 
+std::shared_ptr<IScheduler> FlowMatchEulerDiscreteScheduler::clone() const {
+    return std::make_shared<FlowMatchEulerDiscreteScheduler>(*this);
+}
+
 void FlowMatchEulerDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     // use https://github.com/huggingface/diffusers/blob/v0.31.0/src/diffusers/schedulers/scheduling_flow_match_euler_discrete.py#L117
     OPENVINO_THROW("Not implemented");
@@ -149,6 +156,7 @@ void FlowMatchEulerDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tens
 void FlowMatchEulerDiscreteScheduler::set_timesteps_with_sigma(std::vector<float> sigma, float mu) {
     m_timesteps.clear();
     m_sigmas.clear();
+    m_prev_sample = ov::Tensor();
     m_sigmas = sigma;
     float shift = m_config.shift;
 
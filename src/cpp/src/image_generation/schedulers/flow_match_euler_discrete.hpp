@@ -42,6 +42,8 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
+    std::shared_ptr<IScheduler> clone() const override;
+
     float calculate_shift(size_t image_seq_len) override;
 
 private:
@@ -54,6 +56,9 @@ private:
     size_t m_step_index, m_begin_index;
     size_t m_num_inference_steps;
 
+    // step output is reused between steps
+    ov::Tensor m_prev_sample;
+
     void init_step_index();
     double sigma_to_t(double simga);
 };
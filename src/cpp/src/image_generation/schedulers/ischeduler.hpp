@@ -23,11 +23,16 @@ public:
 
     virtual void scale_model_input(ov::Tensor sample, size_t inference_step) = 0;
 
+    // note, returned tensors may be reused by the next step, while 'latents' may be a "latent" returned by a previous step
     virtual std::map<std::string, ov::Tensor> step(
         ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) = 0;
 
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const = 0;
 
+    // creates an independent scheduler with the same config, e.g. to denoise several requests at once
+    // note, 'set_timesteps' must be called on the clone to reset the denoising state
+    virtual std::shared_ptr<IScheduler> clone() const = 0;
+
     virtual float calculate_shift(size_t image_seq_len) {
         OPENVINO_THROW("Scheduler doesn't support `calculate_shift` method");
     }
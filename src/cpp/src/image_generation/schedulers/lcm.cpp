@@ -243,6 +243,10 @@ std::vector<float> LCMScheduler::threshold_sample(const std::vector<float>& flat
     return thresholded_sample;
 }
 
+std::shared_ptr<IScheduler> LCMScheduler::clone() const {
+    return std::make_shared<LCMScheduler>(*this);
+}
+
 void LCMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     float sqrt_alpha_prod = std::sqrt(m_alphas_cumprod[latent_timestep]);
     float sqrt_one_minus_alpha_prod = std::sqrt(1.0f - m_alphas_cumprod[latent_timestep]);
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <fstream>
 
+#include "image_generation/numpy_utils.hpp"
 #include "json_utils.hpp"
 namespace {
 
@@ -162,6 +163,7 @@ void LMSDiscreteScheduler::scale_model_input(ov::Tensor sample, size_t inference
 void LMSDiscreteScheduler::set_timesteps(size_t num_inference_steps, float strength) {
     m_timesteps.clear();
     m_derivative_list.clear();
+    m_prev_sample = ov::Tensor();
 
     float delta = -999.0f / (num_inference_steps - 1);
     // transform interpolation to time range
@@ -191,36 +193,51 @@ std::map<std::string, ov::Tensor> LMSDiscreteScheduler::step(ov::Tensor noise_pr
     const float sigma = m_sigmas[inference_step];
 
     // LMS step function:
-    std::vector<float> derivative;
-    derivative.reserve(latents.get_size());
-
-    for (size_t j = 0; j < latents.get_size(); j++) {
-        // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
-        float pred_latent = 0;
-        switch (m_config.prediction_type) {
-            case PredictionType::EPSILON:
-                pred_latent = latents.data<float>()[j] - sigma * noise_pred.data<float>()[j];
-                break;
-            case PredictionType::SAMPLE:
-                pred_latent = noise_pred.data<float>()[j];
-                break;
-            case PredictionType::V_PREDICTION:
-                // pred_original_sample = model_output * (-sigma / (sigma**2 + 1) ** 0.5) + (sample / (sigma**2 + 1))
-                pred_latent = noise_pred.data<float>()[j] * (-sigma / std::sqrt(sigma * sigma + 1.0f) + 
-                    latents.data<float>()[j] / (sigma * sigma + 1.0f));
-                break;
-            default:
-                OPENVINO_THROW("Unsupported value for 'PredictionType'");
-        }
-        // 2. Convert to an ODE derivative
-        derivative.push_back((latents.data<float>()[j] - pred_latent) / sigma);
-    }
-
-    m_derivative_list.push_back(derivative);
-    // keep the list size within 4
+    // keep the list size within 4, the oldest derivative buffer is reused for a new one
     size_t order = 4;
-    if (order < m_derivative_list.size()) {
-        m_derivative_list.pop_front();
+    if (m_derivative_list.size() == order) {
+        m_derivative_list.splice(m_derivative_list.end(), m_derivative_list, m_derivative_list.begin());
+    } else {
+        m_derivative_list.emplace_back();
+    }
+    std::vector<float>& derivative = m_derivative_list.back();
+    derivative.resize(latents.get_size());
+
+    const float* model_output_data = noise_pred.data<const float>();
+    const float* sample_data = latents.data<const float>();
+    float* derivative_data = derivative.data();
+
+    // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
+    // 2. Convert to an ODE derivative
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            numpy_utils::parallel_for_range(latents.get_size(), [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    const float pred_latent = sample_data[j] - sigma * model_output_data[j];
+                    derivative_data[j] = (sample_data[j] - pred_latent) / sigma;
+                }
+            });
+            break;
+        case PredictionType::SAMPLE:
+            numpy_utils::parallel_for_range(latents.get_size(), [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    derivative_data[j] = (sample_data[j] - model_output_data[j]) / sigma;
+                }
+            });
+            break;
+        case PredictionType::V_PREDICTION: {
+            // pred_original_sample = model_output * (-sigma / (sigma**2 + 1) ** 0.5) + (sample / (sigma**2 + 1))
+            const float model_output_scale = -sigma / std::sqrt(sigma * sigma + 1.0f);
+            numpy_utils::parallel_for_range(latents.get_size(), [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    const float pred_latent = model_output_data[j] * (model_output_scale + sample_data[j] / (sigma * sigma + 1.0f));
+                    derivative_data[j] = (sample_data[j] - pred_latent) / sigma;
+                }
+            });
+            break;
+        }
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
     }
 
     // 3. Compute linear multistep coefficients
@@ -228,7 +245,7 @@ std::map<std::string, ov::Tensor> LMSDiscreteScheduler::step(ov::Tensor noise_pr
 
     std::vector<float> lms_coeffs(order);
     for (size_t curr_order = 0; curr_order < order; curr_order++) {
-        auto lms_derivative_functor = [order, curr_order, sigmas = this->m_sigmas, inference_step] (float tau) {
+        auto lms_derivative_functor = [order, curr_order, &sigmas = this->m_sigmas, inference_step] (float tau) {
             return lms_derivative(tau, order, curr_order, sigmas, inference_step);
         };
         // integrated_coeff = integrate.quad(lms_derivative, self.sigmas[t], self.sigmas[t + 1], epsrel=1e-4)[0]
@@ -237,23 +254,32 @@ std::map<std::string, ov::Tensor> LMSDiscreteScheduler::step(ov::Tensor noise_pr
 
     // 4. Compute previous sample based on the derivatives path
     // prev_sample = sample + sum(coeff * derivative for coeff, derivative in zip(lms_coeffs, reversed(self.derivatives)))
-    ov::Tensor prev_sample(latents.get_element_type(), latents.get_shape());
+    std::vector<const float*> derivatives_data;
+    for (auto derivative_it = m_derivative_list.begin(); derivatives_data.size() < order; ++derivative_it) {
+        derivatives_data.push_back(derivative_it->data());
+    }
+
+    ov::Tensor prev_sample = numpy_utils::reuse_buffer(m_prev_sample, latents.get_element_type(), latents.get_shape());
     float* prev_sample_data = prev_sample.data<float>();
-    const float* latents_data = latents.data<const float>();
-    for (size_t i = 0; i < prev_sample.get_size(); ++i) {
-        float derivative_sum = 0.0f;
-        auto derivative_it = m_derivative_list.begin();
-        for (size_t curr_order = 0; curr_order < order; derivative_it++, curr_order++) {
-            derivative_sum += (*derivative_it)[i] * lms_coeffs[order - curr_order - 1];
+    numpy_utils::parallel_for_range(prev_sample.get_size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            float derivative_sum = 0.0f;
+            for (size_t curr_order = 0; curr_order < order; curr_order++) {
+                derivative_sum += derivatives_data[curr_order][i] * lms_coeffs[order - curr_order - 1];
+            }
+            prev_sample_data[i] = sample_data[i] + derivative_sum;
         }
-        prev_sample_data[i] = latents_data[i] + derivative_sum;
-    }
+    });
 
     std::map<std::string, ov::Tensor> result{{"latent", prev_sample}};
 
     return result;
 }
 
+std::shared_ptr<IScheduler> LMSDiscreteScheduler::clone() const {
+    return std::make_shared<LMSDiscreteScheduler>(*this);
+}
+
 void LMSDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     // use https://github.com/huggingface/diffusers/blob/v0.31.0/src/diffusers/schedulers/scheduling_ddim.py#L474
     OPENVINO_THROW("Not implemented");
@@ -43,6 +43,8 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
+    std::shared_ptr<IScheduler> clone() const override;
+
 private:
     Config m_config;
 
@@ -51,6 +53,9 @@ private:
     std::vector<int64_t> m_timesteps;
     std::list<std::vector<float>> m_derivative_list;
 
+    // step output is reused between steps
+    ov::Tensor m_prev_sample;
+
     int64_t _sigma_to_t(float sigma) const;
 };
 
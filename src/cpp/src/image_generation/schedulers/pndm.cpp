@@ -256,6 +256,10 @@ ov::Tensor PNDMScheduler::get_prev_sample(ov::Tensor sample, size_t timestep, in
     return prev_sample;
 }
 
+std::shared_ptr<IScheduler> PNDMScheduler::clone() const {
+    return std::make_shared<PNDMScheduler>(*this);
+}
+
 void PNDMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const {
     float sqrt_alpha_prod = std::sqrt(m_alphas_cumprod[latent_timestep]);
     float sqrt_one_minus_alpha_prod = std::sqrt(1.0 - m_alphas_cumprod[latent_timestep]);
@@ -44,6 +44,8 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t timestep) const override;
 
+    std::shared_ptr<IScheduler> clone() const override;
+
 private:
     Config m_config;
 
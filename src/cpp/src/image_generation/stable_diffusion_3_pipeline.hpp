@@ -243,7 +243,7 @@ public:
                                height,
                                width,
                                m_clip_text_encoder_1->get_config().max_position_embeddings);
-        m_vae->reshape(num_images_per_prompt, height, width);
+        reshape_vae(*m_vae, num_images_per_prompt, height, width);
     }
 
     void compile(const std::string& device, const ov::AnyMap& properties) override {
@@ -431,7 +431,31 @@ public:
                         ov::Tensor initial_image,
                         ov::Tensor mask_image,
                         const ov::AnyMap& properties) override {
-        ImageGenerationConfig generation_config = m_generation_config;
+        ImageGenerationConfig generation_config;
+        ov::Tensor latent = denoise(positive_prompt, initial_image, properties, generation_config);
+        if (!latent) {
+            return ov::Tensor(ov::element::u8, {});
+        }
+        return vae_decode(*m_vae, latent, generation_config);
+    }
+
+    LatentDecoder generate_deferred(const std::string& positive_prompt, const ov::AnyMap& properties) override {
+        ImageGenerationConfig generation_config;
+        ov::Tensor latent = denoise(positive_prompt, {}, properties, generation_config);
+        return deferred_vae_decode(*m_vae, latent, generation_config);
+    }
+
+    ov::Tensor decode(const ov::Tensor latent) override {
+        return vae_decode(*m_vae, latent, m_generation_config);
+    }
+
+private:
+    // runs denoising loop and returns a final latent to decode, an empty tensor if generation is cancelled by callback
+    ov::Tensor denoise(const std::string& positive_prompt,
+                       ov::Tensor initial_image,
+                       const ov::AnyMap& properties,
+                       ImageGenerationConfig& generation_config) {
+        generation_config = m_generation_config;
         generation_config.update_generation_config(properties);
 
         // Use callback if defined
@@ -490,14 +514,10 @@ public:
                 noisy_residual_tensor.set_shape(noise_pred_shape);
 
                 // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
                 const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
                 const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
+                numpy_utils::apply_guidance(noise_pred_uncond, noise_pred_text, generation_config.guidance_scale,
+                                            noisy_residual_tensor.data<float>(), noisy_residual_tensor.get_size());
             } else {
                 noisy_residual_tensor = noise_pred_tensor;
             }
@@ -506,18 +526,13 @@ public:
             latent = scheduler_step_result["latent"];
 
             if (callback && callback(inference_step, timesteps.size(), latent)) {
-                return ov::Tensor(ov::element::u8, {});
+                return ov::Tensor();
             }
         }
 
-        return decode(latent);
+        return latent;
     }
 
-    ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
-    }
-
-private:
     bool is_inpainting_model() const {
         assert(m_transformer != nullptr);
         assert(m_vae != nullptr);
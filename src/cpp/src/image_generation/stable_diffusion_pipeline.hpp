@@ -4,7 +4,10 @@
 #pragma once
 
 #include <cassert>
+#include <cmath>
+#include <cstring>
 #include <filesystem>
+#include <map>
 
 #include "image_generation/diffusion_pipeline.hpp"
 #include "image_generation/numpy_utils.hpp"
@@ -165,7 +168,8 @@ public:
         const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
         m_clip_text_encoder->reshape(batch_size_multiplier);
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
-        m_vae->reshape(num_images_per_prompt, height, width);
+        reshape_vae(*m_vae, num_images_per_prompt, height, width);
+        m_static_shapes = true;
     }
 
     void compile(const std::string& device, const ov::AnyMap& properties) override {
@@ -184,29 +188,13 @@ public:
         ov::Tensor encoder_hidden_states = m_clip_text_encoder->infer(positive_prompt, negative_prompt,
             batch_size_multiplier > 1);
 
-        // replicate encoder hidden state to UNet model
-        if (generation_config.num_images_per_prompt == 1) {
-            // reuse output of text encoder directly w/o extra memory copy
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
-        } else {
-            ov::Shape enc_shape = encoder_hidden_states.get_shape();
-            enc_shape[0] *= generation_config.num_images_per_prompt;
-
-            ov::Tensor encoder_hidden_states_repeated(encoder_hidden_states.get_element_type(), enc_shape);
-            for (size_t n = 0; n < generation_config.num_images_per_prompt; ++n) {
-                numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated, 0, n);
-                if (batch_size_multiplier > 1) {
-                    numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated,
-                        1, generation_config.num_images_per_prompt + n);
-                }
-            }
-
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
-        }
+        // replicate encoder hidden state to UNet model, output of text encoder is used directly for a single image
+        set_unet_hidden_states("encoder_hidden_states",
+            numpy_utils::repeat_interleave(encoder_hidden_states, generation_config.num_images_per_prompt, m_encoder_hidden_states_buffer));
 
         if (unet_config.time_cond_proj_dim >= 0) { // LCM
             ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
-            m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            set_unet_hidden_states("timestep_cond", timestep_cond);
         }
     }
 
@@ -233,7 +221,7 @@ public:
             // - inpainting with strength < 1.0
             // - inpainting with non-specialized model
             if (!is_strength_max || return_image_latent) {
-                image_latent = m_vae->encode(proccesed_image, generation_config.generator);
+                image_latent = vae_encode(*m_vae, proccesed_image, generation_config);
 
                 // in case of image to image or inpaining with strength < 1.0, we need to initialize initial latent with image_latent
                 if (!is_strength_max) {
@@ -272,8 +260,8 @@ public:
         mask_condition = mask_processor->execute(mask_condition);
 
         // resize mask to shape of latent space
+        // mask and masked image latent are not repeated per image, they are broadcasted when written to UNet input
         ov::Tensor mask = m_mask_resizer->execute(mask_condition, target_shape[2] / vae_scale_factor, target_shape[3] / vae_scale_factor);
-        mask = numpy_utils::repeat(mask, generation_config.num_images_per_prompt * batch_size_multiplier);
 
         ov::Tensor masked_image_latent;
 
@@ -291,8 +279,7 @@ public:
             }
 
             // encode masked image to latent scape
-            masked_image_latent = m_vae->encode(masked_image, generation_config.generator);
-            masked_image_latent = numpy_utils::repeat(masked_image_latent, generation_config.num_images_per_prompt * batch_size_multiplier);
+            masked_image_latent = vae_encode(*m_vae, masked_image, generation_config);
         }
 
         return std::make_tuple(mask, masked_image_latent);
@@ -307,8 +294,186 @@ public:
                         ov::Tensor initial_image,
                         ov::Tensor mask_image,
                         const ov::AnyMap& properties) override {
+        ImageGenerationConfig generation_config;
+        ov::Tensor denoised = denoise(positive_prompt, initial_image, mask_image, properties, generation_config);
+        if (!denoised) {
+            return ov::Tensor(ov::element::u8, {});
+        }
+        return vae_decode(*m_vae, denoised, generation_config);
+    }
+
+    LatentDecoder generate_deferred(const std::string& positive_prompt, const ov::AnyMap& properties) override {
+        ImageGenerationConfig generation_config;
+        ov::Tensor denoised = denoise(positive_prompt, {}, {}, properties, generation_config);
+        return deferred_vae_decode(*m_vae, denoised, generation_config);
+    }
+
+    ov::Tensor decode(const ov::Tensor latent) override {
+        return vae_decode(*m_vae, latent, m_generation_config);
+    }
+
+    bool is_batched_denoising_supported() const override {
+        // requests are concatenated along batch dimension, so denoising model must have dynamic shapes
+        return m_pipeline_type == PipelineType::TEXT_2_IMAGE && !m_static_shapes;
+    }
+
+    std::shared_ptr<DenoisingRequest> create_denoising_request(const std::string& positive_prompt, const ov::AnyMap& properties) override {
+        OPENVINO_ASSERT(is_batched_denoising_supported(), "Batched denoising is supported only by text to image pipelines which are not reshaped");
+        OPENVINO_ASSERT(properties.find("adapters") == properties.end(), "LoRA adapters cannot be changed per request, because requests share UNet inference");
+
+        auto request = std::make_shared<DenoisingRequest>();
+        ImageGenerationConfig& generation_config = request->generation_config;
+        generation_config = m_generation_config;
+        // a request with its own seed must not reseed generator shared with other requests
+        if (properties.find(ov::genai::rng_seed.name()) != properties.end() && properties.find(ov::genai::generator.name()) == properties.end()) {
+            generation_config.generator = nullptr;
+        }
+        generation_config.update_generation_config(properties);
+
+        auto callback_iter = properties.find(ov::genai::callback.name());
+        if (callback_iter != properties.end()) {
+            request->callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+        }
+
+        if (generation_config.height < 0)
+            compute_dim(generation_config.height, {}, 1 /* assume NHWC */);
+        if (generation_config.width < 0)
+            compute_dim(generation_config.width, {}, 2 /* assume NHWC */);
+
+        check_inputs(generation_config, {});
+        OPENVINO_ASSERT(generation_config.unet_cache_interval == 1 && generation_config.guidance_end == 1.0f,
+            "'unet_cache_interval' and 'guidance_end' are not supported by batched denoising");
+
+        set_lora_adapters(generation_config.adapters);
+
+        // each request has its own denoising state
+        request->scheduler = m_scheduler->clone();
+        request->scheduler->set_timesteps(generation_config.num_inference_steps, generation_config.strength);
+        request->timesteps = request->scheduler->get_timesteps();
+        request->batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;
+
+        m_unet_hidden_states.clear();
+        compute_hidden_states(positive_prompt, generation_config);
+
+        // text encoders outputs are overwritten by the next request, so hidden states are copied
+        const size_t unet_batch_size = generation_config.num_images_per_prompt * request->batch_size_multiplier;
+        for (const auto& [name, hidden_state] : m_unet_hidden_states) {
+            ov::Tensor request_hidden_state(hidden_state.get_element_type(), hidden_state.get_shape());
+            hidden_state.copy_to(request_hidden_state);
+
+            // inputs shared by all images like LCM 'timestep_cond' are repeated, so requests can be concatenated
+            if (request_hidden_state.get_shape()[0] != unet_batch_size) {
+                OPENVINO_ASSERT(request_hidden_state.get_shape()[0] == 1, "Unexpected batch size of UNet input '", name, "'");
+                request_hidden_state = numpy_utils::repeat(request_hidden_state, unet_batch_size);
+            }
+            request->hidden_states[name] = request_hidden_state;
+        }
+
+        const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
+        ov::Shape latent_shape{generation_config.num_images_per_prompt, m_vae->get_config().latent_channels,
+                               generation_config.height / vae_scale_factor, generation_config.width / vae_scale_factor};
+        ov::Tensor noise = generation_config.generator->randn_tensor(latent_shape);
+
+        request->latent = ov::Tensor(ov::element::f32, latent_shape);
+        const float * noise_data = noise.data<const float>();
+        float * latent_data = request->latent.data<float>();
+        for (size_t i = 0; i < request->latent.get_size(); ++i)
+            latent_data[i] = noise_data[i] * request->scheduler->get_init_noise_sigma();
+
+        return request;
+    }
+
+    void denoise_step(const std::vector<std::shared_ptr<DenoisingRequest>>& requests) override {
+        OPENVINO_ASSERT(!requests.empty(), "At least one request is required for denoising step");
+        const DenoisingRequest& first_request = *requests.front();
+
+        ov::Shape sample_shape = first_request.latent.get_shape();
+        const size_t image_size = ov::shape_size(sample_shape) / sample_shape[0];
+        sample_shape[0] = 0;
+        for (const auto& request : requests) {
+            sample_shape[0] += request->latent.get_shape()[0] * request->batch_size_multiplier;
+        }
+
+        // requests are placed one after another, each of them as [uncond, cond] in case of CFG
+        ov::Tensor sample = numpy_utils::reuse_buffer(m_latent_cfg_buffer, ov::element::f32, sample_shape);
+        for (size_t i = 0, offset = 0; i < requests.size(); ++i) {
+            DenoisingRequest& request = *requests[i];
+            const size_t num_images = request.latent.get_shape()[0];
+
+            ov::Shape latent_cfg_shape = request.latent.get_shape();
+            latent_cfg_shape[0] *= request.batch_size_multiplier;
+            ov::Tensor latent_cfg(ov::element::f32, latent_cfg_shape, sample.data<float>() + offset * image_size);
+
+            for (size_t n = 0; n < request.batch_size_multiplier; ++n) {
+                numpy_utils::batch_copy(request.latent, latent_cfg, 0, n * num_images, num_images);
+            }
+            request.scheduler->scale_model_input(latent_cfg, request.inference_step);
+
+            offset += latent_cfg_shape[0];
+        }
+
+        for (const auto& [name, hidden_state] : first_request.hidden_states) {
+            ov::Shape shape = hidden_state.get_shape();
+            shape[0] = sample_shape[0];
+
+            ov::Tensor hidden_states = numpy_utils::reuse_buffer(m_batched_hidden_states[name], hidden_state.get_element_type(), shape);
+            uint8_t* hidden_states_data = static_cast<uint8_t*>(hidden_states.data());
+            for (const auto& request : requests) {
+                const ov::Tensor& request_hidden_state = request->hidden_states.at(name);
+                std::memcpy(hidden_states_data, request_hidden_state.data(), request_hidden_state.get_byte_size());
+                hidden_states_data += request_hidden_state.get_byte_size();
+            }
+
+            m_unet->set_hidden_states(name, hidden_states);
+        }
+
+        std::int64_t timestep_value = first_request.timesteps[first_request.inference_step];
+        ov::Tensor timestep(ov::element::i64, {1}, &timestep_value);
+        ov::Tensor noise_pred_tensor = m_unet->infer(sample, timestep);
+
+        const float* noise_pred = noise_pred_tensor.data<const float>();
+        for (const auto& request_ptr : requests) {
+            DenoisingRequest& request = *request_ptr;
+
+            // not a view into UNet output, which is overwritten by the next inference
+            ov::Tensor noisy_residual_tensor = numpy_utils::reuse_buffer(request.noisy_residual, ov::element::f32, request.latent.get_shape());
+            float* noisy_residual = noisy_residual_tensor.data<float>();
+            const size_t residual_size = noisy_residual_tensor.get_size();
+
+            if (request.batch_size_multiplier > 1) {
+                // perform guidance
+                const float* noise_pred_uncond = noise_pred;
+                const float* noise_pred_text = noise_pred_uncond + residual_size;
+                numpy_utils::apply_guidance(noise_pred_uncond, noise_pred_text, request.generation_config.guidance_scale, noisy_residual, residual_size);
+            } else {
+                std::copy_n(noise_pred, residual_size, noisy_residual);
+            }
+            noise_pred += residual_size * request.batch_size_multiplier;
+
+            auto scheduler_step_result = request.scheduler->step(noisy_residual_tensor, request.latent, request.inference_step, request.generation_config.generator);
+            request.latent = scheduler_step_result["latent"];
+
+            const auto it = scheduler_step_result.find("denoised");
+            request.denoised = it != scheduler_step_result.end() ? it->second : request.latent;
+
+            request.cancelled = request.callback && request.callback(request.inference_step, request.timesteps.size(), request.denoised);
+            ++request.inference_step;
+        }
+    }
+
+    LatentDecoder finish_denoising_request(const DenoisingRequest& request) override {
+        return deferred_vae_decode(*m_vae, request.cancelled ? ov::Tensor() : request.denoised, request.generation_config);
+    }
+
+protected:
+    // runs denoising loop and returns a final latent to decode, an empty tensor if generation is cancelled by callback
+    ov::Tensor denoise(const std::string& positive_prompt,
+                       ov::Tensor initial_image,
+                       ov::Tensor mask_image,
+                       const ov::AnyMap& properties,
+                       ImageGenerationConfig& generation_config) {
         using namespace numpy_utils;
-        ImageGenerationConfig generation_config = m_generation_config;
+        generation_config = m_generation_config;
         generation_config.update_generation_config(properties);
 
         // use callback if defined
@@ -322,7 +487,7 @@ public:
         // see https://huggingface.co/docs/diffusers/using-diffusers/write_own_pipeline#deconstruct-the-stable-diffusion-pipeline
 
         const auto& unet_config = m_unet->get_config();
-        const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
+        size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
         const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
 
         if (generation_config.height < 0)
@@ -337,6 +502,10 @@ public:
         m_scheduler->set_timesteps(generation_config.num_inference_steps, generation_config.strength);
         std::vector<std::int64_t> timesteps = m_scheduler->get_timesteps();
 
+        // UNet with static shapes cannot switch to conditional branch only
+        const size_t num_guided_steps = m_static_shapes ? timesteps.size() :
+            static_cast<size_t>(std::round(generation_config.guidance_end * timesteps.size()));
+
         // compute text encoders and set hidden states
         compute_hidden_states(positive_prompt, generation_config);
 
@@ -354,38 +523,63 @@ public:
         ov::Shape latent_shape_cfg = latent.get_shape();
         latent_shape_cfg[0] *= batch_size_multiplier;
 
-        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input;
+        // UNet inputs are kept between generations and reallocated only when shapes change
+        ov::Tensor latent_cfg = numpy_utils::reuse_buffer(m_latent_cfg_buffer, ov::element::f32, latent_shape_cfg);
+        ov::Tensor denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input = latent_cfg;
+
+        // inpainting model input is [latent, mask, masked image latent] along channels, where only latent changes between steps
+        if (is_inpainting_model()) {
+            ov::Shape model_input_shape = latent_shape_cfg;
+            model_input_shape[1] += mask.get_shape()[1] + masked_image_latent.get_shape()[1];
+            latent_model_input = numpy_utils::reuse_buffer(m_model_input_buffer, ov::element::f32, model_input_shape);
+
+            numpy_utils::channel_copy(mask, latent_model_input, latent_shape_cfg[1]);
+            numpy_utils::channel_copy(masked_image_latent, latent_model_input, latent_shape_cfg[1] + mask.get_shape()[1]);
+        }
 
         for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
-            numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
-            // concat the same latent twice along a batch dimension in case of CFG
-            if (batch_size_multiplier > 1) {
-                numpy_utils::batch_copy(latent, latent_cfg, 0, generation_config.num_images_per_prompt, generation_config.num_images_per_prompt);
+            // late steps are denoised by conditional UNet branch only, see 'guidance_end'
+            if (batch_size_multiplier > 1 && inference_step == num_guided_steps) {
+                batch_size_multiplier = 1;
+                set_conditional_unet_hidden_states(generation_config.num_images_per_prompt);
+
+                // both halves of latent inputs are the same, so the first one is reused in place
+                latent_cfg = numpy_utils::batch_view(latent_cfg, 0, generation_config.num_images_per_prompt);
+                latent_model_input = is_inpainting_model() ?
+                    numpy_utils::batch_view(latent_model_input, 0, generation_config.num_images_per_prompt) : latent_cfg;
             }
 
-            m_scheduler->scale_model_input(latent_cfg, inference_step);
+            // other steps reuse the last noise prediction, see 'unet_cache_interval'
+            if (inference_step % generation_config.unet_cache_interval == 0) {
+                numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
+                // concat the same latent twice along a batch dimension in case of CFG
+                if (batch_size_multiplier > 1) {
+                    numpy_utils::batch_copy(latent, latent_cfg, 0, generation_config.num_images_per_prompt, generation_config.num_images_per_prompt);
+                }
+
+                m_scheduler->scale_model_input(latent_cfg, inference_step);
 
-            ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_cfg, mask, 1), masked_image_latent, 1) : latent_cfg;
-            ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
-            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
+                if (is_inpainting_model()) {
+                    numpy_utils::channel_copy(latent_cfg, latent_model_input, 0);
+                }
 
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
- 
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
+                ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
+                ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
 
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
+                ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
+                noise_pred_shape[0] /= batch_size_multiplier;
 
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
+                if (batch_size_multiplier > 1) {
+                    noisy_residual_tensor.set_shape(noise_pred_shape);
+
+                    // perform guidance
+                    const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
+                    const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
+                    numpy_utils::apply_guidance(noise_pred_uncond, noise_pred_text, generation_config.guidance_scale,
+                                                noisy_residual_tensor.data<float>(), noisy_residual_tensor.get_size());
+                } else {
+                    noisy_residual_tensor = noise_pred_tensor;
                 }
-            } else {
-                noisy_residual_tensor = noise_pred_tensor;
             }
 
             auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
@@ -401,18 +595,13 @@ public:
             denoised = it != scheduler_step_result.end() ? it->second : latent;
 
             if (callback && callback(inference_step, timesteps.size(), denoised)) {
-                return ov::Tensor(ov::element::u8, {});
+                return ov::Tensor();
             }
         }
 
-        return decode(denoised);
-    }
-
-    ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return denoised;
     }
 
-protected:
     bool is_inpainting_model() const {
         assert(m_unet != nullptr);
         assert(m_vae != nullptr);
@@ -436,6 +625,22 @@ protected:
             generation_config_value = unet_config.sample_size * vae_scale_factor;
     }
 
+    // remembers UNet inputs set by 'compute_hidden_states' to build inputs of batched denoising requests
+    void set_unet_hidden_states(const std::string& tensor_name, ov::Tensor hidden_states) {
+        m_unet->set_hidden_states(tensor_name, hidden_states);
+        m_unet_hidden_states[tensor_name] = hidden_states;
+    }
+
+    // switches UNet from classifier free guidance to conditional inputs only, inputs shared by all images are kept
+    void set_conditional_unet_hidden_states(size_t num_images_per_prompt) {
+        // conditional inputs are the second half of a batch, views stay valid while 'm_unet_hidden_states' holds the tensors
+        for (const auto& [name, hidden_state] : m_unet_hidden_states) {
+            if (hidden_state.get_shape()[0] == 2 * num_images_per_prompt) {
+                m_unet->set_hidden_states(name, numpy_utils::batch_view(hidden_state, num_images_per_prompt, num_images_per_prompt));
+            }
+        }
+    }
+
     void initialize_generation_config(const std::string& class_name) override {
         assert(m_unet != nullptr);
         assert(m_vae != nullptr);
@@ -505,6 +710,11 @@ protected:
     std::shared_ptr<AutoencoderKL> m_vae = nullptr;
     std::shared_ptr<IImageProcessor> m_image_processor = nullptr, m_mask_processor_rgb = nullptr, m_mask_processor_gray = nullptr;
     std::shared_ptr<ImageResizer> m_image_resizer = nullptr, m_mask_resizer = nullptr;
+    std::map<std::string, ov::Tensor> m_unet_hidden_states;
+    // persistent UNet inputs, which are reused between steps and generations with the same shapes
+    ov::Tensor m_encoder_hidden_states_buffer, m_latent_cfg_buffer, m_model_input_buffer;
+    std::map<std::string, ov::Tensor> m_batched_hidden_states;
+    bool m_static_shapes = false;
 };
 
 }  // namespace genai
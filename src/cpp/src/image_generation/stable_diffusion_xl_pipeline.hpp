@@ -132,7 +132,8 @@ public:
         m_clip_text_encoder->reshape(batch_size_multiplier);
         m_clip_text_encoder_with_projection->reshape(batch_size_multiplier);
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
-        m_vae->reshape(num_images_per_prompt, height, width);
+        reshape_vae(*m_vae, num_images_per_prompt, height, width);
+        m_static_shapes = true;
     }
 
     void compile(const std::string& device, const ov::AnyMap& properties) override {
@@ -155,7 +156,7 @@ public:
                                        static_cast<float>(generation_config.width),
                                        static_cast<float>(generation_config.height),
                                        };
-        ov::Tensor add_time_ids(ov::element::f32, {batch_size_multiplier, time_ids.size()});
+        ov::Tensor add_time_ids = numpy_utils::reuse_buffer(m_time_ids_buffer, ov::element::f32, {batch_size_multiplier, time_ids.size()});
         float* add_time_ids_data = add_time_ids.data<float>();
         std::copy(time_ids.begin(), time_ids.end(), add_time_ids_data);
 
@@ -174,7 +175,7 @@ public:
         size_t idx_hidden_state_1 = m_clip_text_encoder->get_config().num_hidden_layers + 1;
         size_t idx_hidden_state_2 = m_clip_text_encoder_with_projection->get_config().num_hidden_layers + 1;
 
-        ov::Tensor encoder_hidden_states(ov::element::f32, {}), add_text_embeds(ov::element::f32, {});
+        ov::Tensor encoder_hidden_states, add_text_embeds;
 
         if (compute_negative_prompt) {
             add_text_embeds = m_clip_text_encoder_with_projection->infer(positive_prompt, negative_prompt_1_str, batch_size_multiplier > 1);
@@ -184,7 +185,7 @@ public:
             ov::Tensor encoder_hidden_states_1 = m_clip_text_encoder->get_output_tensor(idx_hidden_state_1);
             ov::Tensor encoder_hidden_states_2 = m_clip_text_encoder_with_projection->get_output_tensor(idx_hidden_state_2);
 
-            encoder_hidden_states = numpy_utils::concat(encoder_hidden_states_1, encoder_hidden_states_2, -1);
+            encoder_hidden_states = numpy_utils::concat(encoder_hidden_states_1, encoder_hidden_states_2, -1, m_prompt_embeds_buffer);
         } else {
             ov::Tensor add_text_embeds_positive = m_clip_text_encoder_with_projection->infer(positive_prompt, negative_prompt_1_str, false);
             m_clip_text_encoder->infer(prompt_2_str, negative_prompt_2_str, false);
@@ -202,8 +203,8 @@ public:
             add_text_embeds_shape[0] *= batch_size_multiplier;
             ov::Shape encoder_hidden_states_shape = {ehs_1_shape[0] * batch_size_multiplier, ehs_1_shape[1], ehs_1_shape[2] + ehs_2_shape[2]};
 
-            add_text_embeds.set_shape(add_text_embeds_shape);
-            encoder_hidden_states.set_shape(encoder_hidden_states_shape);
+            add_text_embeds = numpy_utils::reuse_buffer(m_pooled_prompt_embeds_buffer, ov::element::f32, add_text_embeds_shape);
+            encoder_hidden_states = numpy_utils::reuse_buffer(m_prompt_embeds_buffer, ov::element::f32, encoder_hidden_states_shape);
 
             float * add_text_embeds_data = add_text_embeds.data<float>();
             float * encoder_hidden_states_data = encoder_hidden_states.data<float>();
@@ -232,58 +233,15 @@ public:
             }
         }
 
-        // replicate encoder hidden state to UNet model
-        if (generation_config.num_images_per_prompt == 1) {
-            // reuse output of text encoder directly w/o extra memory copy
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
-            m_unet->set_hidden_states("text_embeds", add_text_embeds);
-            m_unet->set_hidden_states("time_ids", add_time_ids);
-        } else {
-            ov::Shape enc_shape = encoder_hidden_states.get_shape();
-            enc_shape[0] *= generation_config.num_images_per_prompt;
-
-            ov::Tensor encoder_hidden_states_repeated(encoder_hidden_states.get_element_type(), enc_shape);
-            for (size_t n = 0; n < generation_config.num_images_per_prompt; ++n) {
-                numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated, 0, n);
-                if (batch_size_multiplier > 1) {
-                    numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated,
-                        1, generation_config.num_images_per_prompt + n);
-                }
-            }
-
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
-
-            ov::Shape t_emb_shape = add_text_embeds.get_shape();
-            t_emb_shape[0] *= generation_config.num_images_per_prompt;
-
-            ov::Tensor add_text_embeds_repeated(add_text_embeds.get_element_type(), t_emb_shape);
-            for (size_t n = 0; n < generation_config.num_images_per_prompt; ++n) {
-                numpy_utils::batch_copy(add_text_embeds, add_text_embeds_repeated, 0, n);
-                if (batch_size_multiplier > 1) {
-                    numpy_utils::batch_copy(add_text_embeds, add_text_embeds_repeated,
-                        1, generation_config.num_images_per_prompt + n);
-                }
-            }
-
-            m_unet->set_hidden_states("text_embeds", add_text_embeds_repeated);
-
-            ov::Shape t_ids_shape = add_time_ids.get_shape();
-            t_ids_shape[0] *= generation_config.num_images_per_prompt;
-            ov::Tensor add_time_ids_repeated(add_time_ids.get_element_type(), t_ids_shape);
-            for (size_t n = 0; n < generation_config.num_images_per_prompt; ++n) {
-                numpy_utils::batch_copy(add_time_ids, add_time_ids_repeated, 0, n);
-                if (batch_size_multiplier > 1) {
-                    numpy_utils::batch_copy(add_time_ids, add_time_ids_repeated,
-                        1, generation_config.num_images_per_prompt + n);
-                }
-            }
-
-            m_unet->set_hidden_states("time_ids", add_time_ids_repeated);
-        }
+        // replicate encoder hidden state to UNet model, text encoders outputs are used directly for a single image
+        const size_t num_images_per_prompt = generation_config.num_images_per_prompt;
+        set_unet_hidden_states("encoder_hidden_states", numpy_utils::repeat_interleave(encoder_hidden_states, num_images_per_prompt, m_encoder_hidden_states_buffer));
+        set_unet_hidden_states("text_embeds", numpy_utils::repeat_interleave(add_text_embeds, num_images_per_prompt, m_text_embeds_buffer));
+        set_unet_hidden_states("time_ids", numpy_utils::repeat_interleave(add_time_ids, num_images_per_prompt, m_time_ids_repeated_buffer));
 
         if (unet_config.time_cond_proj_dim >= 0) { // LCM
             ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
-            m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            set_unet_hidden_states("timestep_cond", timestep_cond);
         }
     }
 
@@ -360,6 +318,9 @@ private:
     friend class Image2ImagePipeline;
 
     bool m_force_zeros_for_empty_prompt = true;
+    // text encoders outputs combined for UNet and their copies repeated per image, see 'compute_hidden_states'
+    ov::Tensor m_prompt_embeds_buffer, m_pooled_prompt_embeds_buffer, m_time_ids_buffer;
+    ov::Tensor m_text_embeds_buffer, m_time_ids_repeated_buffer;
     std::shared_ptr<CLIPTextModelWithProjection> m_clip_text_encoder_with_projection = nullptr;
 };
 
@@ -0,0 +1,161 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/static_shapes_cache.hpp"
+
+#include <chrono>
+
+namespace ov {
+namespace genai {
+
+StaticShapesCache::StaticShapesCache(PipelineFactory factory, const std::string& device, const ov::AnyMap& properties, size_t capacity)
+    : m_factory(factory),
+      m_device(device),
+      m_properties(properties),
+      m_capacity(capacity) {
+    OPENVINO_ASSERT(m_factory, "Pipeline factory must be set for static shapes cache");
+    OPENVINO_ASSERT(m_capacity > 0, "Static shapes cache capacity must be greater than 0");
+}
+
+StaticShapesCache::~StaticShapesCache() {
+    std::vector<std::shared_future<std::shared_ptr<DiffusionPipeline>>> pipelines;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const Entry& entry : m_entries) {
+            pipelines.push_back(entry.pipeline);
+        }
+    }
+
+    for (const auto& pipeline : pipelines) {
+        pipeline.wait();
+    }
+}
+
+std::string StaticShapesCache::get_key(const ImageGenerationConfig& generation_config) {
+    // all values > 1 are the same for reshape perspective, see 'reshape()'
+    const bool guidance = generation_config.guidance_scale > 1.0f;
+    return std::to_string(generation_config.num_images_per_prompt) + 'x' +
+           std::to_string(generation_config.height) + 'x' +
+           std::to_string(generation_config.width) + ':' +
+           std::to_string(guidance) + ':' +
+           std::to_string(generation_config.max_sequence_length);
+}
+
+std::shared_ptr<DiffusionPipeline> StaticShapesCache::get(const ImageGenerationConfig& generation_config) {
+    std::shared_future<std::shared_ptr<DiffusionPipeline>> pipeline;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        pipeline = find_or_compile(generation_config, true);
+    }
+
+    const auto wait_start = std::chrono::steady_clock::now();
+    // rethrows compilation errors
+    std::shared_ptr<DiffusionPipeline> compiled_pipeline = pipeline.get();
+    const auto wait_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - wait_start).count();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_metrics.wait_time_ms += wait_ms;
+    m_last_used = compiled_pipeline;
+    return compiled_pipeline;
+}
+
+void StaticShapesCache::precompile(const ImageGenerationConfig& generation_config) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    find_or_compile(generation_config, false);
+}
+
+void StaticShapesCache::set_scheduler(std::shared_ptr<Scheduler> scheduler) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_scheduler = scheduler;
+
+    // pipelines which are being compiled take the scheduler when compilation is finished
+    for (const Entry& entry : m_entries) {
+        if (entry.pipeline.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            try {
+                entry.pipeline.get()->set_scheduler(scheduler);
+            } catch (...) {
+                // failed compilation is reported by 'get'
+            }
+        }
+    }
+}
+
+std::shared_ptr<DiffusionPipeline> StaticShapesCache::get_last_used() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OPENVINO_ASSERT(m_last_used, "No pipeline has been used from static shapes cache yet");
+    return m_last_used;
+}
+
+StaticShapesCacheMetrics StaticShapesCache::get_metrics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    StaticShapesCacheMetrics metrics = m_metrics;
+    metrics.num_entries = m_entries.size();
+    return metrics;
+}
+
+std::shared_future<std::shared_ptr<DiffusionPipeline>> StaticShapesCache::find_or_compile(const ImageGenerationConfig& generation_config, bool count_metrics) {
+    const std::string key = get_key(generation_config);
+
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        if (count_metrics) {
+            ++m_metrics.hits;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->pipeline;
+    }
+
+    if (count_metrics) {
+        ++m_metrics.misses;
+    }
+
+    auto pipeline = std::async(std::launch::async, &StaticShapesCache::compile, this, generation_config).share();
+    m_entries.push_front({key, pipeline});
+    m_index.emplace(key, m_entries.begin());
+
+    evict();
+
+    return pipeline;
+}
+
+std::shared_ptr<DiffusionPipeline> StaticShapesCache::compile(ImageGenerationConfig generation_config) {
+    const auto compile_start = std::chrono::steady_clock::now();
+
+    std::shared_ptr<DiffusionPipeline> pipeline = m_factory();
+
+    // SD3 and FLUX read max_sequence_length for T5 encoder from generation config
+    ImageGenerationConfig default_config = pipeline->get_generation_config();
+    default_config.max_sequence_length = generation_config.max_sequence_length;
+    pipeline->set_generation_config(default_config);
+
+    pipeline->reshape(generation_config.num_images_per_prompt, generation_config.height, generation_config.width, generation_config.guidance_scale);
+    pipeline->compile(m_device, m_properties);
+
+    const auto compile_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - compile_start).count();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_scheduler) {
+        pipeline->set_scheduler(m_scheduler);
+    }
+    ++m_metrics.num_compilations;
+    m_metrics.compile_time_ms += compile_ms;
+
+    return pipeline;
+}
+
+void StaticShapesCache::evict() {
+    // entries which are being compiled are not evicted, so the cache can temporarily exceed its capacity
+    for (auto it = std::prev(m_entries.end()); m_entries.size() > m_capacity && it != m_entries.begin();) {
+        auto current = it--;
+        if (current->pipeline.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            continue;
+        }
+
+        m_index.erase(current->key);
+        m_entries.erase(current);
+        ++m_metrics.evictions;
+    }
+}
+
+} // namespace genai
+} // namespace ov
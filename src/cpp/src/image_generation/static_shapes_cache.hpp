@@ -0,0 +1,81 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
+
+#include "image_generation/diffusion_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * LRU cache of pipelines compiled for static shapes. Pipelines are keyed by num_images_per_prompt, height, width,
+ * classifier free guidance and max_sequence_length, which define shapes of all models within a pipeline.
+ * Pipelines are compiled by background tasks, so several shapes can be precompiled while other shapes are used.
+ */
+class StaticShapesCache {
+public:
+    // creates a new pipeline with models which are neither reshaped nor compiled
+    using PipelineFactory = std::function<std::shared_ptr<DiffusionPipeline>()>;
+
+    StaticShapesCache(PipelineFactory factory, const std::string& device, const ov::AnyMap& properties, size_t capacity);
+
+    // waits for background compilations, since they access the cache
+    ~StaticShapesCache();
+
+    // returns a pipeline compiled for shapes of a given generation config, waits if it's being compiled
+    std::shared_ptr<DiffusionPipeline> get(const ImageGenerationConfig& generation_config);
+
+    // starts compilation for shapes of a given generation config, if they are not cached yet
+    void precompile(const ImageGenerationConfig& generation_config);
+
+    // scheduler is set to all cached and future pipelines
+    void set_scheduler(std::shared_ptr<Scheduler> scheduler);
+
+    // returns a pipeline returned by the last 'get' call
+    std::shared_ptr<DiffusionPipeline> get_last_used() const;
+
+    StaticShapesCacheMetrics get_metrics() const;
+
+    static std::string get_key(const ImageGenerationConfig& generation_config);
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_future<std::shared_ptr<DiffusionPipeline>> pipeline;
+    };
+
+    // must be called under lock
+    std::shared_future<std::shared_ptr<DiffusionPipeline>> find_or_compile(const ImageGenerationConfig& generation_config, bool count_metrics);
+
+    std::shared_ptr<DiffusionPipeline> compile(ImageGenerationConfig generation_config);
+
+    void evict();
+
+    PipelineFactory m_factory;
+    std::string m_device;
+    ov::AnyMap m_properties;
+    size_t m_capacity;
+
+    mutable std::mutex m_mutex;
+    // most recently used entries are at the front
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    std::shared_ptr<Scheduler> m_scheduler = nullptr;
+    std::shared_ptr<DiffusionPipeline> m_last_used = nullptr;
+    StaticShapesCacheMetrics m_metrics;
+};
+
+} // namespace genai
+} // namespace ov
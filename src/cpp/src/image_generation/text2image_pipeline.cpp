@@ -11,13 +11,28 @@
 #include "image_generation/stable_diffusion_xl_pipeline.hpp"
 #include "image_generation/stable_diffusion_3_pipeline.hpp"
 #include "image_generation/flux_pipeline.hpp"
+#include "image_generation/diffusion_request_queue.hpp"
+#include "image_generation/static_shapes_cache.hpp"
 
 #include "utils.hpp"
 
 namespace ov {
 namespace genai {
 
-Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir) {
+namespace {
+
+// returns generation config, which defines shapes of models used by 'generate()' with given properties
+ImageGenerationConfig get_shapes_config(ImageGenerationConfig generation_config, const ov::AnyMap& properties) {
+    // don't reseed generator shared with the default generation config
+    generation_config.generator = nullptr;
+    generation_config.update_generation_config(properties);
+    return generation_config;
+}
+
+} // namespace
+
+Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir)
+    : m_models_path(root_dir) {
     const std::string class_name = get_class_name(root_dir);
 
     if (class_name == "StableDiffusionPipeline" || 
@@ -32,9 +47,12 @@ Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir) {
     } else {
         OPENVINO_THROW("Unsupported text to image generation pipeline '", class_name, "'");
     }
+
+    m_request_queue = std::make_shared<DiffusionRequestQueue>(m_impl);
 }
 
-Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir, const std::string& device, const ov::AnyMap& properties) {
+Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir, const std::string& device, const ov::AnyMap& properties)
+    : m_models_path(root_dir) {
     const std::string class_name = get_class_name(root_dir);
 
     if (class_name == "StableDiffusionPipeline" ||
@@ -49,6 +67,8 @@ Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir, co
     } else {
         OPENVINO_THROW("Unsupported text to image generation pipeline '", class_name, "'");
     }
+
+    m_request_queue = std::make_shared<DiffusionRequestQueue>(m_impl);
 }
 
 Text2ImagePipeline::Text2ImagePipeline(const Image2ImagePipeline& pipe) {
@@ -63,6 +83,8 @@ Text2ImagePipeline::Text2ImagePipeline(const Image2ImagePipeline& pipe) {
     } else {
         OPENVINO_ASSERT("Cannot convert specified Image2ImagePipeline to Text2ImagePipeline");
     }
+
+    m_request_queue = std::make_shared<DiffusionRequestQueue>(m_impl);
 }
 
 Text2ImagePipeline::Text2ImagePipeline(const InpaintingPipeline& pipe) {
@@ -77,11 +99,14 @@ Text2ImagePipeline::Text2ImagePipeline(const InpaintingPipeline& pipe) {
     } else {
         OPENVINO_ASSERT("Cannot convert specified InpaintingPipeline to Text2ImagePipeline");
     }
+
+    m_request_queue = std::make_shared<DiffusionRequestQueue>(m_impl);
 }
 
 Text2ImagePipeline::Text2ImagePipeline(const std::shared_ptr<DiffusionPipeline>& impl)
     : m_impl(impl) {
     assert(m_impl != nullptr);
+    m_request_queue = std::make_shared<DiffusionRequestQueue>(m_impl);
 }
 
 Text2ImagePipeline Text2ImagePipeline::stable_diffusion(
@@ -175,6 +200,9 @@ void Text2ImagePipeline::set_generation_config(const ImageGenerationConfig& gene
 
 void Text2ImagePipeline::set_scheduler(std::shared_ptr<Scheduler> scheduler) {
     m_impl->set_scheduler(scheduler);
+    if (m_static_shapes_cache) {
+        m_static_shapes_cache->set_scheduler(scheduler);
+    }
 }
 
 void Text2ImagePipeline::reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale) {
@@ -186,12 +214,53 @@ void Text2ImagePipeline::compile(const std::string& device, const ov::AnyMap& pr
 }
 
 ov::Tensor Text2ImagePipeline::generate(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    if (m_static_shapes_cache) {
+        const ImageGenerationConfig default_config = m_impl->get_generation_config();
+        std::shared_ptr<DiffusionPipeline> pipeline = m_static_shapes_cache->get(get_shapes_config(default_config, properties));
+        pipeline->set_generation_config(default_config);
+        return pipeline->generate(positive_prompt, {}, {}, properties);
+    }
+
     return m_impl->generate(positive_prompt, {}, {}, properties);
 }
 
+std::future<ov::Tensor> Text2ImagePipeline::generate_async(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    OPENVINO_ASSERT(m_static_shapes_cache == nullptr, "Asynchronous generation is not supported with static shapes cache");
+    return m_request_queue->add_request(positive_prompt, properties);
+}
+
 ov::Tensor Text2ImagePipeline::decode(const ov::Tensor latent) {
+    if (m_static_shapes_cache) {
+        return m_static_shapes_cache->get_last_used()->decode(latent);
+    }
+
     return m_impl->decode(latent);
 }
 
+void Text2ImagePipeline::enable_static_shapes_cache(const std::string& device, const ov::AnyMap& properties, size_t capacity) {
+    OPENVINO_ASSERT(!m_models_path.empty(), "Static shapes cache requires Text2ImagePipeline created from a models path");
+
+    const std::filesystem::path models_path = m_models_path;
+    auto factory = [models_path] () {
+        return Text2ImagePipeline(models_path).m_impl;
+    };
+
+    m_static_shapes_cache = std::make_shared<StaticShapesCache>(factory, device, properties, capacity);
+}
+
+void Text2ImagePipeline::precompile(const std::vector<ov::AnyMap>& shapes) {
+    OPENVINO_ASSERT(m_static_shapes_cache, "Static shapes cache must be enabled via 'enable_static_shapes_cache()' before 'precompile()'");
+
+    const ImageGenerationConfig default_config = m_impl->get_generation_config();
+    for (const ov::AnyMap& properties : shapes) {
+        m_static_shapes_cache->precompile(get_shapes_config(default_config, properties));
+    }
+}
+
+StaticShapesCacheMetrics Text2ImagePipeline::get_static_shapes_cache_metrics() const {
+    OPENVINO_ASSERT(m_static_shapes_cache, "Static shapes cache is not enabled");
+    return m_static_shapes_cache->get_metrics();
+}
+
 }  // namespace genai
 }  // namespace ov
@@ -41,6 +41,10 @@ public:
     // If we use beam search sampling with chat mode we need to remove last answer of the model from kv cache and add best answer to history 
     // so, let's keep info about amount of tokens to trim from kv cache and amount of tokens to keep in history
     ov::genai::utils::HistoryRemoveManager m_kv_history_manager = {0, 0};
+    // Chat template is rendered for the last exchange only, if it's checked to give the same text as rendering of the whole history
+    std::optional<bool> m_is_chat_template_incremental = std::nullopt;
+    // Position of the last answer in m_tokenized_chat_history
+    size_t m_answer_tokens_offset = 0;
 
     StatefulLLMPipeline(
         const ov::InferRequest& request,
@@ -139,57 +143,65 @@ public:
                 // KV cache contains it. So we have to add it manually or get it by tokenization all chat history.
 
                 m_history.push_back({{"role", "user"}, {"content", prompt}});
-                constexpr bool add_generation_prompt = true;
-                auto new_templated_chat_history  = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
-                // Do not add special tokens in chat scenario to be aligned with HF.
-                auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
-                auto prev_chat_tokens = m_tokenizer.encode(m_templated_chat_history, ov::genai::add_special_tokens(false));
-
-                // some symbols combinations can be encoded by the tokenizer in different ways
-                // if we met sequence with such combination of symbols, we cannot correctly subtract the new history from the old history
-                // so let's check it out, find the trusted part and use it in on the next step
-                size_t trusted_history_length = 0;
-                if (!m_tokenized_chat_history.empty()) {
-                    std::set<int64_t> stop_tokens = config.stop_token_ids;
-                    trusted_history_length = ov::genai::utils::get_first_history_difference(prev_chat_tokens.input_ids, m_tokenized_chat_history, stop_tokens);
-                    m_trust_encoded_history = trusted_history_length == SIZE_MAX;
-                }
-
-                if (m_tokenized_chat_history.empty()) {
-                    encoded_input = new_chat_tokens;
-                } else if (trusted_history_length != SIZE_MAX || m_kv_history_manager.does_kv_cache_need_to_update()) {
-                    // does_kv_cache_need_to_update will be true here if beam search is activated
-                    // in beam search mode we want to remove all history about last model answer from kv cache and add the best answer directly
-                    // if we have difference in model answer and decoded answer it anyway will be less then entire history, so let's use data from m_kv_history_manager
-                    if (m_kv_history_manager.does_kv_cache_need_to_update()) {
-                        trusted_history_length = m_kv_history_manager.trusted_history_length;
-                    } else {
-                        m_kv_history_manager.num_tokens_to_remove_from_kv_cache = m_tokenized_chat_history.size() - trusted_history_length;
-                        // if prev generation was finished because of max len was reached, kv cache is missed one last token, let's keep it
-                        m_kv_history_manager.num_tokens_to_remove_from_kv_cache -= m_last_disappeared_token.has_value() ? 1 : 0;
+                // To avoid templating and tokenization of the whole history on each turn, only the text appended to the templated
+                // history is tokenized together with a short window before it. If the window is tokenized the same way as
+                // the history, only the new tokens are used. Otherwise the whole history is tokenized as described above.
+                if (auto appended_input = encode_appended_chat_prompt(config.stop_token_ids)) {
+                    encoded_input = *appended_input;
+                } else {
+                    constexpr bool add_generation_prompt = true;
+                    auto new_templated_chat_history  = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
+                    // Do not add special tokens in chat scenario to be aligned with HF.
+                    auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+                    auto prev_chat_tokens = m_tokenizer.encode(m_templated_chat_history, ov::genai::add_special_tokens(false));
+
+                    // some symbols combinations can be encoded by the tokenizer in different ways
+                    // if we met sequence with such combination of symbols, we cannot correctly subtract the new history from the old history
+                    // so let's check it out, find the trusted part and use it in on the next step
+                    size_t trusted_history_length = 0;
+                    if (!m_tokenized_chat_history.empty()) {
+                        std::set<int64_t> stop_tokens = config.stop_token_ids;
+                        trusted_history_length = ov::genai::utils::get_first_history_difference(prev_chat_tokens.input_ids, m_tokenized_chat_history, stop_tokens);
+                        m_trust_encoded_history = trusted_history_length == SIZE_MAX;
                     }
 
-                    ov::Tensor new_tensor = ov::Tensor(new_chat_tokens.input_ids.get_element_type(),
-                                                       {1, new_chat_tokens.input_ids.get_shape().at(1) - trusted_history_length},
-                                                       new_chat_tokens.input_ids.data<int64_t>() + trusted_history_length);
+                    if (m_tokenized_chat_history.empty()) {
+                        encoded_input = new_chat_tokens;
+                    } else if (trusted_history_length != SIZE_MAX || m_kv_history_manager.does_kv_cache_need_to_update()) {
+                        // does_kv_cache_need_to_update will be true here if beam search is activated
+                        // in beam search mode we want to remove all history about last model answer from kv cache and add the best answer directly
+                        // if we have difference in model answer and decoded answer it anyway will be less then entire history, so let's use data from m_kv_history_manager
+                        if (m_kv_history_manager.does_kv_cache_need_to_update()) {
+                            trusted_history_length = m_kv_history_manager.trusted_history_length;
+                        } else {
+                            m_kv_history_manager.num_tokens_to_remove_from_kv_cache = m_tokenized_chat_history.size() - trusted_history_length;
+                            // if prev generation was finished because of max len was reached, kv cache is missed one last token, let's keep it
+                            m_kv_history_manager.num_tokens_to_remove_from_kv_cache -= m_last_disappeared_token.has_value() ? 1 : 0;
+                        }
 
-                    ov::Tensor new_attention_mask(ov::element::i64, new_tensor.get_shape());
-                    std::fill_n(new_attention_mask.data<int64_t>(), new_tensor.get_shape()[1], 1);
+                        ov::Tensor new_tensor = ov::Tensor(new_chat_tokens.input_ids.get_element_type(),
+                                                           {1, new_chat_tokens.input_ids.get_shape().at(1) - trusted_history_length},
+                                                           new_chat_tokens.input_ids.data<int64_t>() + trusted_history_length);
 
-                    encoded_input.input_ids = ov::Tensor(new_chat_tokens.input_ids.get_element_type(),
-                                                       {1, new_chat_tokens.input_ids.get_shape().at(1) - trusted_history_length});
-                    new_tensor.copy_to(encoded_input.input_ids);
-                    encoded_input.attention_mask = new_attention_mask;
-                    m_last_disappeared_token = std::nullopt;
-                } else {
-                    encoded_input = utils::subtract_chat_tokenized_inputs(new_chat_tokens, prev_chat_tokens);
-                }
-                m_templated_chat_history = new_templated_chat_history;
+                        ov::Tensor new_attention_mask(ov::element::i64, new_tensor.get_shape());
+                        std::fill_n(new_attention_mask.data<int64_t>(), new_tensor.get_shape()[1], 1);
 
-                m_tokenized_chat_history.clear();
-                m_tokenized_chat_history.reserve(new_chat_tokens.input_ids.get_size());
-                std::copy_n(new_chat_tokens.input_ids.data<int64_t>(), new_chat_tokens.input_ids.get_size(),
-                            std::back_inserter(m_tokenized_chat_history));
+                        encoded_input.input_ids = ov::Tensor(new_chat_tokens.input_ids.get_element_type(),
+                                                           {1, new_chat_tokens.input_ids.get_shape().at(1) - trusted_history_length});
+                        new_tensor.copy_to(encoded_input.input_ids);
+                        encoded_input.attention_mask = new_attention_mask;
+                        m_last_disappeared_token = std::nullopt;
+                    } else {
+                        encoded_input = utils::subtract_chat_tokenized_inputs(new_chat_tokens, prev_chat_tokens);
+                    }
+                    m_templated_chat_history = new_templated_chat_history;
+
+                    m_tokenized_chat_history.clear();
+                    m_tokenized_chat_history.reserve(new_chat_tokens.input_ids.get_size());
+                    std::copy_n(new_chat_tokens.input_ids.data<int64_t>(), new_chat_tokens.input_ids.get_size(),
+                                std::back_inserter(m_tokenized_chat_history));
+                }
+                m_answer_tokens_offset = m_tokenized_chat_history.size();
 
                 // TODO: Forbid LoRA config change if we are in the chat mode, because it requires regenerating the history with LoRA applied
             } else {
@@ -403,12 +415,100 @@ public:
         return result;
     }
 
+    // Returns the text to be appended to m_templated_chat_history for the last user message in m_history.
+    // If the chat template was checked to be incremental, only leading system messages and the last exchange are rendered.
+    std::optional<std::string> render_appended_chat_text() {
+        constexpr bool add_generation_prompt = true;
+        auto get_appended_text = [](const std::string& text, const std::string& history) -> std::optional<std::string> {
+            if (text.size() <= history.size() || text.compare(0, history.size(), history) != 0)
+                return std::nullopt;
+            return text.substr(history.size());
+        };
+
+        size_t num_system_messages = 0;
+        while (num_system_messages < m_history.size() && m_history[num_system_messages]["role"] == "system")
+            ++num_system_messages;
+        // previous user message, answer and the new user message
+        constexpr size_t exchange_size = 3;
+        const size_t history_size = m_history.size();
+        const bool is_exchange_rendered_alone = history_size > num_system_messages + exchange_size &&
+            m_history[history_size - 3]["role"] == "user" && m_history[history_size - 2]["role"] == "assistant";
+
+        auto render_exchange = [&]() -> std::optional<std::string> {
+            ChatHistory exchange(m_history.begin(), m_history.begin() + num_system_messages);
+            exchange.push_back(m_history[history_size - 3]);
+            std::string prev_exchange = m_tokenizer.apply_chat_template(exchange, add_generation_prompt) + m_history[history_size - 2]["content"];
+            exchange.insert(exchange.end(), m_history.end() - 2, m_history.end());
+            return get_appended_text(m_tokenizer.apply_chat_template(exchange, add_generation_prompt), prev_exchange);
+        };
+
+        if (is_exchange_rendered_alone && m_is_chat_template_incremental == true)
+            return render_exchange();
+
+        auto appended_text = get_appended_text(m_tokenizer.apply_chat_template(m_history, add_generation_prompt), m_templated_chat_history);
+        // templates can depend on position of a message, e.g. number rounds of a dialog, so check it once on the first long enough history
+        if (is_exchange_rendered_alone && !m_is_chat_template_incremental.has_value())
+            m_is_chat_template_incremental = appended_text.has_value() && render_exchange() == appended_text;
+        return appended_text;
+    }
+
+    // Tokenizes the text appended to the chat history for the last user message. Returns std::nullopt, if the history or tokens
+    // in KV cache cannot be continued with these tokens, then the whole history has to be tokenized.
+    std::optional<TokenizedInputs> encode_appended_chat_prompt(const std::set<int64_t>& stop_tokens) {
+        // beam search replaces the last answer in KV cache, see m_kv_history_manager
+        if (m_tokenized_chat_history.empty() || m_kv_history_manager.does_kv_cache_need_to_update() || m_history.size() < 2)
+            return std::nullopt;
+
+        const std::string& answer = m_history[m_history.size() - 2]["content"];
+        if (m_history[m_history.size() - 2]["role"] != "assistant" || m_templated_chat_history.size() < answer.size() ||
+            m_templated_chat_history.compare(m_templated_chat_history.size() - answer.size(), answer.size(), answer) != 0)
+            return std::nullopt;
+
+        std::optional<std::string> appended_text = render_appended_chat_text();
+        if (!appended_text.has_value())
+            return std::nullopt;
+
+        // long enough to cover merges of tokens at the beginning of the answer
+        constexpr size_t max_tail_length = 128;
+        const size_t prompt_end = m_templated_chat_history.size() - answer.size();
+        const size_t tail_start = utils::get_text_tail_start(m_templated_chat_history, prompt_end, max_tail_length);
+        const std::string tail = m_templated_chat_history.substr(tail_start, prompt_end - tail_start);
+
+        // Do not add special tokens in chat scenario to be aligned with HF.
+        auto tail_tokens = m_tokenizer.encode(tail, ov::genai::add_special_tokens(false));
+        auto window_tokens = m_tokenizer.encode(tail + answer + *appended_text, ov::genai::add_special_tokens(false));
+
+        // decoded answer loses the last stop token, it's missing in KV cache as well
+        std::vector<int64_t> answer_tokens(m_tokenized_chat_history.begin() + m_answer_tokens_offset, m_tokenized_chat_history.end());
+        if (!answer_tokens.empty() && stop_tokens.count(answer_tokens.back()))
+            answer_tokens.pop_back();
+
+        std::optional<size_t> offset = utils::get_appended_tokens_offset(window_tokens.input_ids, tail_tokens.input_ids, answer_tokens);
+        if (!offset.has_value())
+            return std::nullopt;
+
+        const int64_t* appended_tokens = window_tokens.input_ids.data<const int64_t>() + *offset;
+        const size_t num_appended_tokens = window_tokens.input_ids.get_size() - *offset;
+        TokenizedInputs encoded_input;
+        encoded_input.input_ids = ov::Tensor(ov::element::i64, {1, num_appended_tokens});
+        std::copy_n(appended_tokens, num_appended_tokens, encoded_input.input_ids.data<int64_t>());
+        encoded_input.attention_mask = ov::Tensor(ov::element::i64, {1, num_appended_tokens});
+        std::fill_n(encoded_input.attention_mask.data<int64_t>(), num_appended_tokens, 1);
+
+        m_templated_chat_history.append(*appended_text);
+        m_tokenized_chat_history.resize(m_answer_tokens_offset + answer_tokens.size());
+        m_tokenized_chat_history.insert(m_tokenized_chat_history.end(), appended_tokens, appended_tokens + num_appended_tokens);
+        m_trust_encoded_history = true;
+        return encoded_input;
+    }
+
     void start_chat(const std::string& system_message) override {
         is_chat_conversation = true;
         m_trust_encoded_history = true;
         m_kv_history_manager.reset();
         m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
         m_last_disappeared_token = std::nullopt;
+        m_is_chat_template_incremental = std::nullopt;
         if (!m_tokenized_chat_history.empty()) {
             reset_kv_state();
             m_history = {};
@@ -424,12 +524,106 @@ public:
         m_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
     }
 
+    // Processes templated system message of a new chat by the model
+    void prefill_chat_history() {
+        // Do not add special tokens in chat scenario to be aligned with HF.
+        auto encoded = m_tokenizer.encode(m_templated_chat_history, ov::genai::add_special_tokens(false));
+        m_model_runner.set_tensor("input_ids", encoded.input_ids);
+        m_model_runner.set_tensor("attention_mask", encoded.attention_mask);
+        if (m_model_runner.get_compiled_model().inputs().size() == 4) {
+            ov::Tensor position_ids(ov::element::i64, encoded.input_ids.get_shape());
+            utils::initialize_position_ids(position_ids, encoded.attention_mask);
+            m_model_runner.set_tensor("position_ids", position_ids);
+        }
+        ov::Tensor beam_idx(ov::element::i32, {1});
+        beam_idx.data<int32_t>()[0] = 0;
+        m_model_runner.set_tensor("beam_idx", beam_idx);
+        if (m_adapter_controller) {
+            m_adapter_controller->apply(m_model_runner, m_generation_config.adapters);
+        }
+        m_model_runner.infer();
+
+        const int64_t* tokens = encoded.input_ids.data<const int64_t>();
+        m_tokenized_chat_history.assign(tokens, tokens + encoded.input_ids.get_size());
+        m_answer_tokens_offset = m_tokenized_chat_history.size();
+    }
+
+    ChatSnapshot get_chat_snapshot() override {
+        OPENVINO_ASSERT(is_chat_conversation, "Chat snapshot can be taken only in chat mode, call start_chat() first");
+        if (m_tokenized_chat_history.empty() && !m_templated_chat_history.empty())
+            prefill_chat_history();
+
+        ChatSnapshot snapshot;
+        snapshot.m_chat_input_type = static_cast<int>(m_chat_input_type);
+        snapshot.m_history = m_history;
+        snapshot.m_templated_history = m_templated_chat_history;
+        snapshot.m_tokenized_history = m_tokenized_chat_history;
+        snapshot.m_answer_tokens_offset = m_answer_tokens_offset;
+        snapshot.m_last_disappeared_token = m_last_disappeared_token;
+        snapshot.m_num_tokens_to_remove_from_kv_cache = m_kv_history_manager.num_tokens_to_remove_from_kv_cache;
+        snapshot.m_trusted_history_length = m_kv_history_manager.trusted_history_length;
+        if (m_tokenized_chat_history.empty())
+            return snapshot;
+
+        snapshot.m_kv_cache_length = m_model_runner.get_tensor("attention_mask").get_shape().at(1);
+        for (auto& state : m_model_runner.query_state()) {
+            if (m_adapter_controller && m_adapter_controller->has_state_name(state.get_name()))
+                continue;
+            // state tensor can share memory with the plugin
+            ov::Tensor kv_cache = state.get_state();
+            ov::Tensor kv_cache_copy(kv_cache.get_element_type(), kv_cache.get_shape());
+            kv_cache.copy_to(kv_cache_copy);
+            snapshot.m_kv_cache.emplace(state.get_name(), kv_cache_copy);
+        }
+        return snapshot;
+    }
+
+    void restore_chat(const ChatSnapshot& snapshot) override {
+        finish_chat();
+        is_chat_conversation = true;
+        m_chat_input_type = static_cast<ov::genai::utils::GenerationChatInputsType>(snapshot.m_chat_input_type);
+        m_history = snapshot.m_history;
+        m_templated_chat_history = snapshot.m_templated_history;
+        m_tokenized_chat_history = snapshot.m_tokenized_history;
+        m_answer_tokens_offset = snapshot.m_answer_tokens_offset;
+        m_last_disappeared_token = snapshot.m_last_disappeared_token;
+        m_kv_history_manager.num_tokens_to_remove_from_kv_cache = snapshot.m_num_tokens_to_remove_from_kv_cache;
+        m_kv_history_manager.trusted_history_length = snapshot.m_trusted_history_length;
+        if (m_tokenized_chat_history.empty())
+            return;
+
+        // tensors of a loaded snapshot are memory mapped, they are copied if the plugin may keep them as states
+        const bool is_state_copied = utils::is_state_copied_on_set(m_model_runner);
+        size_t num_restored_states = 0;
+        for (auto& state : m_model_runner.query_state()) {
+            if (m_adapter_controller && m_adapter_controller->has_state_name(state.get_name()))
+                continue;
+            auto kv_cache = snapshot.m_kv_cache.find(state.get_name());
+            OPENVINO_ASSERT(kv_cache != snapshot.m_kv_cache.end(), "Chat snapshot doesn't contain state '", state.get_name(), "' of the model");
+            if (is_state_copied) {
+                state.set_state(kv_cache->second);
+            } else {
+                ov::Tensor kv_cache_copy(kv_cache->second.get_element_type(), kv_cache->second.get_shape());
+                kv_cache->second.copy_to(kv_cache_copy);
+                state.set_state(kv_cache_copy);
+            }
+            ++num_restored_states;
+        }
+        OPENVINO_ASSERT(num_restored_states == snapshot.m_kv_cache.size(), "Chat snapshot was taken for another model");
+
+        // attention mask of the history is continued by the next generate call
+        ov::Tensor attention_mask(ov::element::i64, {1, snapshot.m_kv_cache_length});
+        std::fill_n(attention_mask.data<int64_t>(), snapshot.m_kv_cache_length, 1);
+        m_model_runner.set_tensor("attention_mask", attention_mask);
+    }
+
     void finish_chat() override {
         is_chat_conversation = false;
         m_trust_encoded_history = true;
         m_kv_history_manager.reset();
         m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
         m_last_disappeared_token = std::nullopt;
+        m_is_chat_template_incremental = std::nullopt;
         if (!m_tokenized_chat_history.empty()) {
             reset_kv_state();
             m_history.clear();
@@ -816,6 +1010,14 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+ov::genai::ChatSnapshot ov::genai::LLMPipeline::get_chat_snapshot() {
+    return m_pimpl->get_chat_snapshot();
+}
+
+void ov::genai::LLMPipeline::restore_chat(const ChatSnapshot& snapshot) {
+    m_pimpl->restore_chat(snapshot);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     int64_t default_eos_token_id = m_pimpl->m_generation_config.eos_token_id;
     m_pimpl->m_generation_config = config;
@@ -32,6 +32,14 @@ public:
     virtual void start_chat(const std::string& system_message) = 0;
     virtual void finish_chat() = 0;
 
+    virtual ChatSnapshot get_chat_snapshot() {
+        OPENVINO_THROW("Chat snapshots are supported only by stateful LLMPipeline");
+    }
+
+    virtual void restore_chat(const ChatSnapshot&) {
+        OPENVINO_THROW("Chat snapshots are supported only by stateful LLMPipeline");
+    }
+
     virtual ~LLMPipelineImplBase() = default;
 
     Tokenizer m_tokenizer;
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cstdlib>
+#include <optional>
 
 #include <openvino/runtime/infer_request.hpp>
 
@@ -14,6 +15,7 @@
 #include "timer.hpp"
 
 #include "attention_output.hpp"
+#include "visual_language/embedding_model.hpp"
 
 namespace ov::genai {
 
@@ -32,6 +34,11 @@ class ModelRunner {
     AttentionScoresForEachSubsequence m_last_attention_scores;
     size_t m_num_decoder_layers, m_block_size;
     bool m_collect_attention_scores;
+    // set for models consuming inputs_embeds instead of input_ids, e.g. language models of VLMs
+    std::optional<EmbeddingsModel> m_embedding;
+    size_t m_hidden_size = 0;
+    // inputs_embeds passed to m_request, reused between forward calls
+    ov::Tensor m_inputs_embeds;
 public:
     /**
      * Constructs the ModelRunner.
@@ -56,6 +63,20 @@ public:
         return m_request;
     }
 
+    /**
+     * Makes the ModelRunner feed `inputs_embeds` instead of `input_ids`. Precomputed prompt embeddings of sequence groups
+     * are copied as is, embeddings of other tokens (generated ones and prompts without precomputed embeddings) are computed
+     * by the embedding model in a single inference per `forward` call.
+     * @param embedding The model converting token ids to embeddings, which must not be inferred concurrently from other threads.
+     */
+    void set_embedding_model(const EmbeddingsModel& embedding) {
+        const ov::PartialShape& inputs_embeds_shape = m_request.get_compiled_model().input("inputs_embeds").get_partial_shape();
+        OPENVINO_ASSERT(inputs_embeds_shape.rank().is_static() && inputs_embeds_shape[inputs_embeds_shape.size() - 1].is_static(),
+                        "inputs_embeds is expected to have static hidden size, got ", inputs_embeds_shape);
+        m_hidden_size = inputs_embeds_shape[inputs_embeds_shape.size() - 1].get_length();
+        m_embedding = embedding;
+    }
+
     /**
      * @return A map of sequence IDs to vectors of ov::Tensor per-token attention scores. Each vector element is associated with its own
      * decoder layer, in order of their execution in the model. Each ov::Tensor has a shape of {N_k}, where N_k is the length of
@@ -101,6 +122,18 @@ public:
 
         max_context_len.data<int32_t>()[0] = max_context_len_val;
 
+        // rows of inputs_embeds to be filled with embeddings of tokens, which are not precomputed
+        std::vector<size_t> token_rows;
+        TokenIds tokens_to_embed;
+        if (m_embedding) {
+            // set_shape() reallocates memory only if the tensor grows beyond its capacity
+            if (m_inputs_embeds) {
+                m_inputs_embeds.set_shape({total_num_tokens, m_hidden_size});
+            } else {
+                m_inputs_embeds = ov::Tensor(ov::element::f32, {total_num_tokens, m_hidden_size});
+            }
+        }
+
         // get raw pointers to copy to
         int64_t
             * input_ids_data = input_ids.data<int64_t>(),
@@ -126,6 +159,10 @@ public:
             // context_len corresponds to first token within subgroup of scheduled tokens
             size_t group_context_len = group_position_id;
 
+            const ov::Tensor& prompt_embeds = sequence_group->get_prompt_embeds();
+            OPENVINO_ASSERT(!prompt_embeds || prompt_embeds.get_shape().back() == m_hidden_size,
+                            "Hidden size of prompt embeddings ", prompt_embeds.get_shape(), " doesn't match hidden size of the model ", m_hidden_size);
+
             for (size_t seq_id = 0; seq_id < num_running_sequences; ++seq_id) {
                 Sequence::CPtr sequence = running_sequences[seq_id];
 
@@ -136,6 +173,17 @@ public:
                         sequence->get_generated_ids()[position_id - sequence_group->get_prompt_len()];
 
                     position_ids_data[token_id] = position_id;
+
+                    if (m_embedding) {
+                        size_t row = input_ids_data - input_ids.data<int64_t>() + token_id;
+                        if (prompt_embeds && position_id < sequence_group->get_prompt_len()) {
+                            std::copy_n(prompt_embeds.data<float>() + position_id * m_hidden_size, m_hidden_size,
+                                        m_inputs_embeds.data<float>() + row * m_hidden_size);
+                        } else {
+                            token_rows.push_back(row);
+                            tokens_to_embed.push_back(input_ids_data[token_id]);
+                        }
+                    }
                 }
 
                 size_t expected_kv_cache_size = sequence_group->get_num_processed_tokens() - sequence_group->get_num_evicted_tokens();
@@ -156,7 +204,12 @@ public:
         }
 
         // typical LLM parameters
-        m_request.set_tensor("input_ids", input_ids);
+        if (m_embedding) {
+            _embed_tokens(m_inputs_embeds, token_rows, tokens_to_embed);
+            m_request.set_tensor("inputs_embeds", m_inputs_embeds);
+        } else {
+            m_request.set_tensor("input_ids", input_ids);
+        }
         m_request.set_tensor("position_ids", position_ids);
 
         // PA specific parameters
@@ -193,6 +246,28 @@ public:
     }
 
 private:
+    void _embed_tokens(ov::Tensor& inputs_embeds, const std::vector<size_t>& token_rows, const TokenIds& tokens) {
+        if (tokens.empty()) {
+            return;
+        }
+
+        ov::Tensor token_ids(ov::element::i64, {1, tokens.size()}, const_cast<int64_t*>(tokens.data()));
+        if (token_rows.size() == inputs_embeds.get_shape().at(0)) {
+            // no precomputed embeddings in the batch, so rows go in order and are written in place
+            ov::Tensor embeds(ov::element::f32, {1, tokens.size(), m_hidden_size}, inputs_embeds.data<float>());
+            m_embedding->infer(token_ids, embeds);
+            return;
+        }
+
+        // [1, tokens.size(), hidden_size]
+        ov::Tensor embeds = m_embedding->infer(token_ids);
+        const float* embeds_data = embeds.data<const float>();
+        float* inputs_embeds_data = inputs_embeds.data<float>();
+        for (size_t i = 0; i < token_rows.size(); ++i) {
+            std::copy_n(embeds_data + i * m_hidden_size, m_hidden_size, inputs_embeds_data + token_rows[i] * m_hidden_size);
+        }
+    }
+
     void _set_block_indices(ov::InferRequest& infer_request, const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output,
                             size_t total_num_blocks) {
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
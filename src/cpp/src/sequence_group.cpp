@@ -24,7 +24,7 @@ size_t Sequence::_make_hash(size_t content_length) {
         content.insert(content.end(), m_prefix_hashes.begin(), m_prefix_hashes.begin() + prefix_hashes_needed_count);
 
         // get tokens corresponding to current block
-        const auto prompt_ids = sequence_group->get_prompt_ids();
+        const auto& prompt_ids = sequence_group->get_prompt_hash_ids();
         OPENVINO_ASSERT(content_length <= prompt_ids.size() + m_generated_ids.size());
         if (block_start_idx < prompt_ids.size()) {
             content.insert(content.end(), prompt_ids.begin() + block_start_idx, prompt_ids.begin() + std::min(prompt_ids.size(), content_length));
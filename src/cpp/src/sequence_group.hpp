@@ -204,6 +204,10 @@ class SequenceGroup {
     ov::genai::GenerationConfig m_sampling_params;
     std::size_t m_block_size;
     TokenIds m_prompt_ids;
+    // precomputed embeddings of prompt tokens [1, prompt_len, hidden_size], e.g. merged text and image embeddings of VLM prompts
+    ov::Tensor m_prompt_embeds;
+    // values hashed by prefix caching instead of prompt ids, when prompt ids don't identify prompt embeddings
+    TokenIds m_prompt_hash_ids;
     std::vector<float> m_prompt_log_probs;
     GenerationStream::Ptr m_generation_stream;
     bool m_enable_prefix_caching;
@@ -502,6 +506,28 @@ public:
         return m_prompt_ids;
     }
 
+    /**
+     * Sets precomputed prompt embeddings, which are fed to the model instead of embeddings of prompt ids.
+     * @param prompt_embeds Embeddings of shape [1, prompt_len, hidden_size]
+     * @param prompt_hash_ids Values identifying content of each prompt position for prefix caching, e.g. prompt ids
+     * mixed with hashes of images, so prompts with the same ids, but different images don't share KV blocks
+     */
+    void set_prompt_embeds(const ov::Tensor& prompt_embeds, const TokenIds& prompt_hash_ids) {
+        OPENVINO_ASSERT(prompt_embeds.get_shape().size() == 3 && prompt_embeds.get_shape()[1] == get_prompt_len(),
+                        "Prompt embeddings are expected to have shape [1, ", get_prompt_len(), ", hidden_size], got ", prompt_embeds.get_shape());
+        OPENVINO_ASSERT(prompt_hash_ids.size() == get_prompt_len(), "Prompt hash ids must have the same length as prompt ids");
+        m_prompt_embeds = prompt_embeds;
+        m_prompt_hash_ids = prompt_hash_ids;
+    }
+
+    const ov::Tensor& get_prompt_embeds() const {
+        return m_prompt_embeds;
+    }
+
+    const TokenIds& get_prompt_hash_ids() const {
+        return m_prompt_hash_ids.empty() ? m_prompt_ids : m_prompt_hash_ids;
+    }
+
     void append_prompt_log_prob(float log_prob) {
         m_prompt_log_probs.push_back(log_prob);
     }
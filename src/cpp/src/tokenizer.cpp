@@ -3,6 +3,9 @@
 
 #include <filesystem>
 #include <fstream>
+#include <deque>
+#include <functional>
+#include <list>
 #include <memory>
 #include <jinja2cpp/template.h>
 #include <jinja2cpp/template_env.h>
@@ -10,6 +13,7 @@
 #include <jinja2cpp/generic_list.h>
 #include <jinja2cpp/generic_list_iterator.h>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -19,42 +23,10 @@
 #include "circular_buffer_queue.hpp"
 #include "json_utils.hpp"
 #include "utils.hpp"
+#include "vocab_detokenizer.hpp"
 
 namespace {
 
-// todo: remove when openvino-tokenizers will support left padding
-ov::genai::TokenizedInputs pad_left(ov::Tensor& input_ids, ov::Tensor& attention_mask) {
-    const size_t batch_size = input_ids.get_shape()[0];
-    const size_t sequence_length = input_ids.get_shape()[1];
-    int64_t* inputs_data = input_ids.data<int64_t>();
-    int64_t* attention_mask_data = attention_mask.data<int64_t>();
-
-    for (size_t batch = 0; batch < batch_size; batch++) {
-        const size_t batch_offset = batch * sequence_length;
-
-        // last token in the sequence is not a PAD_TOKEN, skipping
-        if (attention_mask_data[batch_offset + sequence_length - 1] == 1)
-            continue;
-
-        size_t pad_tokens_number = 0;
-        for (int i = sequence_length - 1; i >= 0; i--) {
-            const size_t token_offset = batch_offset + i;
-
-            // count pad tokens
-            if (attention_mask_data[token_offset] == 0)
-                continue;
-
-            if (pad_tokens_number == 0)
-                pad_tokens_number = sequence_length - i - 1;
-
-            std::swap(inputs_data[token_offset], inputs_data[token_offset + pad_tokens_number]);
-            std::swap(attention_mask_data[token_offset], attention_mask_data[token_offset + pad_tokens_number]);
-        }
-    }
-
-    return {input_ids, attention_mask};
-}
-
 void check_arguments(const ov::AnyMap& parameters, std::set<std::string> allowed_argnames) {
     for (const auto& [key, value] : parameters) {
         if (allowed_argnames.find(key) == allowed_argnames.end()) {
@@ -94,7 +66,7 @@ public:
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_detokenizer;
 
     // To change the adding special tokens mode we use a statefull subgraph,
-    // this flag holds the current state value of the CompiledModel.
+    // these flags hold the last requested mode, which is set into states of infer requests when they are used.
     bool m_add_special_tokens = true;
     bool m_skip_special_tokens = true;
     bool m_older_than_24_5 = false;
@@ -109,19 +81,15 @@ public:
 
     std::string m_chat_template = {};
 
-    void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params) {
-        bool add_special_tokens_flag = m_add_special_tokens;
-        bool skip_special_tokens_flag = m_skip_special_tokens;
+    // Decodes single sequences without inference of the detokenizer model, if the model is supported and gives the same results
+    std::shared_ptr<VocabDetokenizer> m_vocab_detokenizer;
 
-        ov::genai::utils::read_anymap_param(params, add_special_tokens.name(), add_special_tokens_flag);
-        ov::genai::utils::read_anymap_param(params, skip_special_tokens.name(), skip_special_tokens_flag);
+    // add_special_tokens and skip_special_tokens flags set into states of each infer request,
+    // the mutex guards m_add_special_tokens and m_skip_special_tokens as well
+    std::mutex m_infer_request_flags_mutex;
+    std::unordered_map<const ov::InferRequest*, std::pair<bool, bool>> m_infer_request_flags;
 
-        // If user requested add_special_tokens mode different from the current one,
-        // need to set state variable.
-        // If requested mode matches the stored state set, then don't touch states.
-        if (add_special_tokens_flag == m_add_special_tokens && skip_special_tokens_flag == m_skip_special_tokens) {
-            return;
-        }
+    void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params) {
         if (m_older_than_24_5) {
             // Changing add_special_tokens at runtime was introduced in
             // 24.5. Older tokenizers still allow manipulating their
@@ -129,6 +97,27 @@ public:
             return;
         }
 
+        bool add_special_tokens_flag, skip_special_tokens_flag;
+        // If user requested add_special_tokens mode different from the one set into states of this infer request,
+        // need to set state variable.
+        // If requested mode matches the stored state set, then don't touch states.
+        {
+            std::lock_guard<std::mutex> lock(m_infer_request_flags_mutex);
+            add_special_tokens_flag = m_add_special_tokens;
+            skip_special_tokens_flag = m_skip_special_tokens;
+            ov::genai::utils::read_anymap_param(params, add_special_tokens.name(), add_special_tokens_flag);
+            ov::genai::utils::read_anymap_param(params, skip_special_tokens.name(), skip_special_tokens_flag);
+            m_add_special_tokens = add_special_tokens_flag;
+            m_skip_special_tokens = skip_special_tokens_flag;
+
+            // states of a new infer request have default values
+            auto& flags = m_infer_request_flags.emplace(&infer_request_guard.get(), std::make_pair(true, true)).first->second;
+            if (flags == std::make_pair(add_special_tokens_flag, skip_special_tokens_flag)) {
+                return;
+            }
+            flags = {add_special_tokens_flag, skip_special_tokens_flag};
+        }
+
         // add_special_tokens is managed by Select op with a bool input.
         ov::Tensor add_special_tensor = ov::Tensor(ov::element::boolean, {});
         *add_special_tensor.data<bool>() = add_special_tokens_flag;
@@ -144,8 +133,6 @@ public:
                 state.set_state(skip_special_tensor);
             }
         }
-        m_add_special_tokens = add_special_tokens_flag;
-        m_skip_special_tokens = skip_special_tokens_flag;
     }
 
     TokenizerImpl() = default;
@@ -220,6 +207,8 @@ public:
         }
 
         if (ov_detokenizer) {
+            m_vocab_detokenizer = VocabDetokenizer::create(ov_detokenizer, core);
+
             ov::pass::Manager manager_detok;
             manager_detok.register_pass<MakeVocabDecoderSatateful>();
             manager_detok.run_passes(ov_detokenizer);
@@ -231,6 +220,10 @@ public:
                 [this]() -> ov::InferRequest {
                     return std::move(this->m_detokenizer.create_infer_request());
                 });
+
+            if (m_vocab_detokenizer && !is_vocab_detokenizer_matching_model()) {
+                m_vocab_detokenizer = nullptr;
+            }
         }
 
         // Initialize tokenizer's cache to save time later.
@@ -401,24 +394,150 @@ public:
         );
     }
 
-    TokenizedInputs encode(std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
+    // Batches are split across infer requests only if each of them gets at least this number of prompts
+    static constexpr size_t MIN_SHARD_SIZE = 16;
+
+    using InferRequestGuard = CircularBufferQueueElementGuard<ov::InferRequest>;
+
+    // prompts [begin, begin + size) tokenized by an infer request
+    struct EncodeShard {
+        std::unique_ptr<InferRequestGuard> guard;
+        size_t begin;
+        size_t size;
+
+        EncodeShard(std::unique_ptr<InferRequestGuard> guard, size_t begin, size_t size) :
+            guard(std::move(guard)), begin(begin), size(size) {}
+        EncodeShard(EncodeShard&&) = default;
+        EncodeShard& operator=(EncodeShard&&) = default;
+
+        // infer request must not be returned to the pool while it's running, e.g. if other shard or a callback throws
+        ~EncodeShard() {
+            if (!guard)
+                return;
+            try {
+                guard->get().wait();
+            } catch (...) {
+                // the error is reported by the shard, which was waited for first
+            }
+        }
+    };
+
+    TokenizedInputs encode(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
         OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                                 "Tokenizer::encode is not available");
-        TokenizedInputs unpadded;
-        {
-            CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_tokenizer.get());
-            set_state_if_necessary(infer_request_guard, tokenization_params);
-            infer_request_guard.get().set_input_tensor(ov::Tensor{ov::element::string, {prompts.size()}, prompts.data()});
-            auto size_ = infer_request_guard.get().get_input_tensor().get_shape();
-            infer_request_guard.get().start_async();
-            infer_request_guard.get().wait();
-
-            unpadded = get_copied_results(
-                infer_request_guard.get().get_output_tensor(0),
-                infer_request_guard.get().get_output_tensor(1)
-            );
-        }
-        return pad_left(unpadded.input_ids, unpadded.attention_mask);
+        // The first infer request is waited for, others are taken only if they are idle.
+        // So concurrent calls share the pool and don't wait for each other.
+        std::vector<std::unique_ptr<InferRequestGuard>> guards;
+        guards.push_back(std::make_unique<InferRequestGuard>(m_ireq_queue_tokenizer.get()));
+        const size_t max_num_shards = std::min(m_ireq_queue_tokenizer->size(), prompts.size() / MIN_SHARD_SIZE);
+        while (guards.size() < max_num_shards) {
+            int idle = m_ireq_queue_tokenizer->try_get_idle();
+            if (idle < 0)
+                break;
+            guards.push_back(std::make_unique<InferRequestGuard>(m_ireq_queue_tokenizer.get(), idle));
+        }
+
+        std::vector<EncodeShard> shards;
+        size_t begin = 0;
+        for (size_t i = 0; i < guards.size(); ++i) {
+            const size_t size = prompts.size() / guards.size() + (i < prompts.size() % guards.size() ? 1 : 0);
+            shards.push_back(start_encode(std::move(guards[i]), prompts, begin, size, tokenization_params));
+            begin += size;
+        }
+        return merge_left_padded(shards);
+    }
+
+    void encode_batches(const std::vector<std::string>& prompts,
+                        size_t batch_size,
+                        const std::function<bool(size_t, TokenizedInputs)>& callback,
+                        const ov::AnyMap& tokenization_params = {}) {
+        OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
+                                                "Tokenizer::encode is not available");
+        OPENVINO_ASSERT(batch_size > 0, "batch_size must be greater than 0");
+
+        std::deque<EncodeShard> in_flight;
+        size_t next_prompt = 0;
+        while (next_prompt < prompts.size() || !in_flight.empty()) {
+            if (next_prompt < prompts.size()) {
+                // waits for an infer request only if there is no batch in flight, otherwise the oldest batch is returned first
+                std::unique_ptr<InferRequestGuard> guard;
+                if (in_flight.empty()) {
+                    guard = std::make_unique<InferRequestGuard>(m_ireq_queue_tokenizer.get());
+                } else if (int idle = m_ireq_queue_tokenizer->try_get_idle(); idle >= 0) {
+                    guard = std::make_unique<InferRequestGuard>(m_ireq_queue_tokenizer.get(), idle);
+                }
+                if (guard) {
+                    const size_t size = std::min(batch_size, prompts.size() - next_prompt);
+                    in_flight.push_back(start_encode(std::move(guard), prompts, next_prompt, size, tokenization_params));
+                    next_prompt += size;
+                    continue;
+                }
+            }
+
+            std::vector<EncodeShard> finished;
+            finished.push_back(std::move(in_flight.front()));
+            in_flight.pop_front();
+            const size_t batch_begin = finished.front().begin;
+            TokenizedInputs batch = merge_left_padded(finished);
+            // returns the infer request to the pool before the callback
+            finished.clear();
+
+            // shards in flight are waited for by their destructors
+            if (callback(batch_begin, batch)) {
+                return;
+            }
+        }
+    }
+
+    EncodeShard start_encode(std::unique_ptr<InferRequestGuard> guard,
+                             const std::vector<std::string>& prompts,
+                             size_t begin,
+                             size_t size,
+                             const ov::AnyMap& tokenization_params) {
+        set_state_if_necessary(*guard, tokenization_params);
+        // string input tensor is only read by the tokenizer
+        guard->get().set_input_tensor(ov::Tensor{ov::element::string, {size}, const_cast<std::string*>(prompts.data() + begin)});
+        guard->get().start_async();
+        return {std::move(guard), begin, size};
+    }
+
+    // Waits for the shards and copies their right padded outputs into one left padded batch.
+    // todo: remove left padding when openvino-tokenizers will support it
+    TokenizedInputs merge_left_padded(std::vector<EncodeShard>& shards) {
+        size_t batch_size = 0, max_length = 0;
+        for (auto& shard : shards) {
+            shard.guard->get().wait();
+            batch_size += shard.size;
+            max_length = std::max(max_length, shard.guard->get().get_output_tensor(0).get_shape().at(1));
+        }
+
+        ov::Tensor input_ids(ov::element::i64, {batch_size, max_length});
+        ov::Tensor attention_mask(ov::element::i64, {batch_size, max_length});
+        const int64_t pad_token_id = m_pad_token_id != -1 ? m_pad_token_id : 0;
+        size_t first_row = 0;
+        for (auto& shard : shards) {
+            const ov::Tensor shard_input_ids = shard.guard->get().get_output_tensor(0);
+            const ov::Tensor shard_attention_mask = shard.guard->get().get_output_tensor(1);
+            const size_t length = shard_input_ids.get_shape().at(1);
+            const int64_t* shard_input_ids_data = shard_input_ids.data<const int64_t>();
+            const int64_t* shard_attention_mask_data = shard_attention_mask.data<const int64_t>();
+            int64_t* input_ids_data = input_ids.data<int64_t>() + first_row * max_length;
+            int64_t* attention_mask_data = attention_mask.data<int64_t>() + first_row * max_length;
+
+            ov::parallel_for(shard.size, [&](size_t row) {
+                const int64_t* row_attention_mask = shard_attention_mask_data + row * length;
+                size_t num_tokens = length;
+                while (num_tokens > 0 && row_attention_mask[num_tokens - 1] == 0)
+                    --num_tokens;
+                const size_t num_pads = max_length - num_tokens;
+                std::fill_n(input_ids_data + row * max_length, num_pads, pad_token_id);
+                std::fill_n(attention_mask_data + row * max_length, num_pads, 0);
+                std::copy_n(shard_input_ids_data + row * length, num_tokens, input_ids_data + row * max_length + num_pads);
+                std::copy_n(row_attention_mask, num_tokens, attention_mask_data + row * max_length + num_pads);
+            });
+            first_row += shard.size;
+        }
+        return {input_ids, attention_mask};
     }
 
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
@@ -433,6 +552,20 @@ public:
     std::string decode(std::vector<int64_t> tokens, const ov::AnyMap& detokenization_params = {}) {
         OPENVINO_ASSERT(m_detokenizer, "Detokenize model has not been provided. Tokenizer::decode is not available");
 
+        if (m_vocab_detokenizer) {
+            bool skip_special_tokens_flag;
+            {
+                std::lock_guard<std::mutex> lock(m_infer_request_flags_mutex);
+                skip_special_tokens_flag = m_skip_special_tokens;
+                ov::genai::utils::read_anymap_param(detokenization_params, skip_special_tokens.name(), skip_special_tokens_flag);
+                // older tokenizers always skip special tokens, see set_state_if_necessary
+                if (!m_older_than_24_5) {
+                    m_skip_special_tokens = skip_special_tokens_flag;
+                }
+            }
+            return m_vocab_detokenizer->decode(tokens, skip_special_tokens_flag || m_older_than_24_5);
+        }
+
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
         set_state_if_necessary(infer_request_guard, detokenization_params);
         size_t batch_size = 1;
@@ -486,6 +619,34 @@ public:
         return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
     }
 
+    // Compares VocabDetokenizer with the detokenizer model on a sample of the vocab, special tokens and their sequences
+    bool is_vocab_detokenizer_matching_model() {
+        constexpr size_t max_sample_size = 4096, sequence_length = 8;
+        const size_t vocab_size = m_vocab_detokenizer->get_vocab_size();
+        std::vector<int64_t> sample = m_vocab_detokenizer->get_special_tokens();
+        for (size_t token = 0; token < vocab_size; token += std::max<size_t>(1, vocab_size / max_sample_size)) {
+            sample.push_back(token);
+        }
+        sample.resize(sample.size() / sequence_length * sequence_length);
+        if (sample.empty()) {
+            return false;
+        }
+
+        for (bool skip_special_tokens_flag : {false, true}) {
+            const ov::AnyMap params = {{skip_special_tokens.name(), skip_special_tokens_flag}};
+            for (const ov::Shape& shape : {ov::Shape{sample.size(), 1}, ov::Shape{sample.size() / sequence_length, sequence_length}}) {
+                const std::vector<std::string> expected = decode(ov::Tensor{ov::element::i64, shape, sample.data()}, params);
+                for (size_t row = 0; row < shape[0]; ++row) {
+                    std::vector<int64_t> tokens(sample.begin() + row * shape[1], sample.begin() + (row + 1) * shape[1]);
+                    if (m_vocab_detokenizer->decode(tokens, skip_special_tokens_flag || m_older_than_24_5) != expected[row]) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
     std::string patch_chat_template(std::string template_str) const {
         // Replace what jinja2cpp doesn't support
         std::pair<std::string, std::string> replace_str_map[] = {
@@ -526,21 +687,65 @@ public:
         return patch_chat_template(res);
     }
 
-    std::string apply_chat_template(ChatHistory history,
-                                    bool add_generation_prompt,
-                                    const std::string& chat_template) const {
-        std::string chat_tpl = chat_template.empty() ? m_chat_template : patch_chat_template(chat_template);
+    // Parsed chat template. Template keeps a pointer to the environment, so it's never moved.
+    struct CompiledChatTemplate {
+        jinja2::TemplateEnv env;
+        jinja2::Template tpl{&env};
+        jinja2::UserCallable slice_callable;
+    };
+
+    // Max number of different template strings, which parsed templates are kept for
+    static constexpr size_t MAX_CACHED_CHAT_TEMPLATES = 8;
+
+    struct IdleChatTemplates {
+        std::list<std::string>::iterator lru_position;
+        std::vector<std::unique_ptr<CompiledChatTemplate>> templates;
+    };
+
+    // Idle parsed templates by patched template strings, least recently used template strings are evicted.
+    // Rendering the same Template from several threads isn't safe, so a template is taken out of the cache for rendering.
+    // The mutex guards m_chat_template as well.
+    mutable std::mutex m_chat_templates_mutex;
+    // most recently used template strings are at the front
+    mutable std::list<std::string> m_chat_templates_lru;
+    mutable std::unordered_map<std::string, IdleChatTemplates> m_idle_chat_templates;
+
+    // Returns patched template to render, m_chat_template if chat_template is empty
+    std::string get_chat_template(const std::string& chat_template) const {
+        std::string chat_tpl;
+        if (chat_template.empty()) {
+            std::lock_guard<std::mutex> lock(m_chat_templates_mutex);
+            chat_tpl = m_chat_template;
+        } else {
+            chat_tpl = patch_chat_template(chat_template);
+        }
         OPENVINO_ASSERT(!chat_tpl.empty(),
                         "Chat template wasn't found. This may indicate that the model wasn't trained for chat scenario."
                         " Please add 'chat_template' to tokenizer_config.json to use the model in chat scenario."
                         " For more information see the section Troubleshooting in README.md");
-        jinja2::TemplateEnv env;
-        env.GetSettings().lstripBlocks = true;
-        env.GetSettings().trimBlocks = true;
-        jinja2::Template tpl(&env);
-        tpl.Load(chat_tpl);
+        return chat_tpl;
+    }
 
-        jinja2::UserCallable slice_callable = jinja2::MakeCallable(
+    std::unique_ptr<CompiledChatTemplate> acquire_chat_template(const std::string& chat_tpl) const {
+        {
+            std::lock_guard<std::mutex> lock(m_chat_templates_mutex);
+            auto idle = m_idle_chat_templates.find(chat_tpl);
+            if (idle != m_idle_chat_templates.end()) {
+                m_chat_templates_lru.splice(m_chat_templates_lru.begin(), m_chat_templates_lru, idle->second.lru_position);
+            }
+            if (idle != m_idle_chat_templates.end() && !idle->second.templates.empty()) {
+                std::unique_ptr<CompiledChatTemplate> compiled = std::move(idle->second.templates.back());
+                idle->second.templates.pop_back();
+                return compiled;
+            }
+        }
+
+        auto compiled = std::make_unique<CompiledChatTemplate>();
+        compiled->env.GetSettings().lstripBlocks = true;
+        compiled->env.GetSettings().trimBlocks = true;
+        compiled->tpl.Load(chat_tpl);
+
+        compiled->slice_callable = jinja2::MakeCallable(
             [](const jinja2::GenericList& messages, const size_t& start) {
                 jinja2::ValuesList result;
 
@@ -555,6 +760,28 @@ public:
             },
             jinja2::ArgInfo{"messages"}, jinja2::ArgInfo{"start"}
         );
+        return compiled;
+    }
+
+    void release_chat_template(const std::string& chat_tpl, std::unique_ptr<CompiledChatTemplate> compiled) const {
+        std::lock_guard<std::mutex> lock(m_chat_templates_mutex);
+        auto idle = m_idle_chat_templates.find(chat_tpl);
+        if (idle == m_idle_chat_templates.end()) {
+            if (m_idle_chat_templates.size() >= MAX_CACHED_CHAT_TEMPLATES) {
+                m_idle_chat_templates.erase(m_chat_templates_lru.back());
+                m_chat_templates_lru.pop_back();
+            }
+            m_chat_templates_lru.push_front(chat_tpl);
+            idle = m_idle_chat_templates.emplace(chat_tpl, IdleChatTemplates{m_chat_templates_lru.begin(), {}}).first;
+        }
+        idle->second.templates.push_back(std::move(compiled));
+    }
+
+    std::string apply_chat_template(ChatHistory history,
+                                    bool add_generation_prompt,
+                                    const std::string& chat_template) const {
+        const std::string chat_tpl = get_chat_template(chat_template);
+        std::unique_ptr<CompiledChatTemplate> compiled = acquire_chat_template(chat_tpl);
 
         jinja2::ValuesList jinja_messages;
         jinja2::ValuesMap jinja_message;
@@ -569,11 +796,13 @@ public:
             {"eos_token", m_eos_token},
             {"pad_token", m_pad_token},
             {"add_generation_prompt", add_generation_prompt},
-            {"slice", slice_callable},
+            {"slice", compiled->slice_callable},
         };
 
         try {
-            return tpl.RenderAsString(params).value();
+            std::string rendered = compiled->tpl.RenderAsString(params).value();
+            release_chat_template(chat_tpl, std::move(compiled));
+            return rendered;
         } catch (const std::exception& error) {
             OPENVINO_THROW("Chat template for the current model is not supported by Jinja2Cpp. "
                            "Please apply template manually to your prompt before calling generate. "
@@ -582,7 +811,10 @@ public:
     }
 
     void set_chat_template(const std::string& chat_template) {
-        m_chat_template = patch_chat_template(chat_template);
+        std::string chat_tpl = patch_chat_template(chat_template);
+        // parsed previous template stays cached under its own string until it's evicted
+        std::lock_guard<std::mutex> lock(m_chat_templates_mutex);
+        m_chat_template = std::move(chat_tpl);
     }
 };
 
@@ -636,6 +868,14 @@ TokenizedInputs Tokenizer::encode(std::vector<std::string>&& prompts, const ov::
     return m_pimpl->encode(prompts, tokenization_params);
 }
 
+void Tokenizer::encode_batches(const std::vector<std::string>& prompts,
+                               size_t batch_size,
+                               const std::function<bool(size_t, TokenizedInputs)>& callback,
+                               const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name()});
+    m_pimpl->encode_batches(prompts, batch_size, callback, tokenization_params);
+}
+
 TokenizedInputs Tokenizer::encode(std::initializer_list<std::string>& text, const ov::AnyMap& tokenization_params) {
     check_arguments(tokenization_params, {ov::genai::add_special_tokens.name()});
     return encode(std::vector<std::string>(text.begin(), text.end()), tokenization_params);
@@ -3,8 +3,11 @@
 
 #include "utils.hpp"
 
+#include <cstring>
 #include <fstream>
+#include <numeric>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/multiply.hpp"
@@ -325,6 +328,28 @@ size_t get_first_history_difference(const ov::Tensor& encoded_history, const std
         return idx;
 }
 
+std::optional<size_t> get_appended_tokens_offset(const ov::Tensor& window_tokens, const ov::Tensor& tail_tokens, const std::vector<int64_t>& answer_tokens) {
+    const size_t window_size = window_tokens.get_size(), tail_size = tail_tokens.get_size();
+    const size_t offset = tail_size + answer_tokens.size();
+    if (window_size <= offset)
+        return std::nullopt;
+
+    const int64_t* window_data = window_tokens.data<const int64_t>();
+    const int64_t* tail_data = tail_tokens.data<const int64_t>();
+    if (!std::equal(tail_data, tail_data + tail_size, window_data) ||
+        !std::equal(answer_tokens.begin(), answer_tokens.end(), window_data + tail_size))
+        return std::nullopt;
+    return offset;
+}
+
+size_t get_text_tail_start(const std::string& text, size_t end, size_t max_length) {
+    size_t start = end > max_length ? end - max_length : 0;
+    // skip continuation bytes of a multibyte character
+    while (start < end && (static_cast<unsigned char>(text[start]) & 0xC0) == 0x80)
+        ++start;
+    return start;
+}
+
 size_t get_seq_len_axis(std::shared_ptr<const ov::Model> model) {
     // sequence length axis in key/values tensors, for most cases [BATCH_SIZE, num_kv_heads, seq_len, head_size],
     // therefore usually seq_length_axis = 2
@@ -354,11 +379,20 @@ size_t get_seq_len_axis(std::shared_ptr<const ov::Model> model) {
     return seq_length_axis;
 }
 
+bool is_state_copied_on_set(ov::InferRequest request) {
+    auto execution_devices = request.get_compiled_model().get_property(ov::execution_devices);
+    return execution_devices.size() == 1 && execution_devices[0] == "CPU";
+}
+
 void trim_kv_cache(ov::InferRequest request, uint64_t remove_from_end, size_t seq_length_axis, std::optional<AdapterController> adapter_controller) {
     // nothing to trim in this case
     if (remove_from_end == 0)
         return;
 
+    // if states are copied by the plugin, one buffer is reused for all states of the same shape
+    const bool is_state_copied = is_state_copied_on_set(request);
+    ov::Tensor trimmed_buffer;
+
     auto states = request.query_state();
     for (auto& state : states) {
         if(adapter_controller && adapter_controller->has_state_name(state.get_name()))
@@ -367,15 +401,35 @@ void trim_kv_cache(ov::InferRequest request, uint64_t remove_from_end, size_t se
         ov::Tensor old_tensor = state.get_state();
         // [BATCH_SIZE, num_kv_heads, seq_len, head_size]
         auto shape = old_tensor.get_shape();
+        const size_t old_seq_len = shape[seq_length_axis];
+        OPENVINO_ASSERT(old_seq_len >= remove_from_end, "Cannot remove ", remove_from_end, " tokens from KV cache of ", old_seq_len, " tokens");
         shape[seq_length_axis] -= remove_from_end;
 
-        ov::Coordinate new_shape_begin{0, 0, 0, 0};
-        ov::Coordinate new_shape_end{shape};
+        // trimmed state is a prefix of each block of the outer dimensions
+        const size_t num_blocks = std::accumulate(shape.begin(), shape.begin() + seq_length_axis, size_t{1}, std::multiplies<size_t>());
+        const size_t row_size = old_tensor.get_byte_size() / old_tensor.get_size() *
+            std::accumulate(shape.begin() + seq_length_axis + 1, shape.end(), size_t{1}, std::multiplies<size_t>());
 
-        auto trimmed_tensor = ov::Tensor(old_tensor, new_shape_begin, new_shape_end);
+        if (num_blocks == 1) {
+            // contiguous prefix of the current state is set back as is
+            state.set_state(ov::Tensor(old_tensor, ov::Coordinate(shape.size(), 0), ov::Coordinate{shape}));
+            continue;
+        }
+
+        ov::Tensor new_tensor;
+        if (is_state_copied && trimmed_buffer && trimmed_buffer.get_element_type() == old_tensor.get_element_type() && trimmed_buffer.get_shape() == shape) {
+            new_tensor = trimmed_buffer;
+        } else {
+            new_tensor = ov::Tensor(old_tensor.get_element_type(), shape);
+            trimmed_buffer = new_tensor;
+        }
 
-        ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
-        trimmed_tensor.copy_to(new_tensor);
+        const size_t old_block_size = old_seq_len * row_size, new_block_size = shape[seq_length_axis] * row_size;
+        const uint8_t* src = static_cast<const uint8_t*>(old_tensor.data());
+        uint8_t* dst = static_cast<uint8_t*>(new_tensor.data());
+        ov::parallel_for(num_blocks, [&](size_t block) {
+            std::memcpy(dst + block * new_block_size, src + block * old_block_size, new_block_size);
+        });
 
         state.set_state(new_tensor);
     }
@@ -115,8 +115,19 @@ void read_rt_info(std::shared_ptr<ov::Model>& model, const char* name, T& value)
 
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history, std::set<int64_t> stop_tokens);
 
+// Text appended to the chat history is tokenized together with a short window before it: the end of the previous prompt and
+// the answer. Returns position of the appended tokens in 'window_tokens', if the window is tokenized as 'tail_tokens' (the end of
+// the prompt tokenized alone) followed by 'answer_tokens', i.e. no tokens are merged across the history boundaries.
+std::optional<size_t> get_appended_tokens_offset(const ov::Tensor& window_tokens, const ov::Tensor& tail_tokens, const std::vector<int64_t>& answer_tokens);
+
+// Returns the start of at most 'max_length' bytes of 'text' before 'end', which doesn't split UTF-8 sequences
+size_t get_text_tail_start(const std::string& text, size_t end, size_t max_length);
+
 size_t get_seq_len_axis(std::shared_ptr<const ov::Model> model);
 
+// CPU plugin copies a tensor passed to VariableState::set_state into its own memory, other plugins may keep the tensor as the state
+bool is_state_copied_on_set(ov::InferRequest request);
+
 void trim_kv_cache(ov::InferRequest request, uint64_t remove_from_end, size_t seq_length_axis, std::optional<AdapterController> adapter_controller);
 
 ov::Tensor push_front_inputs(const ov::Tensor& base_tensor, int64_t add_to_front);
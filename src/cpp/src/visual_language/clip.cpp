@@ -4,8 +4,13 @@
 // Based on clip.cpp
 
 #include "clip.hpp"
+
+#include <algorithm>
+#include <array>
 #include <cmath>
 
+#include "openvino/core/parallel.hpp"
+
 // Linear interpolation between two points
 static float clip_lerp(float s, float e, float t) {
     return s + (e - s) * t;
@@ -20,30 +25,32 @@ static void bilinear_resize(const clip_image_u8& src, clip_image_u8& dst, int ta
     float x_ratio = static_cast<float>(src.nx - 1) / target_width;
     float y_ratio = static_cast<float>(src.ny - 1) / target_height;
 
-    for (int y = 0; y < target_height; y++) {
-        for (int x = 0; x < target_width; x++) {
-            float px = x_ratio * x;
-            float py = y_ratio * y;
-            int x_floor = static_cast<int>(px);
-            int y_floor = static_cast<int>(py);
-            float x_lerp = px - x_floor;
-            float y_lerp = py - y_floor;
+    // horizontal source offsets and weights are the same for all rows
+    std::vector<int> x_floor(target_width);
+    std::vector<float> x_lerp(target_width);
+    for (int x = 0; x < target_width; x++) {
+        float px = x_ratio * x;
+        x_floor[x] = static_cast<int>(px);
+        x_lerp[x] = px - x_floor[x];
+    }
+
+    ov::parallel_for(static_cast<size_t>(target_height), [&](size_t y) {
+        float py = y_ratio * y;
+        int y_floor = static_cast<int>(py);
+        float y_lerp = py - y_floor;
 
+        const uint8_t* top_row = src.buf.data() + 3 * y_floor * src.nx;
+        const uint8_t* bottom_row = top_row + 3 * src.nx;
+        uint8_t* dst_row = dst.buf.data() + 3 * y * target_width;
+
+        for (int x = 0; x < target_width; x++) {
             for (int c = 0; c < 3; c++) {
-                float top = clip_lerp(
-                    static_cast<float>(src.buf[3 * (y_floor * src.nx + x_floor) + c]),
-                    static_cast<float>(src.buf[3 * (y_floor * src.nx + (x_floor + 1)) + c]),
-                    x_lerp
-                );
-                float bottom = clip_lerp(
-                    static_cast<float>(src.buf[3 * ((y_floor + 1) * src.nx + x_floor) + c]),
-                    static_cast<float>(src.buf[3 * ((y_floor + 1) * src.nx + (x_floor + 1)) + c]),
-                    x_lerp
-                );
-                dst.buf[3 * (y * target_width + x) + c] = static_cast<uint8_t>(clip_lerp(top, bottom, y_lerp));
+                float top = clip_lerp(top_row[3 * x_floor[x] + c], top_row[3 * (x_floor[x] + 1) + c], x_lerp[x]);
+                float bottom = clip_lerp(bottom_row[3 * x_floor[x] + c], bottom_row[3 * (x_floor[x] + 1) + c], x_lerp[x]);
+                dst_row[3 * x + c] = static_cast<uint8_t>(clip_lerp(top, bottom, y_lerp));
             }
         }
-    }
+    });
 }
 
 template<typename NUM>
@@ -51,65 +58,144 @@ NUM clip(NUM x, NUM lower, NUM upper) {
     return std::max(lower, std::min(x, upper));
 }
 
-void bicubic_resize(const clip_image_u8 &img, clip_image_u8 &dst, int target_width, int target_height) {
-    const int nx = img.nx;
-    const int ny = img.ny;
+namespace {
+
+// 4 source pixels and their weights contributing to a single output pixel along one axis
+struct BicubicTaps {
+    int index[4];
+    float weight[4];
+};
+
+// Bicubic interpolation; adapted from ViT.cpp, inspired from :
+//    -> https://github.com/yglukhov/bicubic-interpolation-image-processing/blob/master/libimage.c#L36
+//    -> https://en.wikipedia.org/wiki/Bicubic_interpolation
+// The cubic polynomial is linear in pixel values, so it's precomputed as weights of pixels [x - 1, x + 2]
+std::vector<BicubicTaps> bicubic_taps(int src_size, int dst_size, int dst_begin, int dst_count) {
+    const float ratio = (float)src_size / (float)dst_size;
+
+    std::vector<BicubicTaps> taps(dst_count);
+    for (int i = 0; i < dst_count; ++i) {
+        const int x = (int)(ratio * (dst_begin + i));
+        const float d = ratio * (dst_begin + i) - x;
+
+        BicubicTaps& tap = taps[i];
+        for (int k = 0; k < 4; ++k) {
+            tap.index[k] = clip(x - 1 + k, 0, src_size - 1);
+        }
+        tap.weight[0] = -1.0f / 3 * d + 1.0f / 2 * d * d - 1.0f / 6 * d * d * d;
+        tap.weight[2] = d + 1.0f / 2 * d * d - 1.0f / 2 * d * d * d;
+        tap.weight[3] = -1.0f / 6 * d + 1.0f / 6 * d * d * d;
+        tap.weight[1] = 1.0f - tap.weight[0] - tap.weight[2] - tap.weight[3];
+    }
+    return taps;
+}
 
-    dst.nx = target_width;
-    dst.ny = target_height;
-    dst.buf.resize(3 * target_width * target_height);
+// Separable bicubic resize of 'img' to target size, which computes only a window [crop_x, crop_x + crop_width) x
+// [crop_y, crop_y + crop_height) of the resized image. Source rows are interpolated horizontally once, then output rows
+// are interpolated vertically, both passes run in parallel. 'store' is called with an index of output row in the
+// window and its RGB values.
+template <typename Store>
+void bicubic_resize_window(const clip_image_u8& img, int target_width, int target_height,
+                           int crop_x, int crop_y, int crop_width, int crop_height, Store store) {
+    OPENVINO_ASSERT(crop_x >= 0 && crop_y >= 0 && crop_x + crop_width <= target_width && crop_y + crop_height <= target_height,
+        "Crop window must be within resized image");
+
+    const std::vector<BicubicTaps> x_taps = bicubic_taps(img.nx, target_width, crop_x, crop_width);
+    const std::vector<BicubicTaps> y_taps = bicubic_taps(img.ny, target_height, crop_y, crop_height);
+
+    // only source rows used by the window are interpolated horizontally
+    std::vector<int> rows, row_slot(img.ny, -1);
+    for (const BicubicTaps& tap : y_taps) {
+        for (int row : tap.index) {
+            if (row_slot[row] < 0) {
+                row_slot[row] = static_cast<int>(rows.size());
+                rows.push_back(row);
+            }
+        }
+    }
 
-    float Cc;
-    float C[5];
-    float d0, d2, d3, a0, a1, a2, a3;
-    int i, j, k, jj;
-    int x, y;
-    float dx, dy;
-    float tx, ty;
-
-    tx = (float)nx / (float)target_width;
-    ty = (float)ny / (float)target_height;
-
-    // Bicubic interpolation; adapted from ViT.cpp, inspired from :
-    //    -> https://github.com/yglukhov/bicubic-interpolation-image-processing/blob/master/libimage.c#L36
-    //    -> https://en.wikipedia.org/wiki/Bicubic_interpolation
-
-    for (i = 0; i < target_height; i++) {
-        for (j = 0; j < target_width; j++) {
-            x = (int)(tx * j);
-            y = (int)(ty * i);
-
-            dx = tx * j - x;
-            dy = ty * i - y;
-
-            for (k = 0; k < 3; k++) {
-                for (jj = 0; jj <= 3; jj++) {
-                    d0 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x - 1, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    d2 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x + 1, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    d3 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x + 2, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    a0 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-
-                    a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
-                    a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
-                    a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
-
-                    C[jj] = a0 + a1 * dx + a2 * dx * dx + a3 * dx * dx * dx;
-
-                    d0 = C[0] - C[1];
-                    d2 = C[2] - C[1];
-                    d3 = C[3] - C[1];
-                    a0 = C[1];
-                    a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
-                    a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
-                    a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
-                    Cc = a0 + a1 * dy + a2 * dy * dy + a3 * dy * dy * dy;
-
-                    const uint8_t Cc2 = std::min(std::max(std::round(Cc), 0.0f), 255.0f);
-                    dst.buf[(i * target_width + j) * 3 + k] = float(Cc2);
-                }
+    const size_t row_size = 3 * static_cast<size_t>(crop_width);
+    std::vector<float> horizontal(rows.size() * row_size);
+    ov::parallel_for(rows.size(), [&](size_t slot) {
+        const uint8_t* src = img.buf.data() + 3 * static_cast<size_t>(rows[slot]) * img.nx;
+        float* dst = horizontal.data() + slot * row_size;
+        for (int x = 0; x < crop_width; ++x) {
+            const BicubicTaps& tap = x_taps[x];
+            for (int c = 0; c < 3; ++c) {
+                dst[3 * x + c] = tap.weight[0] * src[3 * tap.index[0] + c] + tap.weight[1] * src[3 * tap.index[1] + c] +
+                                 tap.weight[2] * src[3 * tap.index[2] + c] + tap.weight[3] * src[3 * tap.index[3] + c];
             }
         }
+    });
+
+    // output rows are split into a chunk per thread, so the scratch row is allocated once per chunk
+    const size_t num_rows = static_cast<size_t>(crop_height);
+    const size_t num_chunks = std::max<size_t>(std::min<size_t>(std::max(ov::parallel_get_max_threads(), 1), num_rows), 1);
+    ov::parallel_for(num_chunks, [&](size_t chunk) {
+        std::vector<uint8_t> row(row_size);
+        for (size_t y = num_rows * chunk / num_chunks; y < num_rows * (chunk + 1) / num_chunks; ++y) {
+            const BicubicTaps& tap = y_taps[y];
+            const float* src[4];
+            for (int k = 0; k < 4; ++k) {
+                src[k] = horizontal.data() + row_slot[tap.index[k]] * row_size;
+            }
+
+            for (size_t i = 0; i < row_size; ++i) {
+                const float value = tap.weight[0] * src[0][i] + tap.weight[1] * src[1][i] + tap.weight[2] * src[2][i] + tap.weight[3] * src[3][i];
+                row[i] = static_cast<uint8_t>(std::min(std::max(std::round(value), 0.0f), 255.0f));
+            }
+            store(y, row.data());
+        }
+    });
+}
+
+// normalized values of all uint8 pixel values for each channel
+std::array<std::array<float, 256>, 3> normalization_table(const clip_ctx& ctx) {
+    std::array<std::array<float, 256>, 3> table;
+    for (int c = 0; c < 3; ++c) {
+        for (int v = 0; v < 256; ++v) {
+            table[c][v] = ((float(v) / 255.0f) - ctx.image_mean[c]) / ctx.image_std[c];
+        }
     }
+    return table;
+}
+
+// normalizes RGB row of 'width' pixels and writes it to 'y' row of CHW float image
+void normalize_row(const std::array<std::array<float, 256>, 3>& table, const uint8_t* src, clip_image_f32& dst, size_t y) {
+    const size_t plane_size = static_cast<size_t>(dst.nx) * dst.ny;
+    float* dst_row = dst.buf.data() + y * dst.nx;
+    for (int c = 0; c < 3; ++c) {
+        for (int x = 0; x < dst.nx; ++x) {
+            dst_row[c * plane_size + x] = table[c][src[3 * x + c]];
+        }
+    }
+}
+
+} // namespace
+
+void bicubic_resize(const clip_image_u8 &img, clip_image_u8 &dst, int target_width, int target_height) {
+    dst.nx = target_width;
+    dst.ny = target_height;
+    dst.buf.resize(3 * target_width * target_height);
+
+    const size_t row_size = 3 * static_cast<size_t>(target_width);
+    bicubic_resize_window(img, target_width, target_height, 0, 0, target_width, target_height, [&](size_t y, const uint8_t* row) {
+        std::memcpy(dst.buf.data() + y * row_size, row, row_size);
+    });
+}
+
+clip_image_f32 bicubic_resize_normalize(const clip_ctx& ctx, const clip_image_u8& img, int target_width, int target_height,
+                                        int crop_x, int crop_y, int crop_width, int crop_height) {
+    clip_image_f32 res;
+    res.nx = crop_width;
+    res.ny = crop_height;
+    res.buf.resize(3 * crop_width * crop_height);
+
+    const auto table = normalization_table(ctx);
+    bicubic_resize_window(img, target_width, target_height, crop_x, crop_y, crop_width, crop_height, [&](size_t y, const uint8_t* row) {
+        normalize_row(table, row, res, y);
+    });
+    return res;
 }
 
 // llava-1.6 type of resize_and_pad (black)
@@ -144,11 +230,7 @@ static clip_image_u8 resize_and_pad_image(const clip_image_u8& image, const std:
 
     // Copy the resized image into the center of the padded buffer
     for (int y = 0; y < new_height; ++y) {
-        for (int x = 0; x < new_width; ++x) {
-            for (int c = 0; c < 3; ++c) {
-                padded_image.buf[3 * ((y + pad_y) * target_width + (x + pad_x)) + c] = resized_image.buf[3 * (y * new_width + x) + c];
-            }
-        }
+        std::memcpy(padded_image.buf.data() + 3 * ((y + pad_y) * target_width + pad_x), resized_image.buf.data() + 3 * y * new_width, 3 * new_width);
     }
     return padded_image;
 }
@@ -188,72 +270,16 @@ std::pair<int, int> select_best_resolution(const std::pair<int, int> & original_
 
 // returns the normalized float tensor for llava-1.5, for spatial_unpad with anyres processing for llava-1.6 it returns the normalized image patch tensors as a vector
 clip_image_f32 clip_image_preprocess(clip_ctx& ctx, const clip_image_u8& img) {
-    bool pad_to_square = true;
-
-    clip_image_u8 temp;  // we will keep the input image data here temporarily
-    temp.nx = img.nx;
-    temp.ny = img.ny;
-    temp.buf.resize(img.buf.size());
-    memcpy(temp.buf.data(), img.buf.data(), temp.buf.size());
-
-
-    const int nx = temp.nx;
-    const int ny = temp.ny;
-
-    const int nx2 = temp.nx;
-    const int ny2 = temp.ny;
-
     clip_image_f32 res;
-    res.nx = nx2;
-    res.ny = ny2;
-    res.buf.resize(3 * nx2 * ny2);
-
-    const int nx3 = nx;
-    const int ny3 = ny;
-
-    const auto& m3 = ctx.image_mean; // {0.48145466f, 0.4578275f, 0.40821073f};
-    const auto& s3 = ctx.image_std;  // {0.26862954f, 0.26130258f, 0.27577711f};
-
-    for (int y = 0; y < ny3; y++) {
-        for (int x = 0; x < nx3; x++) {
-            for (int c = 0; c < 3; c++) {
-                // linear interpolation
-                const float sx = x;
-                const float sy = y;
-
-                const int x0 = std::max(0, (int)std::floor(sx));
-                const int y0 = std::max(0, (int)std::floor(sy));
-
-                const int x1 = std::min(x0 + 1, nx - 1);
-                const int y1 = std::min(y0 + 1, ny - 1);
-
-                const float dx = sx - x0;
-                const float dy = sy - y0;
-
-                const int j00 = 3 * (y0 * nx + x0) + c;
-                const int j01 = 3 * (y0 * nx + x1) + c;
-                const int j10 = 3 * (y1 * nx + x0) + c;
-                const int j11 = 3 * (y1 * nx + x1) + c;
-
-                const float v00 = temp.buf[j00];
-                const float v01 = temp.buf[j01];
-                const float v10 = temp.buf[j10];
-                const float v11 = temp.buf[j11];
-
-                const float v0 = v00 * (1.0f - dx) + v01 * dx;
-                const float v1 = v10 * (1.0f - dx) + v11 * dx;
-
-                const float v = v0 * (1.0f - dy) + v1 * dy;
-
-                const uint8_t v2 = std::min(std::max(std::round(v), 0.0f), 255.0f);
-
-                //rgb hwc ->chw
-                const int i = (y * nx3 + x) + c * nx3 * ny3;
-
-                res.buf[i] = ((float(v2) / 255.0f) - m3[c]) / s3[c];
-            }
-        }
-    }
+    res.nx = img.nx;
+    res.ny = img.ny;
+    res.buf.resize(3 * img.nx * img.ny);
+
+    // rgb hwc -> chw
+    const auto table = normalization_table(ctx);
+    ov::parallel_for(static_cast<size_t>(img.ny), [&](size_t y) {
+        normalize_row(table, img.buf.data() + 3 * y * img.nx, res, y);
+    });
     return res;
 }
 
@@ -298,15 +324,8 @@ std::vector<clip_image_u8> get_image_patches(
             patch.buf.resize(3 * patch_size * patch_size);
 
             for (int y = 0; y < patch_size; ++y) {
-                for (int x = 0; x < patch_size; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        int src_y = h * patch_size + y;
-                        int src_x = w * patch_size + x;
-                        int src_idx = (src_y * width + src_x) * 3 + c;
-                        int dst_idx = (y * patch_size + x) * 3 + c;
-                        patch.buf[dst_idx] = resized_image.buf[src_idx];
-                    }
-                }
+                int src_idx = ((h * patch_size + y) * width + w * patch_size) * 3;
+                std::memcpy(patch.buf.data() + y * patch_size * 3, resized_image.buf.data() + src_idx, patch_size * 3);
             }
             patches.push_back(patch);
         }
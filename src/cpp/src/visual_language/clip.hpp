@@ -32,6 +32,11 @@ struct clip_image_f32 {
 
 void bicubic_resize(const clip_image_u8& img, clip_image_u8& dst, int target_width, int target_height);
 
+/// resizes img to target size and returns normalized CHW window [crop_x, crop_x + crop_width) x [crop_y, crop_y + crop_height)
+/// of the resized image, which is the same as bicubic_resize, crop and clip_image_preprocess w/o intermediate images
+clip_image_f32 bicubic_resize_normalize(const clip_ctx& ctx, const clip_image_u8& img, int target_width, int target_height,
+                                        int crop_x, int crop_y, int crop_width, int crop_height);
+
 /** preprocess img and store the result in res_imgs, pad_to_square may be overridden to false depending on model configuration */
 clip_image_f32 clip_image_preprocess(struct clip_ctx& ctx, const clip_image_u8& img);
 
@@ -3,11 +3,16 @@
 
 #include <fstream>
 #include <memory>
+#include <set>
 
 #include "openvino/runtime/core.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/util/gather_base.hpp"
 
 #include "utils.hpp"
 
@@ -16,18 +21,55 @@
 namespace ov {
 namespace genai {
 
+namespace {
+
+// skips precision conversions, e.g. of compressed weights
+ov::Output<ov::Node> skip_converts(ov::Output<ov::Node> output) {
+    while (ov::is_type<ov::op::v0::Convert>(output.get_node())) {
+        output = output.get_node()->input_value(0);
+    }
+    return output;
+}
+
+std::shared_ptr<ov::op::v0::Constant> as_constant(const ov::Output<ov::Node>& output) {
+    return ov::as_type_ptr<ov::op::v0::Constant>(skip_converts(output).get_node_shared_ptr());
+}
+
+// reads a dequantization parameter, which is either a scalar or a value per table row
+bool get_row_parameter(const std::shared_ptr<ov::op::v0::Constant>& constant, size_t vocab_size, std::vector<float>& values) {
+    const ov::Shape& shape = constant->get_shape();
+    const size_t size = ov::shape_size(shape);
+    if (size != 1 && !(size == vocab_size && shape.at(0) == vocab_size)) {
+        return false;
+    }
+    values = constant->cast_vector<float>();
+    return true;
+}
+
+template <typename T>
+void gather_rows(const T* table, size_t hidden_size, const int64_t* ids, size_t num_ids,
+                 const std::vector<float>& scales, const std::vector<float>& zero_points, float scale_emb, float* output) {
+    ov::parallel_for(num_ids, [&](size_t i) {
+        const size_t row = static_cast<size_t>(ids[i]);
+        const float scale = (scales.empty() ? 1.0f : scales[scales.size() == 1 ? 0 : row]) * scale_emb;
+        const float zero_point = zero_points.empty() ? 0.0f : zero_points[zero_points.size() == 1 ? 0 : row];
+        const T* src = table + row * hidden_size;
+        float* dst = output + i * hidden_size;
+        for (size_t j = 0; j < hidden_size; ++j) {
+            dst[j] = (static_cast<float>(src[j]) - zero_point) * scale;
+        }
+    });
+}
+
+} // namespace
+
 EmbeddingsModel::EmbeddingsModel(const std::filesystem::path& model_dir,
                                  const float scale_emb,
                                  const std::string& device,
                                  const ov::AnyMap& properties) {
     ov::Core core = utils::singleton_core();
     std::shared_ptr<ov::Model> m_model = core.read_model((model_dir / "openvino_text_embeddings_model.xml").string());
-    // apply embedding postprocessing step by merging them into the model
-    merge_postprocess(m_model, scale_emb);
-
-    ov::CompiledModel compiled_model = core.compile_model(m_model, device, properties);
-    ov::genai::utils::print_compiled_model_properties(compiled_model, "text embeddings model");
-    m_request = compiled_model.create_infer_request();
+    init(m_model, scale_emb, device, properties);
 }
 
 EmbeddingsModel::EmbeddingsModel(const std::string& model,
@@ -37,14 +79,37 @@ EmbeddingsModel::EmbeddingsModel(const std::string& model,
                                  const ov::AnyMap& properties) {
     ov::Core core = utils::singleton_core();
     std::shared_ptr<ov::Model> m_model = core.read_model(model, weights);
+    init(m_model, scale_emb, device, properties);
+}
+
+void EmbeddingsModel::init(std::shared_ptr<ov::Model> model, const float scale_emb, const std::string& device, const ov::AnyMap& properties) {
+    // a lookup doesn't need inference, which overhead dominates for a few tokens, e.g. for each generated token
+    if (extract_embedding_table(model)) {
+        m_scale_emb = scale_emb;
+        return;
+    }
+
     // apply embedding postprocessing step by merging them into the model
-    merge_postprocess(m_model, scale_emb);
+    merge_postprocess(model, scale_emb);
 
-    ov::CompiledModel compiled_model = core.compile_model(m_model, device, properties);
+    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, properties);
+    ov::genai::utils::print_compiled_model_properties(compiled_model, "text embeddings model");
     m_request = compiled_model.create_infer_request();
 }
 
 ov::Tensor EmbeddingsModel::infer(ov::Tensor input_idx) {
+    if (m_embedding_table) {
+        ov::Shape shape = input_idx.get_shape();
+        shape.push_back(m_embedding_table->get_shape().at(1));
+        if (m_inputs_embeds) {
+            m_inputs_embeds.set_shape(shape);
+        } else {
+            m_inputs_embeds = ov::Tensor(ov::element::f32, shape);
+        }
+        gather(input_idx, m_inputs_embeds);
+        return m_inputs_embeds;
+    }
+
     OPENVINO_ASSERT(m_request, "Text embeddings decoder model must be compiled first. Cannot infer non-compiled model");
 
     m_request.set_input_tensor(input_idx);
@@ -52,6 +117,122 @@ ov::Tensor EmbeddingsModel::infer(ov::Tensor input_idx) {
     return m_request.get_output_tensor();
 }
 
+void EmbeddingsModel::infer(const ov::Tensor& input_idx, ov::Tensor& inputs_embeds) {
+    if (m_embedding_table) {
+        gather(input_idx, inputs_embeds);
+        return;
+    }
+
+    ov::Tensor embeds = infer(input_idx);
+    OPENVINO_ASSERT(embeds.get_shape() == inputs_embeds.get_shape(), "inputs_embeds is expected to have shape ", embeds.get_shape(), ", got ", inputs_embeds.get_shape());
+    embeds.copy_to(inputs_embeds);
+}
+
+EmbeddingsModel EmbeddingsModel::clone() const {
+    OPENVINO_ASSERT(m_request || m_embedding_table, "Text embeddings decoder model must be compiled first. Cannot clone non-compiled model");
+
+    // the embedding table is read only and can be shared
+    EmbeddingsModel cloned = *this;
+    if (m_request) {
+        cloned.m_request = m_request.get_compiled_model().create_infer_request();
+    }
+    cloned.m_inputs_embeds = ov::Tensor();
+    return cloned;
+}
+
+bool EmbeddingsModel::extract_embedding_table(const std::shared_ptr<ov::Model>& model) {
+    // expected pattern: Result(Gather(table, Parameter, axis 0)), where table is either a constant or
+    // Multiply(Subtract(Convert(int8 constant), zero points), scales) with per row scales and zero points
+    if (model->get_parameters().size() != 1 || model->get_results().size() != 1) {
+        return false;
+    }
+
+    auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(model->get_results().at(0)->get_input_node_shared_ptr(0));
+    if (!gather || gather->get_batch_dims() != 0 ||
+        model->get_parameters().at(0)->get_element_type() != ov::element::i64 ||
+        skip_converts(gather->input_value(1)).get_node() != model->get_parameters().at(0).get()) {
+        return false;
+    }
+    auto axis = as_constant(gather->input_value(2));
+    if (!axis || axis->cast_vector<int64_t>() != std::vector<int64_t>{0}) {
+        return false;
+    }
+
+    ov::Output<ov::Node> table = skip_converts(gather->input_value(0));
+    std::shared_ptr<ov::op::v0::Constant> scales, zero_points;
+    if (auto multiply = ov::as_type_ptr<ov::op::v1::Multiply>(table.get_node_shared_ptr())) {
+        auto lhs = as_constant(multiply->input_value(0)), rhs = as_constant(multiply->input_value(1));
+        // scales are the smaller input, the other one may be a converted constant of the table as well
+        const size_t scales_idx = rhs && (!lhs || ov::shape_size(rhs->get_shape()) < ov::shape_size(lhs->get_shape())) ? 1 : 0;
+        scales = scales_idx == 1 ? rhs : lhs;
+        if (!scales) {
+            return false;
+        }
+        table = skip_converts(multiply->input_value(1 - scales_idx));
+    }
+    if (auto subtract = ov::as_type_ptr<ov::op::v1::Subtract>(table.get_node_shared_ptr())) {
+        zero_points = as_constant(subtract->input_value(1));
+        if (!zero_points) {
+            return false;
+        }
+        table = skip_converts(subtract->input_value(0));
+    }
+
+    auto weights = ov::as_type_ptr<ov::op::v0::Constant>(table.get_node_shared_ptr());
+    const std::set<ov::element::Type> supported_types{ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::i8, ov::element::u8};
+    if (!weights || weights->get_shape().size() != 2 || !supported_types.count(weights->get_element_type())) {
+        return false;
+    }
+
+    const size_t vocab_size = weights->get_shape().at(0);
+    std::vector<float> table_scales, table_zero_points;
+    if ((scales && !get_row_parameter(scales, vocab_size, table_scales)) ||
+        (zero_points && !get_row_parameter(zero_points, vocab_size, table_zero_points))) {
+        return false;
+    }
+
+    m_embedding_table = weights;
+    m_table_scales = std::move(table_scales);
+    m_table_zero_points = std::move(table_zero_points);
+    return true;
+}
+
+void EmbeddingsModel::gather(const ov::Tensor& input_idx, ov::Tensor& inputs_embeds) const {
+    const size_t vocab_size = m_embedding_table->get_shape().at(0), hidden_size = m_embedding_table->get_shape().at(1);
+    ov::Shape expected_shape = input_idx.get_shape();
+    expected_shape.push_back(hidden_size);
+    OPENVINO_ASSERT(input_idx.get_element_type() == ov::element::i64, "Token ids are expected to be i64, got ", input_idx.get_element_type());
+    OPENVINO_ASSERT(inputs_embeds.get_element_type() == ov::element::f32 && inputs_embeds.get_shape() == expected_shape,
+                    "inputs_embeds is expected to be f32 tensor of shape ", expected_shape, ", got ", inputs_embeds.get_element_type(), " ", inputs_embeds.get_shape());
+
+    const int64_t* ids = input_idx.data<const int64_t>();
+    const size_t num_ids = input_idx.get_size();
+    for (size_t i = 0; i < num_ids; ++i) {
+        OPENVINO_ASSERT(ids[i] >= 0 && static_cast<size_t>(ids[i]) < vocab_size, "Token id ", ids[i], " is out of embedding table range [0, ", vocab_size, ")");
+    }
+
+    float* output = inputs_embeds.data<float>();
+    switch (m_embedding_table->get_element_type()) {
+    case ov::element::Type_t::f32:
+        gather_rows(m_embedding_table->get_data_ptr<float>(), hidden_size, ids, num_ids, m_table_scales, m_table_zero_points, m_scale_emb, output);
+        break;
+    case ov::element::Type_t::f16:
+        gather_rows(m_embedding_table->get_data_ptr<ov::float16>(), hidden_size, ids, num_ids, m_table_scales, m_table_zero_points, m_scale_emb, output);
+        break;
+    case ov::element::Type_t::bf16:
+        gather_rows(m_embedding_table->get_data_ptr<ov::bfloat16>(), hidden_size, ids, num_ids, m_table_scales, m_table_zero_points, m_scale_emb, output);
+        break;
+    case ov::element::Type_t::i8:
+        gather_rows(m_embedding_table->get_data_ptr<int8_t>(), hidden_size, ids, num_ids, m_table_scales, m_table_zero_points, m_scale_emb, output);
+        break;
+    case ov::element::Type_t::u8:
+        gather_rows(m_embedding_table->get_data_ptr<uint8_t>(), hidden_size, ids, num_ids, m_table_scales, m_table_zero_points, m_scale_emb, output);
+        break;
+    default:
+        OPENVINO_THROW("Unsupported embedding table type ", m_embedding_table->get_element_type());
+    }
+}
+
 void EmbeddingsModel::merge_postprocess(std::shared_ptr<ov::Model> model, float scale_emb) const {
     ov::preprocess::PrePostProcessor ppp(model);
 
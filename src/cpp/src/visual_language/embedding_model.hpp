@@ -12,6 +12,7 @@
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/op/constant.hpp"
 
 #include "visual_language/vlm_config.hpp"
 
@@ -22,6 +23,12 @@
 namespace ov {
 namespace genai {
 
+/**
+ * Converts token ids to embeddings. If the model is a plain lookup of an embedding table (possibly fp16/bf16
+ * or int8 compressed with per row scales and zero points), the table is taken from the model constant
+ * (memory mapped with model weights) and embeddings are gathered on host without inference.
+ * Otherwise the model is compiled and inferred.
+ */
 class EmbeddingsModel {
 public:
     EmbeddingsModel(const std::filesystem::path& model_dir,
@@ -37,12 +44,35 @@ public:
 
     EmbeddingsModel() = default;
 
+    // Returns embeddings [input_idx shape..., hidden_size], which are overwritten by the next call.
     ov::Tensor infer(ov::Tensor input_idx);
 
+    // Writes embeddings of 'input_idx' into 'inputs_embeds' of shape [input_idx shape..., hidden_size].
+    void infer(const ov::Tensor& input_idx, ov::Tensor& inputs_embeds);
+
+    // Returns a model sharing the compiled model with this one, but having its own infer request,
+    // so both can be inferred from different threads.
+    EmbeddingsModel clone() const;
+
 private:
+    void init(std::shared_ptr<ov::Model> model, const float scale_emb, const std::string& device, const ov::AnyMap& properties);
+
     void merge_postprocess(std::shared_ptr<ov::Model> model, float scale_emb) const;
 
+    bool extract_embedding_table(const std::shared_ptr<ov::Model>& model);
+
+    void gather(const ov::Tensor& input_idx, ov::Tensor& inputs_embeds) const;
+
     ov::InferRequest m_request;
+
+    // [vocab_size, hidden_size] table used for host gather, empty if the model is inferred
+    std::shared_ptr<ov::op::v0::Constant> m_embedding_table;
+    // per row dequantization parameters of compressed tables, empty if not used
+    std::vector<float> m_table_scales;
+    std::vector<float> m_table_zero_points;
+    float m_scale_emb = 1.0f;
+    // host gather output, which is reused like output tensor of infer request
+    ov::Tensor m_inputs_embeds;
 };
 
 } // namespace genai
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "openvino/genai/visual_language/perf_metrics.hpp"
+#include "openvino/genai/visual_language/vision_embedding_cache.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 #include "visual_language/clip.hpp"
@@ -10,11 +11,41 @@
 
 #include "utils.hpp"
 
+#include <sstream>
+
 
 namespace {
 
 constexpr size_t BATCH_SIZE = 1;
 
+// Vision models compiled from the same directory for the same device and properties produce the same embeddings,
+// so pipelines created for them share VisionEmbeddingCache entries. Properties which can't be printed make the
+// identity empty, so such pipelines get their own entries.
+std::string get_vision_models_identity(const std::filesystem::path& model_dir, const std::string& device, const ov::AnyMap& device_config) {
+    std::string identity = std::filesystem::weakly_canonical(model_dir).string() + '|' + device;
+    try {
+        for (const auto& [name, value] : device_config) {
+            identity += '|' + name + '=' + value.as<std::string>();
+        }
+    } catch (const ov::Exception&) {
+        return {};
+    }
+    return identity;
+}
+
+std::string serialize_processor_config(const ov::genai::ProcessorConfig& config) {
+    std::stringstream stream;
+    stream << config.image_size << ' ' << config.patch_size << ' ' << config.scale_resolution << ' ' << config.max_slice_nums;
+    for (const std::array<float, 3>& values : {config.norm_mean, config.norm_std, config.image_mean, config.image_std}) {
+        stream << ' ' << values[0] << ' ' << values[1] << ' ' << values[2];
+    }
+    stream << ' ' << config.crop_size_height << ' ' << config.crop_size_width << ' ' << config.size_shortest_edge;
+    for (const auto& [height, width] : config.image_grid_pinpoints) {
+        stream << ' ' << height << 'x' << width;
+    }
+    return stream.str();
+}
+
 } // namespace
 
 namespace ov::genai {
@@ -48,6 +79,10 @@ protected:
     // If we use beam search sampling with chat mode we need to remove last answer of the model from kv cache and add best answer to history 
     // so, let's keep info about amount of tokens to trim from kv cache and amount of tokens to keep in history
     ov::genai::utils::HistoryRemoveManager m_kv_history_manager = {0, 0};
+    // Identifies vision models in VisionEmbeddingCache keys.
+    size_t m_vision_cache_id;
+    // Position of the first image embedding in inputs embeds returned by the last get_inputs_embeds() with images.
+    size_t m_first_image_position = 0;
 
 public:
     virtual ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics) = 0;
@@ -64,6 +99,10 @@ public:
         return m_tokenized_history;
     }
 
+    size_t get_first_image_position() const {
+        return m_first_image_position;
+    }
+
     size_t get_num_tokens_to_remove_from_hist() const {
         return m_kv_history_manager.num_tokens_to_remove_from_kv_cache;
     }
@@ -122,7 +161,8 @@ protected:
         m_vlm_config{vlm_config},
         m_vision_encoder(model_dir, m_vlm_config.model_type, device, device_config),
         m_embedding(model_dir, m_vlm_config.scale_emb, device, device_config),
-        m_tokenizer{model_dir, device_config} { }
+        m_tokenizer{model_dir, device_config},
+        m_vision_cache_id{VisionEmbeddingCache::instance().get_encoder_id(get_vision_models_identity(model_dir, device, device_config))} { }
     
     IInputsEmbedder(
         const VLMConfig& vlm_config,
@@ -147,7 +187,80 @@ protected:
             device,
             device_config
         ),
-        m_tokenizer(tokenizer) { }
+        m_tokenizer(tokenizer),
+        // models passed in memory can't be identified, so they are never shared with other pipelines
+        m_vision_cache_id{VisionEmbeddingCache::instance().get_encoder_id({})} { }
+
+    /**
+    * @brief Returns embeddings of images from VisionEmbeddingCache or computes them with vision models and caches.
+    * Images missing in the cache are encoded with a single vision encoder inference.
+    */
+    std::vector<EncodedImage> encode_images(const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics) {
+        VisionEmbeddingCache& cache = VisionEmbeddingCache::instance();
+        auto& raw_vlm_counters = metrics.vlm_raw_metrics;
+        std::vector<EncodedImage> encoded_images(images.size());
+        if (cache.get_capacity() == 0) {
+            raw_vlm_counters.vision_embedding_cache_misses += images.size();
+            encoded_images = m_vision_encoder.encode(images);
+            for (EncodedImage& encoded_image : encoded_images) {
+                encoded_image = process_encoded_image(std::move(encoded_image));
+            }
+            return encoded_images;
+        }
+
+        const std::string processor_config = serialize_processor_config(m_vision_encoder.m_processor_config);
+        std::vector<VisionEmbeddingCache::Key> keys;
+        std::vector<size_t> missed_indices;
+        std::vector<ov::Tensor> missed_images;
+        for (size_t image_idx = 0; image_idx < images.size(); ++image_idx) {
+            const ov::Tensor& image = images.at(image_idx);
+            keys.push_back({m_vision_cache_id, VisionEmbeddingCache::hash_image(image), image.get_shape(), processor_config});
+
+            std::optional<std::vector<ov::Tensor>> cached = cache.find(keys.back());
+            if (!cached) {
+                missed_indices.push_back(image_idx);
+                missed_images.push_back(image);
+                continue;
+            }
+
+            const int64_t* sizes = cached->at(2).data<const int64_t>();
+            EncodedImage& encoded_image = encoded_images.at(image_idx);
+            encoded_image.resized_source = cached->at(0);
+            encoded_image.resized_source_size = {size_t(sizes[0]), size_t(sizes[1])};
+            encoded_image.slices = cached->at(1);
+            encoded_image.slices_size = {size_t(sizes[2]), size_t(sizes[3])};
+            encoded_image.patches_grid = {int(sizes[4]), int(sizes[5])};
+        }
+        raw_vlm_counters.vision_embedding_cache_hits += images.size() - missed_images.size();
+        raw_vlm_counters.vision_embedding_cache_misses += missed_images.size();
+
+        std::vector<EncodedImage> missed_encoded_images = m_vision_encoder.encode(missed_images);
+        for (size_t missed_idx = 0; missed_idx < missed_indices.size(); ++missed_idx) {
+            const size_t image_idx = missed_indices.at(missed_idx);
+            EncodedImage& encoded_image = encoded_images.at(image_idx);
+            encoded_image = process_encoded_image(std::move(missed_encoded_images.at(missed_idx)));
+
+            ov::Tensor sizes(ov::element::i64, {6});
+            int64_t* sizes_data = sizes.data<int64_t>();
+            sizes_data[0] = encoded_image.resized_source_size.height;
+            sizes_data[1] = encoded_image.resized_source_size.width;
+            sizes_data[2] = encoded_image.slices_size.height;
+            sizes_data[3] = encoded_image.slices_size.width;
+            sizes_data[4] = encoded_image.patches_grid.first;
+            sizes_data[5] = encoded_image.patches_grid.second;
+            cache.insert(keys.at(image_idx), {encoded_image.resized_source, encoded_image.slices, sizes});
+        }
+        raw_vlm_counters.vision_embedding_cache_size_bytes = cache.get_statistics().size_bytes;
+        return encoded_images;
+    }
+
+    /**
+    * @brief Post-processes vision encoder output before it is cached, so models with extra vision
+    * stages (e.g. MiniCPM resampler) skip them for cached images as well.
+    */
+    virtual EncodedImage process_encoded_image(EncodedImage&& encoded_image) {
+        return std::move(encoded_image);
+    }
 
     ov::Tensor get_encoded_input_ids(const std::string& prompt, ov::genai::VLMPerfMetrics& metrics, const std::string& chat_template_fallback = "") {
         ov::Tensor encoded_input_ids;
@@ -316,12 +429,11 @@ public:
 
     virtual ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics) override {
         std::string images_prompt;
-        std::vector<EncodedImage> embeds;
 
         std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
+        std::vector<EncodedImage> embeds = encode_images(single_images, metrics);
 
-        for (const ov::Tensor& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
+        for (const EncodedImage& encoded_image : embeds) {
             if (m_vlm_config.use_image_id) {
                 images_prompt += m_vlm_config.im_id_start + std::to_string(m_image_id) + m_vlm_config.im_id_end;
                 ++m_image_id;
@@ -345,7 +457,6 @@ public:
                 // Strangely, \n isn't placed between </image><slice>.
                 images_prompt += '\n';
             }
-            embeds.push_back(std::move(encoded_image));
         }
         images_prompt += prompt;
 
@@ -380,9 +491,12 @@ public:
         size_t encoded_input_size = encoded_input.get_size();
         int64_t* end = ids + encoded_input_size;
         float* inputs_embeds_data = inputs_embeds.data<float>();
+        if (!embeds.empty()) {
+            m_first_image_position = std::distance(begin, std::find(begin, end, im_start_id));
+        }
         for (const EncodedImage& encoded_image : embeds) {
-            const ov::Tensor& resampled_source = resample(encoded_image.resized_source, {encoded_image.resized_source_size});
-            float* emb = resampled_source.data<float>();
+            const ov::Tensor& resampled_source = encoded_image.resized_source;
+            const float* emb = resampled_source.data<const float>();
             ids = std::find(ids, end, im_start_id);
             OPENVINO_ASSERT(end != ids);
             ++ids;
@@ -391,16 +505,14 @@ public:
             if (encoded_image.slices) {
                 size_t token_idx = 0;
                 const ov::Shape& slices_shape = encoded_image.slices.get_shape();
+                const size_t slice_size = slices_shape.at(2) * slices_shape.at(3);
                 for (size_t i = 0; i < slices_shape.at(0); ++i) {
                     for (size_t ja = 0; ja < slices_shape.at(1); ++ja) {
-                        size_t d2 = slices_shape.at(2);
-                        size_t d3 = slices_shape.at(3);
-                        ov::Tensor encoded_view{ov::element::f32, {1, d2, d3}, encoded_image.slices.data<float>() + (i * slices_shape.at(1) + ja) * d2 * d3};
-                        const ov::Tensor& vision_embed_tensor_i_j = resample(encoded_view, {encoded_image.slices_size});
+                        const float* vision_embed_i_j = encoded_image.slices.data<const float>() + (i * slices_shape.at(1) + ja) * slice_size;
                         ids = std::find(ids, end, slice_start_id);
                         OPENVINO_ASSERT(end != ids);
                         ++ids;
-                        std::copy_n(vision_embed_tensor_i_j.data<float>(), vision_embed_tensor_i_j.get_size(), inputs_embeds_data + std::distance(begin, ids) * m_vlm_config.hidden_size);
+                        std::copy_n(vision_embed_i_j, slice_size, inputs_embeds_data + std::distance(begin, ids) * m_vlm_config.hidden_size);
                         ids += m_vlm_config.query_num;
                     }
                 }
@@ -423,6 +535,36 @@ public:
         m_image_id = 0;
     }
 
+protected:
+    // Replaces resized_source and slices with resampled embeddings:
+    // [1, query_num, hidden_size] and [slice_y, slice_x, query_num, hidden_size].
+    EncodedImage process_encoded_image(EncodedImage&& encoded_image) override {
+        // resampler output is overwritten by the next inference, so it's copied
+        const ov::Tensor& resampled_source = resample(encoded_image.resized_source, {encoded_image.resized_source_size});
+        ov::Tensor resized_source{resampled_source.get_element_type(), resampled_source.get_shape()};
+        resampled_source.copy_to(resized_source);
+        encoded_image.resized_source = resized_source;
+
+        if (encoded_image.slices) {
+            const ov::Shape& slices_shape = encoded_image.slices.get_shape();
+            size_t d2 = slices_shape.at(2);
+            size_t d3 = slices_shape.at(3);
+            ov::Tensor resampled_slices{ov::element::f32, {slices_shape.at(0), slices_shape.at(1), m_vlm_config.query_num, m_vlm_config.hidden_size}};
+            float* resampled_slices_data = resampled_slices.data<float>();
+            for (size_t i = 0; i < slices_shape.at(0); ++i) {
+                for (size_t ja = 0; ja < slices_shape.at(1); ++ja) {
+                    ov::Tensor encoded_view{ov::element::f32, {1, d2, d3}, encoded_image.slices.data<float>() + (i * slices_shape.at(1) + ja) * d2 * d3};
+                    const ov::Tensor& vision_embed_tensor_i_j = resample(encoded_view, {encoded_image.slices_size});
+                    OPENVINO_ASSERT(vision_embed_tensor_i_j.get_size() == m_vlm_config.query_num * m_vlm_config.hidden_size);
+                    std::copy_n(vision_embed_tensor_i_j.data<const float>(), vision_embed_tensor_i_j.get_size(),
+                                resampled_slices_data + (i * slices_shape.at(1) + ja) * vision_embed_tensor_i_j.get_size());
+                }
+            }
+            encoded_image.slices = resampled_slices;
+        }
+        return std::move(encoded_image);
+    }
+
 private:
     ov::Tensor resample(const ov::Tensor& encoded_image, const std::vector<ImageSize>& target_sizes) {
         size_t bs = encoded_image.get_shape().at(0);
@@ -623,8 +765,7 @@ public:
         std::vector<ov::Tensor> image_embeds;
         image_embeds.reserve(single_images.size());
 
-        for (const auto& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
+        for (EncodedImage& encoded_image : encode_images(single_images, metrics)) {
             image_embeds.push_back(std::move(encoded_image.resized_source));
             formatted_prompt += image_token + "\n";
         }
@@ -688,6 +829,9 @@ protected:
         size_t image_idx = 0;
         for (size_t s = 0; s < text_embeds_seq_length; ++s) {
             if (input_ids_data[s] == image_token_id) {
+                if (image_idx == 0) {
+                    m_first_image_position = merged_idx;
+                }
                 const float* image_embeds_data = image_embeds[image_idx].data<const float>();
                 size_t image_seq_length = image_embeds[image_idx].get_shape()[1];
 
@@ -738,8 +882,10 @@ public:
         
         ov::Tensor image_newline;
 
-        for (const auto& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
+        std::vector<EncodedImage> encoded_images = encode_images(single_images, metrics);
+        for (size_t image_idx = 0; image_idx < single_images.size(); ++image_idx) {
+            const ov::Tensor& image = single_images.at(image_idx);
+            const EncodedImage& encoded_image = encoded_images.at(image_idx);
 
             if (!image_newline) {
                 size_t embed_dim = encoded_image.resized_source.get_shape().at(2);
@@ -1063,8 +1209,7 @@ public:
         std::vector<ov::Tensor> image_embeds;
         image_embeds.reserve(single_images.size());
         
-        for (const auto& image : single_images) {
-            EncodedImage encoded_image = m_vision_encoder.encode(image);
+        for (const EncodedImage& encoded_image : encode_images(single_images, metrics)) {
             ov::Tensor single_image_embeds = encoded_image.resized_source;
 
             const size_t num_patches = single_image_embeds.get_shape().at(0);
@@ -1125,6 +1270,7 @@ protected:
         }
 
         OPENVINO_ASSERT(image_context_tokens_count > 0, "input_ids does not contain image context token ids");
+        m_first_image_position = std::distance(image_context_tokens_mask.begin(), std::find(image_context_tokens_mask.begin(), image_context_tokens_mask.end(), true));
 
         size_t image_idx = 0;
         size_t image_context_token_idx = 0;
@@ -1205,6 +1351,10 @@ std::vector<int64_t> InputsEmbedder::get_tokenized_history() const {
     return m_impl->get_tokenized_history();
 }
 
+size_t InputsEmbedder::get_first_image_position() const {
+    return m_impl->get_first_image_position();
+}
+
 void InputsEmbedder::update_tokenized_history(const std::vector<int64_t>& encoded_result, std::optional<int64_t> last_disappeared_token, bool is_beam_search, size_t last_answer_len) {
     return m_impl->update_tokenized_history(encoded_result, last_disappeared_token, is_beam_search, last_answer_len);
 }
@@ -43,6 +43,9 @@ public:
     // returns tokenized chat history
     std::vector<int64_t> get_tokenized_history() const;
 
+    // returns position of the first image embedding in inputs embeds returned by the last get_inputs_embeds() with images
+    size_t get_first_image_position() const;
+
     // add new results to tokenized history
     void update_tokenized_history(const std::vector<int64_t>& encoded_result, std::optional<int64_t> last_disappeared_token, bool is_beam_search, size_t last_answer_len);
 
@@ -31,6 +31,9 @@ VLMPerfMetrics VLMPerfMetrics::operator+(const VLMPerfMetrics& right) const {
     result_prepare_embeddings_durations.insert(result_prepare_embeddings_durations.end(),
                                                 right_prepare_embeddings_durations.begin(),
                                                 right_prepare_embeddings_durations.end());
+    result.vlm_raw_metrics.vision_embedding_cache_hits += right.vlm_raw_metrics.vision_embedding_cache_hits;
+    result.vlm_raw_metrics.vision_embedding_cache_misses += right.vlm_raw_metrics.vision_embedding_cache_misses;
+    result.vlm_raw_metrics.vision_embedding_cache_size_bytes = right.vlm_raw_metrics.vision_embedding_cache_size_bytes;
     return result;
 }
 }
\ No newline at end of file
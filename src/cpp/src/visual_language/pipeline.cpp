@@ -254,6 +254,9 @@ public:
         
         // VLM specific perf metrics
         decoded.perf_metrics.vlm_raw_metrics.prepare_embeddings_durations.emplace_back(PerfMetrics::get_microsec(end_get_inputs_embeds - start_get_inputs_embeds));
+        decoded.perf_metrics.vlm_raw_metrics.vision_embedding_cache_hits = raw_vlm_counters.vision_embedding_cache_hits;
+        decoded.perf_metrics.vlm_raw_metrics.vision_embedding_cache_misses = raw_vlm_counters.vision_embedding_cache_misses;
+        decoded.perf_metrics.vlm_raw_metrics.vision_embedding_cache_size_bytes = raw_vlm_counters.vision_embedding_cache_size_bytes;
 
         // Evaluate statistics
         decoded.perf_metrics.m_evaluated = false;
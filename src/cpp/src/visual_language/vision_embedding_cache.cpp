@@ -0,0 +1,247 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/visual_language/vision_embedding_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+constexpr size_t DEFAULT_CAPACITY_BYTES = 256 * 1024 * 1024;
+
+// SHA-256 as specified in FIPS 180-4
+class Sha256 {
+public:
+    void update(const uint8_t* data, size_t size) {
+        m_length += size;
+        if (m_buffer_size > 0) {
+            size_t count = std::min(size, m_buffer.size() - m_buffer_size);
+            std::copy_n(data, count, m_buffer.data() + m_buffer_size);
+            m_buffer_size += count;
+            data += count;
+            size -= count;
+            if (m_buffer_size < m_buffer.size()) {
+                return;
+            }
+            process_block(m_buffer.data());
+            m_buffer_size = 0;
+        }
+        for (; size >= m_buffer.size(); data += m_buffer.size(), size -= m_buffer.size()) {
+            process_block(data);
+        }
+        std::copy_n(data, size, m_buffer.data());
+        m_buffer_size = size;
+    }
+
+    std::array<uint8_t, 32> finalize() {
+        const uint64_t length_bits = m_length * 8;
+        const uint8_t padding = 0x80;
+        update(&padding, 1);
+        const uint8_t zero = 0;
+        while (m_buffer_size != 56) {
+            update(&zero, 1);
+        }
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            const uint8_t byte = static_cast<uint8_t>(length_bits >> shift);
+            update(&byte, 1);
+        }
+        std::array<uint8_t, 32> digest;
+        for (size_t i = 0; i < 8; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                digest[i * 4 + j] = static_cast<uint8_t>(m_state[i] >> (24 - 8 * j));
+            }
+        }
+        return digest;
+    }
+
+private:
+    static uint32_t rotr(uint32_t value, int bits) {
+        return (value >> bits) | (value << (32 - bits));
+    }
+
+    void process_block(const uint8_t* block) {
+        static constexpr uint32_t K[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        };
+        uint32_t w[64];
+        for (size_t i = 0; i < 16; ++i) {
+            w[i] = uint32_t(block[i * 4]) << 24 | uint32_t(block[i * 4 + 1]) << 16 | uint32_t(block[i * 4 + 2]) << 8 | block[i * 4 + 3];
+        }
+        for (size_t i = 16; i < 64; ++i) {
+            const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+        uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+        for (size_t i = 0; i < 64; ++i) {
+            const uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+            const uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        m_state[0] += a; m_state[1] += b; m_state[2] += c; m_state[3] += d;
+        m_state[4] += e; m_state[5] += f; m_state[6] += g; m_state[7] += h;
+    }
+
+    uint32_t m_state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    std::array<uint8_t, 64> m_buffer;
+    size_t m_buffer_size = 0;
+    uint64_t m_length = 0;
+};
+
+std::string serialize_key(const VisionEmbeddingCache::Key& key) {
+    std::string serialized = std::to_string(key.encoder_id) + ':' + key.image_hash + ':';
+    for (size_t dim : key.image_shape) {
+        serialized += std::to_string(dim) + 'x';
+    }
+    return serialized + ':' + key.processor_config;
+}
+
+size_t get_byte_size(const ov::Tensor& tensor) {
+    // tensors which are not set, e.g. slices of not sliced images, take no memory
+    return tensor ? tensor.get_byte_size() : 0;
+}
+
+} // namespace
+
+VisionEmbeddingCache::VisionEmbeddingCache() {
+    m_statistics.capacity_bytes = DEFAULT_CAPACITY_BYTES;
+}
+
+VisionEmbeddingCache& VisionEmbeddingCache::instance() {
+    static VisionEmbeddingCache cache;
+    return cache;
+}
+
+void VisionEmbeddingCache::set_capacity(size_t capacity_bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.capacity_bytes = capacity_bytes;
+    evict(capacity_bytes);
+}
+
+size_t VisionEmbeddingCache::get_capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics.capacity_bytes;
+}
+
+VisionEmbeddingCache::Statistics VisionEmbeddingCache::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+void VisionEmbeddingCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_statistics.num_entries = 0;
+    m_statistics.size_bytes = 0;
+}
+
+std::optional<std::vector<ov::Tensor>> VisionEmbeddingCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_index.find(serialize_key(key));
+    if (it == m_index.end()) {
+        ++m_statistics.misses;
+        return std::nullopt;
+    }
+
+    ++m_statistics.hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->embeddings;
+}
+
+void VisionEmbeddingCache::insert(const Key& key, const std::vector<ov::Tensor>& embeddings) {
+    size_t size_bytes = 0;
+    for (const ov::Tensor& embedding : embeddings) {
+        size_bytes += get_byte_size(embedding);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (size_bytes > m_statistics.capacity_bytes) {
+        return;
+    }
+
+    std::string serialized_key = serialize_key(key);
+    if (m_index.count(serialized_key)) {
+        return;
+    }
+
+    // copy outside of the infer request output buffers which are overwritten by the next inference
+    std::vector<ov::Tensor> copies;
+    copies.reserve(embeddings.size());
+    for (const ov::Tensor& embedding : embeddings) {
+        if (!embedding) {
+            copies.emplace_back();
+            continue;
+        }
+        ov::Tensor copy(embedding.get_element_type(), embedding.get_shape());
+        embedding.copy_to(copy);
+        copies.push_back(copy);
+    }
+
+    evict(m_statistics.capacity_bytes - size_bytes);
+
+    m_entries.push_front({serialized_key, std::move(copies), size_bytes});
+    m_index.emplace(std::move(serialized_key), m_entries.begin());
+    m_statistics.size_bytes += size_bytes;
+    m_statistics.num_entries = m_entries.size();
+}
+
+size_t VisionEmbeddingCache::get_encoder_id(const std::string& model_identity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (model_identity.empty()) {
+        return m_next_encoder_id++;
+    }
+
+    auto it = m_encoder_ids.find(model_identity);
+    if (it == m_encoder_ids.end()) {
+        it = m_encoder_ids.emplace(model_identity, m_next_encoder_id++).first;
+    }
+    return it->second;
+}
+
+std::string VisionEmbeddingCache::hash_image(const ov::Tensor& image) {
+    Sha256 sha256;
+    sha256.update(static_cast<const uint8_t*>(image.data()), image.get_byte_size());
+    const char* hex_digits = "0123456789abcdef";
+    std::string hex;
+    for (uint8_t byte : sha256.finalize()) {
+        hex += hex_digits[byte >> 4];
+        hex += hex_digits[byte & 0xF];
+    }
+    return hex;
+}
+
+void VisionEmbeddingCache::evict(size_t capacity_bytes) {
+    while (!m_entries.empty() && m_statistics.size_bytes > capacity_bytes) {
+        const Entry& entry = m_entries.back();
+        m_statistics.size_bytes -= entry.size_bytes;
+        m_index.erase(entry.key);
+        m_entries.pop_back();
+        ++m_statistics.evictions;
+    }
+    m_statistics.num_entries = m_entries.size();
+}
+
+} // namespace genai
+} // namespace ov
@@ -75,7 +75,8 @@ std::pair<int, int> get_refine_size(std::pair<int, int> original_size, std::pair
     return refine_size;
 }
 
-std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, const int max_slice_nums, const int scale_resolution, const int patch_size, const bool never_split) {
+// resizes and slices the image, slices are normalized directly from the source image w/o intermediate resized image
+std::vector<std::vector<clip_image_f32>> slice_image(const clip_ctx& ctx, const clip_image_u8& img, const int max_slice_nums, const int scale_resolution, const int patch_size, const bool never_split) {
     const std::pair<int, int> original_size{img.nx, img.ny};
     const int original_width = img.nx;
     const int original_height = img.ny;
@@ -83,13 +84,12 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
     const float ratio = 1.0f * original_width * original_height / (scale_resolution * scale_resolution);
     const int multiple = std::min(int(ceil(ratio)), max_slice_nums);
 
-    std::vector<std::vector<clip_image_u8>> images;
-    images.push_back(std::vector<clip_image_u8>{});
+    std::vector<std::vector<clip_image_f32>> images;
+    images.push_back(std::vector<clip_image_f32>{});
 
     if (multiple <= 1) {
         auto best_size = find_best_resize(original_size, scale_resolution, patch_size, true);
-        images.back().push_back(clip_image_u8{});
-        bicubic_resize(img, images.back().back(), best_size.first, best_size.second);
+        images.back().push_back(bicubic_resize_normalize(ctx, img, best_size.first, best_size.second, 0, 0, best_size.first, best_size.second));
     }
     else if (multiple > 1) {
 
@@ -102,8 +102,7 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
         }
 
         auto best_size = find_best_resize(original_size, scale_resolution, patch_size);
-        images.back().push_back(clip_image_u8{});
-        bicubic_resize(img, images.back().back(), best_size.first, best_size.second);
+        images.back().push_back(bicubic_resize_normalize(ctx, img, best_size.first, best_size.second, 0, 0, best_size.first, best_size.second));
 
         std::vector<std::pair<int, int>> candidate_grids;
 
@@ -128,31 +127,16 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
             }
         }
         auto refine_size = get_refine_size(original_size, best_grid, scale_resolution, patch_size, true);
-        clip_image_u8 refine_image;
-        bicubic_resize(img, refine_image, refine_size.first, refine_size.second);
 
-        // split_to_patches
-        int width = refine_image.nx;
-        int height = refine_image.ny;
+        // split_to_patches, each patch is a window of the refined image
+        int width = refine_size.first;
+        int height = refine_size.second;
         int grid_x = int(width / best_grid.first);
         int grid_y = int(height / best_grid.second);
         for (int patches_i = 0, ic = 0; patches_i < height && ic < best_grid.second; patches_i += grid_y, ic += 1) {
-            images.push_back(std::vector<clip_image_u8>{});
+            images.push_back(std::vector<clip_image_f32>{});
             for (int patches_j = 0, jc = 0; patches_j < width && jc < best_grid.first; patches_j += grid_x, jc += 1) {
-                images.back().push_back(clip_image_u8{});
-                clip_image_u8& patch = images.back().back();
-                patch.nx = grid_x;
-                patch.ny = grid_y;
-                patch.buf.resize(3 * patch.nx * patch.ny);
-                for (int y = patches_i; y < patches_i + grid_y; ++y) {
-                    for (int x = patches_j; x < patches_j + grid_x; ++x) {
-                        const int i = 3 * (y * refine_image.nx + x);
-                        const int j = 3 * ((y - patches_i) * patch.nx + (x - patches_j));
-                        patch.buf[j] = refine_image.buf[i];
-                        patch.buf[j + 1] = refine_image.buf[i + 1];
-                        patch.buf[j + 2] = refine_image.buf[i + 2];
-                    }
-                }
+                images.back().push_back(bicubic_resize_normalize(ctx, img, width, height, patches_j, patches_i, grid_x, grid_y));
             }
         }
     }
@@ -304,126 +288,149 @@ ov::Tensor prepare_vis_position_ids(
     return position_ids;
 }
 
-EncodedImage llava_image_embed_make_with_bytes_slice(clip_ctx& ctx_clip, const ov::Tensor& img, ov::InferRequest& encoder, int max_slice_nums, int scale_resolution, size_t patch_size, bool never_split) {
-    clip_image_u8 source = tensor_to_clip_image_u8(img);
-    std::vector<std::vector<clip_image_u8>> imgs = ::slice_image(source, max_slice_nums, scale_resolution, patch_size, never_split);
-    std::vector<std::vector<ov::Tensor>> results;
-    std::vector<std::vector<ImageSize>> sizes;
+// Encodes resized sources and slices of all images with a single inference. Views of different sizes are padded to
+// the largest one and masked with patch_attention_mask.
+std::vector<EncodedImage> llava_image_embed_make_with_bytes_slice(clip_ctx& ctx_clip, const std::vector<ov::Tensor>& imgs, ov::InferRequest& encoder, int max_slice_nums, int scale_resolution, size_t patch_size, bool never_split) {
     const size_t channels = 3;
 
-    std::vector<std::vector<clip_image_f32>> preprocessed{imgs.size()};
-    size_t max_h = 0, max_w = 0, n_images = 0, max_size = 0;
-    std::transform(imgs.begin(), imgs.end(), preprocessed.begin(), [&ctx_clip, &max_h, &max_w, &max_size, &n_images](const std::vector<clip_image_u8>& row) {
-        std::vector<clip_image_f32> processed_row{row.size()};
-        std::transform(row.begin(), row.end(), processed_row.begin(), [&ctx_clip, &max_h, &max_w, &max_size, &n_images](const clip_image_u8& raw) {
-            clip_image_f32 im = clip_image_preprocess(ctx_clip, raw);
-            if (size_t(im.ny) * size_t(im.nx) > max_size) {
-                max_size = size_t(im.ny) * size_t(im.nx);
-                max_h = size_t(im.ny);
-                max_w = size_t(im.nx);
+    // views of an image are its resized source followed by its slices row by row
+    std::vector<std::vector<std::vector<clip_image_f32>>> preprocessed_images;
+    preprocessed_images.reserve(imgs.size());
+    std::vector<clip_image_f32*> views;
+    std::vector<ImageSize> tgt_sizes;
+    std::vector<ImageSize> slices_sizes;
+    size_t max_size = 0;
+    for (const ov::Tensor& img : imgs) {
+        clip_image_u8 source = tensor_to_clip_image_u8(img);
+        std::vector<std::vector<clip_image_f32>> preprocessed = ::slice_image(ctx_clip, source, max_slice_nums, scale_resolution, patch_size, never_split);
+
+        size_t n_views = 0;
+        for (std::vector<clip_image_f32>& row : preprocessed) {
+            for (clip_image_f32& im : row) {
+                max_size = std::max(max_size, size_t(im.ny) * size_t(im.nx));
+                views.push_back(&im);
+                ++n_views;
             }
-            ++n_images;
-            return im;
-        });
-        return processed_row;
-    });
-
-    ov::Tensor pixel_values{ov::element::f32, {n_images, channels, patch_size, max_size / patch_size}};
-    size_t d3_all_pixel = pixel_values.get_shape().at(3);
-    float* pixel_value_data = pixel_values.data<float>();
-    
-    //image chw to 1*c*kernel*hw/kernel and padding zero
-    clip_image_f32& resized_preprocessed = preprocessed.at(0).at(0);
-    size_t img_h = resized_preprocessed.ny;
-    size_t img_w = resized_preprocessed.nx;
-    ov::Tensor clip_img{ov::element::f32, {1, channels, img_h, img_w}, resized_preprocessed.buf.data()};
-    ov::Tensor clip_pixel_values = preprocess_for_encoder(clip_img, patch_size);
-
-    float* clip_value_data = clip_pixel_values.data<float>();
-    size_t batch_pixel = 1;
-    size_t d3_clip_pixel = clip_pixel_values.get_shape().at(3);
-    for (size_t c_idx = 0; c_idx < channels; ++c_idx) {
-        for (size_t k_idx = 0; k_idx < patch_size; k_idx++) {
-            std::copy(clip_value_data, clip_value_data + d3_clip_pixel, pixel_value_data);
-            clip_value_data += d3_clip_pixel;
-            pixel_value_data += d3_all_pixel; 
         }
-    }
 
-    if (1 < preprocessed.size()) {
-        for (size_t row = 1; row < preprocessed.size(); ++row) {
-            size_t n_slices = preprocessed.at(row).size();
-            for (size_t col = 0; col < n_slices; ++col) {
-                clip_image_f32& elem = preprocessed.at(row).at(col);
-                img_h = elem.ny;
-                img_w = elem.nx;
-                ov::Tensor clip_img{ov::element::f32, {1, channels, img_h, img_w}, elem.buf.data()};
-                ov::Tensor clip_pixel_values = preprocess_for_encoder(clip_img, patch_size);
-                
-                d3_clip_pixel = clip_pixel_values.get_shape().at(3);
-                clip_value_data = clip_pixel_values.data<float>();
-                pixel_value_data = pixel_values.data<float>() + batch_pixel * channels * patch_size * d3_all_pixel;
-                for (size_t c_idx = 0; c_idx < channels; ++c_idx) {
-                    for (size_t k_idx = 0; k_idx < patch_size; k_idx++) {
-                        std::copy(clip_value_data, clip_value_data + d3_clip_pixel, pixel_value_data);
-                        clip_value_data += d3_clip_pixel;
-                        pixel_value_data += d3_all_pixel;
-                    }
+        const clip_image_f32& resized_preprocessed = preprocessed.at(0).at(0);
+        std::vector<ImageSize> image_tgt_sizes{{resized_preprocessed.ny / patch_size, resized_preprocessed.nx / patch_size}};
+        if (1 < preprocessed.size()) {
+            for (const std::vector<clip_image_f32>& row : preprocessed) {
+                for (const clip_image_f32& elem : row) {
+                    image_tgt_sizes.push_back({elem.ny / patch_size, elem.nx / patch_size});
                 }
-                batch_pixel++;
             }
         }
+        // position ids are computed for views of this image only
+        tgt_sizes.insert(tgt_sizes.end(), image_tgt_sizes.begin(), image_tgt_sizes.begin() + n_views);
+        slices_sizes.push_back(image_tgt_sizes.size() > 1 ? image_tgt_sizes.at(1) : ImageSize{});
+        preprocessed_images.push_back(std::move(preprocessed));
     }
-    encoder.set_tensor("pixel_values", pixel_values);
 
-    ov::Tensor patch_attention_mask{ov::element::f32, {pixel_values.get_shape().at(0), 1, max_h / patch_size * max_w / patch_size}};
+    //image chw to 1*c*kernel*hw/kernel and padding zero
+    ov::Tensor pixel_values{ov::element::f32, {views.size(), channels, patch_size, max_size / patch_size}};
+    size_t d3_all_pixel = pixel_values.get_shape().at(3);
+    std::fill_n(pixel_values.data<float>(), pixel_values.get_size(), 0.0f);
+
+    const size_t max_patches = max_size / patch_size / patch_size;
+    ov::Tensor patch_attention_mask{ov::element::f32, {views.size(), 1, max_patches}};
     float* attention_data = patch_attention_mask.data<float>();
     std::fill_n(attention_data, patch_attention_mask.get_size(), 0.0f);
-    std::fill_n(attention_data, resized_preprocessed.ny / patch_size * resized_preprocessed.nx / patch_size, 1.0f);
-    if (1 < preprocessed.size()) {
-        for (size_t row = 1; row < preprocessed.size(); ++row) {
-            size_t n_slices = preprocessed.at(row).size();
-            for (size_t col = 0; col < n_slices; ++col) {
-                const clip_image_f32& elem = preprocessed.at(row).at(col);
-                std::fill_n(attention_data + ((row - 1) * n_slices + col + 1) * max_h / patch_size * max_w / patch_size, elem.ny / patch_size * elem.nx / patch_size, 1.0f);
+
+    for (size_t view_idx = 0; view_idx < views.size(); ++view_idx) {
+        clip_image_f32& elem = *views.at(view_idx);
+        ov::Tensor clip_img{ov::element::f32, {1, channels, size_t(elem.ny), size_t(elem.nx)}, elem.buf.data()};
+        ov::Tensor clip_pixel_values = preprocess_for_encoder(clip_img, patch_size);
+
+        size_t d3_clip_pixel = clip_pixel_values.get_shape().at(3);
+        const float* clip_value_data = clip_pixel_values.data<float>();
+        float* pixel_value_data = pixel_values.data<float>() + view_idx * channels * patch_size * d3_all_pixel;
+        for (size_t c_idx = 0; c_idx < channels; ++c_idx) {
+            for (size_t k_idx = 0; k_idx < patch_size; k_idx++) {
+                std::copy(clip_value_data, clip_value_data + d3_clip_pixel, pixel_value_data);
+                clip_value_data += d3_clip_pixel;
+                pixel_value_data += d3_all_pixel;
             }
         }
+        std::fill_n(attention_data + view_idx * max_patches, elem.ny / patch_size * elem.nx / patch_size, 1.0f);
     }
+    encoder.set_tensor("pixel_values", pixel_values);
     encoder.set_tensor("patch_attention_mask", patch_attention_mask);
 
-    ImageSize resized_source_size{resized_preprocessed.ny / patch_size, resized_preprocessed.nx / patch_size};
-    std::vector<ImageSize> tgt_sizes{resized_source_size};
-    if (1 < preprocessed.size()) {
-        for (const std::vector<clip_image_f32>& row : preprocessed) {
-            for (const clip_image_f32& elem : row) {
-                tgt_sizes.push_back({elem.ny / patch_size, elem.nx / patch_size});
-            }
-        }
-    }
     ov::Tensor position_ids = prepare_vis_position_ids(pixel_values, patch_attention_mask, tgt_sizes, patch_size, ctx_clip.image_size / patch_size);
     encoder.set_tensor("position_ids", position_ids);
     encoder.infer();
     const ov::Tensor& output_tensor = encoder.get_output_tensor();
 
-    if (1 == preprocessed.size()) {
-        ov::Tensor resized_source{ov::element::f32, output_tensor.get_shape()};
-        output_tensor.copy_to(resized_source);
-        return {std::move(resized_source), resized_source_size};
+    const size_t old_hidden_size = output_tensor.get_shape().at(2);
+    // embeddings of each view are padded to the largest view
+    const size_t view_stride = output_tensor.get_shape().at(1) * old_hidden_size;
+    const float* out = output_tensor.data<float>();
+
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(imgs.size());
+    size_t view_offset = 0;
+    for (size_t image_idx = 0; image_idx < preprocessed_images.size(); ++image_idx) {
+        const std::vector<std::vector<clip_image_f32>>& preprocessed = preprocessed_images.at(image_idx);
+        const clip_image_f32& resized_preprocessed = preprocessed.at(0).at(0);
+        ImageSize resized_source_size{resized_preprocessed.ny / patch_size, resized_preprocessed.nx / patch_size};
+        ov::Tensor resized_source{ov::element::f32, {1, resized_source_size.height * resized_source_size.width, old_hidden_size}};
+        std::copy_n(out + view_offset * view_stride, resized_source.get_size(), resized_source.data<float>());
+
+        if (1 == preprocessed.size()) {
+            encoded_images.push_back({std::move(resized_source), resized_source_size});
+            ++view_offset;
+            continue;
+        }
+
+        const size_t n_rows = preprocessed.size() - 1, n_cols = preprocessed.at(1).size();
+        const ImageSize& slices_size = slices_sizes.at(image_idx);
+        size_t n_patches = slices_size.height * slices_size.width;
+        ov::Tensor encoded_slices{ov::element::f32, {n_rows, n_cols, n_patches, old_hidden_size}};
+        for (size_t slice_idx = 0; slice_idx < n_rows * n_cols; ++slice_idx) {
+            std::copy_n(out + (view_offset + slice_idx + 1) * view_stride, n_patches * old_hidden_size, encoded_slices.data<float>() + slice_idx * n_patches * old_hidden_size);
+        }
+        encoded_images.push_back({std::move(resized_source), resized_source_size, std::move(encoded_slices), slices_size});
+        view_offset += 1 + n_rows * n_cols;
     }
+    return encoded_images;
+}
 
-    size_t old_hidden_size = output_tensor.get_shape().at(2);
-    const float* out = output_tensor.data<float>();
-    ov::Tensor resized_source{ov::element::f32, {1, resized_source_size.height * resized_source_size.width, old_hidden_size}};
-    std::copy_n(out, resized_source.get_size(), resized_source.data<float>());
-
-    size_t n_patches = tgt_sizes.at(1).height * tgt_sizes.at(1).width;
-    ov::Tensor encoded_slices{ov::element::f32, {preprocessed.size() - 1, preprocessed.at(1).size(), n_patches, old_hidden_size}};
-    for (size_t col = 0; col < preprocessed.size() - 1; ++col) {
-        for (size_t row = 0; row < preprocessed.at(1).size(); ++row) {
-            std::copy_n(out + (col * preprocessed.at(1).size() + row + 1) * n_patches * old_hidden_size, n_patches * old_hidden_size, encoded_slices.data<float>() + (col * preprocessed.at(1).size() + row) * n_patches * old_hidden_size);
+// Encodes pixel values of several images with a single inference. Pixel values of all images have the same
+// [C, H, W] and are stacked along the batch dimension, so the output is split back by batch sizes of images.
+std::vector<ov::Tensor> infer_batched(ov::InferRequest& encoder, const std::vector<ov::Tensor>& pixel_values) {
+    ov::Tensor batched_pixel_values = pixel_values.at(0);
+    if (pixel_values.size() > 1) {
+        ov::Shape batched_shape = pixel_values.at(0).get_shape();
+        batched_shape.at(0) = 0;
+        for (const ov::Tensor& image_pixel_values : pixel_values) {
+            batched_shape.at(0) += image_pixel_values.get_shape().at(0);
         }
+        batched_pixel_values = ov::Tensor(ov::element::f32, batched_shape);
+        uint8_t* batched_data = static_cast<uint8_t*>(batched_pixel_values.data());
+        for (const ov::Tensor& image_pixel_values : pixel_values) {
+            std::memcpy(batched_data, image_pixel_values.data(), image_pixel_values.get_byte_size());
+            batched_data += image_pixel_values.get_byte_size();
+        }
+    }
+
+    encoder.set_tensor("pixel_values", batched_pixel_values);
+    encoder.infer();
+
+    const ov::Tensor& infer_output = encoder.get_output_tensor();
+    std::vector<ov::Tensor> image_features;
+    image_features.reserve(pixel_values.size());
+    const uint8_t* output_data = static_cast<const uint8_t*>(infer_output.data());
+    for (const ov::Tensor& image_pixel_values : pixel_values) {
+        ov::Shape features_shape = infer_output.get_shape();
+        features_shape.at(0) = image_pixel_values.get_shape().at(0);
+        ov::Tensor features(infer_output.get_element_type(), features_shape);
+        std::memcpy(features.data(), output_data, features.get_byte_size());
+        output_data += features.get_byte_size();
+        image_features.push_back(std::move(features));
     }
-    return {resized_source, resized_source_size, encoded_slices, tgt_sizes.at(1)};
+    return image_features;
 }
 
 ProcessorConfig from_any_map(
@@ -443,52 +450,24 @@ ProcessorConfig from_any_map(
 }
 
 clip_image_f32 preprocess_clip_image_llava(const clip_image_u8& image, const ProcessorConfig& config) {
-    bool do_resize = true;
-    bool do_center_crop = true;
-
     // Resize
-    clip_image_u8 resized_image;
-    if (do_resize) {
-        int target_size = config.size_shortest_edge;
-        float scale = static_cast<float>(target_size) / std::min(image.nx, image.ny);
-        int new_width = static_cast<int>(image.nx * scale);
-        int new_height = static_cast<int>(image.ny * scale);
-        bicubic_resize(image, resized_image, new_width, new_height);
-    } else {
-        resized_image = image;
-    }
+    int target_size = config.size_shortest_edge;
+    float scale = static_cast<float>(target_size) / std::min(image.nx, image.ny);
+    int new_width = static_cast<int>(image.nx * scale);
+    int new_height = static_cast<int>(image.ny * scale);
 
     // Center crop
-    clip_image_u8 cropped_image;
-    if (do_center_crop) {
-        int crop_height = config.crop_size_height;
-        int crop_width = config.crop_size_width;
-        int start_x = (resized_image.nx - crop_width) / 2;
-        int start_y = (resized_image.ny - crop_height) / 2;
-
-        cropped_image.nx = crop_width;
-        cropped_image.ny = crop_height;
-        cropped_image.buf.resize(3 * crop_width * crop_height);
-
-        for (int y = 0; y < crop_height; ++y) {
-            for (int x = 0; x < crop_width; ++x) {
-                for (int c = 0; c < 3; ++c) {
-                    cropped_image.buf[(y * crop_width + x) * 3 + c] = 
-                        resized_image.buf[((start_y + y) * resized_image.nx + (start_x + x)) * 3 + c];
-                }
-            }
-        }
-    } else {
-        cropped_image = resized_image;
-    }
+    int crop_height = config.crop_size_height;
+    int crop_width = config.crop_size_width;
+    int start_x = (new_width - crop_width) / 2;
+    int start_y = (new_height - crop_height) / 2;
 
-    // Normalize
+    // Normalize, only cropped part of the image is resized
     clip_ctx ctx;
     std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
     std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
 
-    clip_image_f32 normalized_image = clip_image_preprocess(ctx, cropped_image);
-    return normalized_image;
+    return bicubic_resize_normalize(ctx, image, new_width, new_height, start_x, start_y, crop_width, crop_height);
 }
 
 ov::Tensor get_pixel_values_llava(const ov::Tensor& image, const ProcessorConfig& config) {
@@ -529,7 +508,9 @@ ov::Tensor get_pixel_values_llava_next(const ov::Tensor& image, const ProcessorC
     return concatenated_tensor;
 }
 
-std::vector<clip_image_u8> split_image_internvl(
+// splits resized image to normalized blocks, which are computed directly from the source image
+std::vector<clip_image_f32> split_image_internvl(
+    const clip_ctx& ctx,
     const clip_image_u8& image,
     int image_size,
     int min_num = 1,
@@ -577,36 +558,15 @@ std::vector<clip_image_u8> split_image_internvl(
     int target_height = image_size * target_aspect_ratio.second;
     int blocks = target_aspect_ratio.first * target_aspect_ratio.second;
 
-    clip_image_u8 resized_img;
-    bicubic_resize(image, resized_img, target_width, target_height);
-
-    std::vector<clip_image_u8> processed_images;
+    std::vector<clip_image_f32> processed_images;
     for (int i = 0; i < blocks; ++i) {
         int x = (i % (target_width / image_size)) * image_size;
         int y = (i / (target_width / image_size)) * image_size;
-
-        clip_image_u8 split_img;
-        split_img.nx = image_size;
-        split_img.ny = image_size;
-        split_img.buf.resize(3 * image_size * image_size);
-
-        for (int dy = 0; dy < image_size; ++dy) {
-            for (int dx = 0; dx < image_size; ++dx) {
-                for (int c = 0; c < 3; ++c) {
-                    int src_idx = ((y + dy) * target_width + (x + dx)) * 3 + c;
-                    int dst_idx = (dy * image_size + dx) * 3 + c;
-                    split_img.buf[dst_idx] = resized_img.buf[src_idx];
-                }
-            }
-        }
-
-        processed_images.push_back(std::move(split_img));
+        processed_images.push_back(bicubic_resize_normalize(ctx, image, target_width, target_height, x, y, image_size, image_size));
     }
 
     if (use_thumbnail && processed_images.size() != 1) {
-        clip_image_u8 thumbnail_img;
-        bicubic_resize(image, thumbnail_img, image_size, image_size);
-        processed_images.push_back(std::move(thumbnail_img));
+        processed_images.push_back(bicubic_resize_normalize(ctx, image, image_size, image_size, 0, 0, image_size, image_size));
     }
 
     return processed_images;
@@ -622,13 +582,7 @@ ov::Tensor get_pixel_values_internvl(const ov::Tensor& image, const ProcessorCon
     std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
     std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
 
-    std::vector<clip_image_u8> splitted_images = split_image_internvl(input_image, image_size);
-
-    std::vector<clip_image_f32> processed_images;
-    processed_images.reserve(splitted_images.size());
-    for (const auto& image : splitted_images) {
-        processed_images.push_back(clip_image_preprocess(ctx, image));
-    }
+    std::vector<clip_image_f32> processed_images = split_image_internvl(ctx, input_image, image_size);
 
     size_t batch_size = processed_images.size();
     size_t channels = 3;
@@ -672,14 +626,21 @@ VisionEncoder::VisionEncoder(
 }
 
 EncodedImage VisionEncoder::encode(const ov::Tensor& image, const ProcessorConfig& config) {
+    return encode(std::vector<ov::Tensor>{image}, config).at(0);
+}
+
+std::vector<EncodedImage> VisionEncoder::encode(const std::vector<ov::Tensor>& images, const ProcessorConfig& config) {
+    if (images.empty()) {
+        return {};
+    }
     if (model_type == VLMModelType::MINICPM) {
-        return encode_minicpm(image, config);
+        return encode_minicpm(images, config);
     } else if (model_type == VLMModelType::LLAVA) {
-        return encode_llava(image, config);
+        return encode_llava(images, config);
     } else if (model_type == VLMModelType::LLAVA_NEXT) {
-        return encode_llava_next(image, config);
+        return encode_llava_next(images, config);
     }  else if (model_type == VLMModelType::INTERNVL_CHAT) {
-        return encode_internvl(image, config);
+        return encode_internvl(images, config);
     } else {
         OPENVINO_THROW("Unsupported type of VisionEncoder");
     }
@@ -691,65 +652,74 @@ EncodedImage VisionEncoder::encode(const ov::Tensor& image, const ov::AnyMap& co
     ));
 }
 
-EncodedImage VisionEncoder::encode_minicpm(const ov::Tensor& image, const ProcessorConfig& config) {
+std::vector<EncodedImage> VisionEncoder::encode_minicpm(const std::vector<ov::Tensor>& images, const ProcessorConfig& config) {
     clip_ctx ctx_clip;
     ctx_clip.image_size = m_processor_config.image_size;
     std::copy(config.norm_mean.begin(), config.norm_mean.end(), ctx_clip.image_mean);
     std::copy(config.norm_std.begin(), config.norm_std.end(), ctx_clip.image_std);
-    return llava_image_embed_make_with_bytes_slice(ctx_clip, image, m_vision_encoder, config.max_slice_nums, config.scale_resolution, config.patch_size, 0 == config.max_slice_nums);
+    return llava_image_embed_make_with_bytes_slice(ctx_clip, images, m_vision_encoder, config.max_slice_nums, config.scale_resolution, config.patch_size, 0 == config.max_slice_nums);
 }
 
-EncodedImage VisionEncoder::encode_llava(const ov::Tensor& image, const ProcessorConfig& config) {
-    ov::Tensor pixel_values = get_pixel_values_llava(image, config);
-
-    m_vision_encoder.set_tensor("pixel_values", pixel_values);
-    m_vision_encoder.infer();
-
-    const ov::Tensor& infer_output = m_vision_encoder.get_output_tensor();
-    ov::Tensor image_features(infer_output.get_element_type(), infer_output.get_shape());
-    std::memcpy(image_features.data(), infer_output.data(), infer_output.get_byte_size());
+std::vector<EncodedImage> VisionEncoder::encode_llava(const std::vector<ov::Tensor>& images, const ProcessorConfig& config) {
+    std::vector<ov::Tensor> pixel_values;
+    pixel_values.reserve(images.size());
+    for (const ov::Tensor& image : images) {
+        pixel_values.push_back(get_pixel_values_llava(image, config));
+    }
+    std::vector<ov::Tensor> image_features = infer_batched(m_vision_encoder, pixel_values);
 
     ImageSize resized_source_size{config.crop_size_height / config.patch_size, config.crop_size_width / config.patch_size};
 
-    return {std::move(image_features), resized_source_size};
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(images.size());
+    for (ov::Tensor& features : image_features) {
+        encoded_images.push_back({std::move(features), resized_source_size});
+    }
+    return encoded_images;
 }
 
-EncodedImage VisionEncoder::encode_llava_next(const ov::Tensor& image, const ProcessorConfig& config) {
-    ov::Tensor pixel_values = get_pixel_values_llava_next(image, config);
-
-    m_vision_encoder.set_tensor("pixel_values", pixel_values);
-    m_vision_encoder.infer();
-
-    const ov::Tensor& infer_output = m_vision_encoder.get_output_tensor();
-    ov::Tensor image_features(infer_output.get_element_type(), infer_output.get_shape());
-    std::memcpy(image_features.data(), infer_output.data(), infer_output.get_byte_size());
+std::vector<EncodedImage> VisionEncoder::encode_llava_next(const std::vector<ov::Tensor>& images, const ProcessorConfig& config) {
+    std::vector<ov::Tensor> pixel_values;
+    pixel_values.reserve(images.size());
+    for (const ov::Tensor& image : images) {
+        pixel_values.push_back(get_pixel_values_llava_next(image, config));
+    }
+    std::vector<ov::Tensor> image_features = infer_batched(m_vision_encoder, pixel_values);
 
     ImageSize resized_source_size{config.crop_size_height / config.patch_size, config.crop_size_width / config.patch_size};
 
-    // Gen number of patches
-    ImageSize original_image_size{image.get_shape().at(1), image.get_shape().at(2)};
-    auto best_resolution = select_best_resolution({original_image_size.width, original_image_size.height}, config.image_grid_pinpoints);
-    int num_patches_w = best_resolution.first / config.size_shortest_edge;
-    int num_patches_h = best_resolution.second / config.size_shortest_edge;
-
-    EncodedImage encoded_image;
-    encoded_image.resized_source = std::move(image_features);
-    encoded_image.resized_source_size = resized_source_size;
-    encoded_image.patches_grid = {num_patches_h, num_patches_w};
-    return encoded_image;
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(images.size());
+    for (size_t image_idx = 0; image_idx < images.size(); ++image_idx) {
+        // Gen number of patches
+        ImageSize original_image_size{images.at(image_idx).get_shape().at(1), images.at(image_idx).get_shape().at(2)};
+        auto best_resolution = select_best_resolution({original_image_size.width, original_image_size.height}, config.image_grid_pinpoints);
+        int num_patches_w = best_resolution.first / config.size_shortest_edge;
+        int num_patches_h = best_resolution.second / config.size_shortest_edge;
+
+        EncodedImage encoded_image;
+        encoded_image.resized_source = std::move(image_features.at(image_idx));
+        encoded_image.resized_source_size = resized_source_size;
+        encoded_image.patches_grid = {num_patches_h, num_patches_w};
+        encoded_images.push_back(std::move(encoded_image));
+    }
+    return encoded_images;
 }
 
-EncodedImage VisionEncoder::encode_internvl(const ov::Tensor& image, const ProcessorConfig& config) {
-    ov::Tensor pixel_values = get_pixel_values_internvl(image, config);
-
-    m_vision_encoder.set_tensor("pixel_values", pixel_values);
-    m_vision_encoder.infer();
-
-    const ov::Tensor& infer_output = m_vision_encoder.get_output_tensor();
-    ov::Tensor image_features(infer_output.get_element_type(), infer_output.get_shape());
-    std::memcpy(image_features.data(), infer_output.data(), infer_output.get_byte_size());
+std::vector<EncodedImage> VisionEncoder::encode_internvl(const std::vector<ov::Tensor>& images, const ProcessorConfig& config) {
+    std::vector<ov::Tensor> pixel_values;
+    pixel_values.reserve(images.size());
+    for (const ov::Tensor& image : images) {
+        pixel_values.push_back(get_pixel_values_internvl(image, config));
+    }
+    std::vector<ov::Tensor> image_features = infer_batched(m_vision_encoder, pixel_values);
 
     ImageSize resized_source_size{config.crop_size_height / config.patch_size, config.crop_size_width / config.patch_size};
 
-    return {std::move(image_features), resized_source_size};
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(images.size());
+    for (ov::Tensor& features : image_features) {
+        encoded_images.push_back({std::move(features), resized_source_size});
+    }
+    return encoded_images;
 }
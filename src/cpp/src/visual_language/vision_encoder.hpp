@@ -112,6 +112,26 @@ public:
         const ov::Tensor& image, const ProcessorConfig& config
     );
 
+    /// @brief Compute embeddings of several images with a single
+    /// inference of the vision encoder.
+    /// @param images Images to infer embeddings for. Each image shape
+    /// must be [1CHW].
+    /// @return Resulting embeddings for each image in the same order.
+    std::vector<EncodedImage> encode(const std::vector<ov::Tensor>& images) {
+        return encode(images, m_processor_config);
+    }
+
+    /// @brief Compute embeddings of several images with a single
+    /// inference of the vision encoder given ProcessorConfig.
+    /// @param images Images to infer embeddings for. Each image shape
+    /// must be [1CHW].
+    /// @param config A config to follow instead of the config obtained
+    /// in constructors.
+    /// @return Resulting embeddings for each image in the same order.
+    std::vector<EncodedImage> encode(
+        const std::vector<ov::Tensor>& images, const ProcessorConfig& config
+    );
+
     /// @brief Compute embeddings of an image given
     /// ProcessorConfig members.
     /// @param image An image to infer embeddings for. Image shape must be
@@ -143,20 +163,20 @@ public:
     }
 
 private:
-    EncodedImage encode_minicpm(
-        const ov::Tensor& image, const ProcessorConfig& config
+    std::vector<EncodedImage> encode_minicpm(
+        const std::vector<ov::Tensor>& images, const ProcessorConfig& config
     );
 
-    EncodedImage encode_llava(
-        const ov::Tensor& image, const ProcessorConfig& config
+    std::vector<EncodedImage> encode_llava(
+        const std::vector<ov::Tensor>& images, const ProcessorConfig& config
     );
 
-    EncodedImage encode_llava_next(
-        const ov::Tensor& image, const ProcessorConfig& config
+    std::vector<EncodedImage> encode_llava_next(
+        const std::vector<ov::Tensor>& images, const ProcessorConfig& config
     );
 
-    EncodedImage encode_internvl(
-        const ov::Tensor& image, const ProcessorConfig& config
+    std::vector<EncodedImage> encode_internvl(
+        const std::vector<ov::Tensor>& images, const ProcessorConfig& config
     );
 };
 }
@@ -0,0 +1,219 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "vocab_detokenizer.hpp"
+
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/result.hpp"
+
+namespace {
+
+// Operations of the detokenizer model, which are reproduced by VocabDetokenizer
+const std::set<std::string> SUPPORTED_OPS = {
+    "Parameter", "Convert", "VocabDecoder", "CharsToBytes", "FuzeRagged", "UTF8Validate", "StringTensorPack", "Result"
+};
+
+class BoolAttributeReader : public ov::AttributeVisitor {
+public:
+    using ov::AttributeVisitor::on_adapter;
+
+    void on_adapter(const std::string&, ov::ValueAccessor<void>&) override {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        m_values[name] = adapter.get();
+    }
+
+    std::map<std::string, bool> m_values;
+};
+
+// Inverse of bytes_to_unicode() of GPT-2 byte level BPE, which maps bytes to printable characters
+std::unordered_map<uint32_t, char> unicode_to_bytes() {
+    std::unordered_map<uint32_t, char> unicode_to_bytes;
+    uint32_t next_code_point = 256;
+    for (uint32_t byte = 0; byte < 256; ++byte) {
+        const bool is_printable = (byte >= '!' && byte <= '~') || (byte >= 0xA1 && byte <= 0xAC) || byte >= 0xAE;
+        unicode_to_bytes[is_printable ? byte : next_code_point++] = static_cast<char>(byte);
+    }
+    return unicode_to_bytes;
+}
+
+// Returns false if the token is not a valid UTF-8 string or has a character, which doesn't encode a byte
+bool chars_to_bytes(std::string& token, const std::unordered_map<uint32_t, char>& unicode_to_bytes) {
+    std::string bytes;
+    for (size_t i = 0; i < token.size();) {
+        const unsigned char lead = token[i];
+        const size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+        if (length == 0 || i + length > token.size())
+            return false;
+        uint32_t code_point = length == 1 ? lead : lead & (0x7F >> length);
+        for (size_t j = 1; j < length; ++j)
+            code_point = (code_point << 6) | (static_cast<unsigned char>(token[i + j]) & 0x3F);
+        auto byte = unicode_to_bytes.find(code_point);
+        if (byte == unicode_to_bytes.end())
+            return false;
+        bytes.push_back(byte->second);
+        i += length;
+    }
+    token = std::move(bytes);
+    return true;
+}
+
+// Length of a valid UTF-8 sequence at text[pos] or 0. For invalid sequences, maximal_subpart is set
+// to the number of bytes, which are replaced with one replacement character like in Python's bytes.decode().
+size_t valid_utf8_length(const std::string& text, size_t pos, size_t& maximal_subpart) {
+    const unsigned char lead = text[pos];
+    maximal_subpart = 1;
+    if (lead < 0x80)
+        return 1;
+    size_t length = 0;
+    unsigned char second_min = 0x80, second_max = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        second_min = lead == 0xE0 ? 0xA0 : 0x80;
+        second_max = lead == 0xED ? 0x9F : 0xBF;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        second_min = lead == 0xF0 ? 0x90 : 0x80;
+        second_max = lead == 0xF4 ? 0x8F : 0xBF;
+    } else {
+        return 0;
+    }
+    for (size_t i = 1; i < length; ++i) {
+        if (pos + i >= text.size())
+            return 0;
+        const unsigned char byte = text[pos + i];
+        if (byte < (i == 1 ? second_min : 0x80) || byte > (i == 1 ? second_max : 0xBF))
+            return 0;
+        maximal_subpart = i + 1;
+    }
+    return length;
+}
+
+} // namespace
+
+namespace ov {
+namespace genai {
+
+std::shared_ptr<VocabDetokenizer> VocabDetokenizer::create(const std::shared_ptr<ov::Model>& detokenizer, ov::Core& core) {
+    std::shared_ptr<ov::Model> model = detokenizer->clone();
+    std::shared_ptr<ov::Node> vocab_decoder;
+    bool has_chars_to_bytes = false;
+    std::shared_ptr<ov::Node> utf8_validate;
+
+    // operations, which process tokens, excluding inputs with vocab and special tokens of VocabDecoder
+    std::vector<std::shared_ptr<ov::Node>> nodes_to_visit(model->get_results().begin(), model->get_results().end());
+    std::set<ov::Node*> visited;
+    while (!nodes_to_visit.empty()) {
+        std::shared_ptr<ov::Node> node = nodes_to_visit.back();
+        nodes_to_visit.pop_back();
+        if (!visited.insert(node.get()).second)
+            continue;
+
+        const std::string type_name = node->get_type_info().name;
+        if (SUPPORTED_OPS.count(type_name) == 0)
+            return nullptr;
+        if (type_name == "VocabDecoder") {
+            if (vocab_decoder || node->get_input_size() < 4)
+                return nullptr;
+            vocab_decoder = node;
+            nodes_to_visit.push_back(node->get_input_node_shared_ptr(0));
+            continue;
+        }
+        has_chars_to_bytes |= type_name == "CharsToBytes";
+        if (type_name == "UTF8Validate")
+            utf8_validate = node;
+        for (size_t i = 0; i < node->get_input_size(); ++i)
+            nodes_to_visit.push_back(node->get_input_node_shared_ptr(i));
+    }
+    if (!vocab_decoder)
+        return nullptr;
+
+    // vocab begins, ends, chars and special tokens are constant, so the subgraph computing them is inferred once
+    ov::ResultVector results;
+    for (size_t i = 1; i < vocab_decoder->get_input_size(); ++i)
+        results.push_back(std::make_shared<ov::op::v0::Result>(vocab_decoder->input_value(i)));
+    ov::InferRequest vocab_request;
+    try {
+        vocab_request = core.compile_model(std::make_shared<ov::Model>(results, ov::ParameterVector{}), "CPU").create_infer_request();
+        vocab_request.infer();
+    } catch (const ov::Exception&) {
+        return nullptr;
+    }
+
+    const ov::Tensor begins = vocab_request.get_output_tensor(0);
+    const ov::Tensor ends = vocab_request.get_output_tensor(1);
+    const ov::Tensor chars = vocab_request.get_output_tensor(2);
+    if (begins.get_element_type() != ov::element::i32 || ends.get_element_type() != ov::element::i32 || chars.get_element_type() != ov::element::u8)
+        return nullptr;
+
+    std::shared_ptr<VocabDetokenizer> vocab_detokenizer(new VocabDetokenizer());
+    const int32_t* begins_data = begins.data<const int32_t>();
+    const int32_t* ends_data = ends.data<const int32_t>();
+    const char* chars_data = static_cast<const char*>(chars.data());
+    const auto unicode_to_bytes_map = has_chars_to_bytes ? unicode_to_bytes() : std::unordered_map<uint32_t, char>{};
+    vocab_detokenizer->m_vocab.reserve(begins.get_size());
+    for (size_t i = 0; i < begins.get_size(); ++i) {
+        std::string token(chars_data + begins_data[i], chars_data + ends_data[i]);
+        if (has_chars_to_bytes && !chars_to_bytes(token, unicode_to_bytes_map))
+            return nullptr;
+        vocab_detokenizer->m_vocab.push_back(std::move(token));
+    }
+
+    vocab_detokenizer->m_is_special.resize(vocab_detokenizer->m_vocab.size(), false);
+    if (vocab_decoder->get_input_size() > 4) {
+        const ov::Tensor special_tokens = vocab_request.get_output_tensor(3);
+        if (special_tokens.get_element_type() != ov::element::i32)
+            return nullptr;
+        const int32_t* special_tokens_data = special_tokens.data<const int32_t>();
+        for (size_t i = 0; i < special_tokens.get_size(); ++i) {
+            const int32_t token = special_tokens_data[i];
+            if (token >= 0 && static_cast<size_t>(token) < vocab_detokenizer->m_vocab.size()) {
+                vocab_detokenizer->m_is_special[token] = true;
+                vocab_detokenizer->m_special_tokens.push_back(token);
+            }
+        }
+    }
+
+    if (utf8_validate) {
+        BoolAttributeReader attributes;
+        utf8_validate->visit_attributes(attributes);
+        vocab_detokenizer->m_validate_utf8 = true;
+        vocab_detokenizer->m_replace_invalid_utf8 = attributes.m_values["replace_mode"];
+    }
+    return vocab_detokenizer;
+}
+
+std::string VocabDetokenizer::decode(const std::vector<int64_t>& tokens, bool skip_special_tokens) const {
+    std::string text;
+    for (int64_t token : tokens) {
+        if (token < 0 || static_cast<size_t>(token) >= m_vocab.size() || (skip_special_tokens && m_is_special[token]))
+            continue;
+        text += m_vocab[token];
+    }
+    if (!m_validate_utf8)
+        return text;
+
+    std::string validated;
+    validated.reserve(text.size());
+    for (size_t pos = 0; pos < text.size();) {
+        size_t maximal_subpart = 0;
+        if (size_t length = valid_utf8_length(text, pos, maximal_subpart)) {
+            validated.append(text, pos, length);
+            pos += length;
+        } else {
+            if (m_replace_invalid_utf8)
+                validated += "\xEF\xBF\xBD";
+            pos += maximal_subpart;
+        }
+    }
+    return validated;
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,50 @@
+// Copyright (C) 2023-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief In-process detokenizer, which concatenates vocab strings of tokens without inference of the detokenizer model.
+ * Supports detokenizers consisting of VocabDecoder, CharsToBytes, FuzeRagged and UTF8Validate only (e.g. byte level BPE).
+ * Vocab and special tokens are read from constant inputs of VocabDecoder.
+ */
+class VocabDetokenizer {
+public:
+    /**
+     * @brief Returns nullptr if the detokenizer model has operations, which are not supported.
+     * Must be called before the model is made stateful by MakeVocabDecoderSatateful.
+     */
+    static std::shared_ptr<VocabDetokenizer> create(const std::shared_ptr<ov::Model>& detokenizer, ov::Core& core);
+
+    std::string decode(const std::vector<int64_t>& tokens, bool skip_special_tokens) const;
+
+    size_t get_vocab_size() const {
+        return m_vocab.size();
+    }
+
+    const std::vector<int64_t>& get_special_tokens() const {
+        return m_special_tokens;
+    }
+
+private:
+    VocabDetokenizer() = default;
+
+    std::vector<std::string> m_vocab;
+    std::vector<bool> m_is_special;
+    std::vector<int64_t> m_special_tokens;
+    bool m_validate_utf8 = false;
+    bool m_replace_invalid_utf8 = false;
+};
+
+} // namespace genai
+} // namespace ov
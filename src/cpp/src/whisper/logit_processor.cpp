@@ -10,7 +10,7 @@ namespace ov {
 namespace genai {
 
 void do_suppress_tokens(ov::Tensor& logits, const size_t batch_idx, const std::vector<int64_t>& suppress_tokens) {
-    OPENVINO_ASSERT(logits.get_shape()[0] >= batch_idx, "logits batch size doesn't match the batch number");
+    OPENVINO_ASSERT(logits.get_shape()[0] > batch_idx, "logits batch size doesn't match the batch number");
 
     size_t vocab_size = logits.get_shape().back();
     size_t batch_offset = batch_idx * logits.get_shape()[1] * vocab_size;
@@ -27,8 +27,7 @@ void process_whisper_timestamp_logits(ov::Tensor& logits,
                                       const ov::genai::WhisperGenerationConfig& config,
                                       const std::vector<int64_t>& generated_tokens,
                                       bool initial_step = false) {
-    const size_t batch_size = logits.get_shape().at(0);
-    OPENVINO_ASSERT(batch_size == 1, "Batch != 1 is not supported");
+    OPENVINO_ASSERT(logits.get_shape().at(0) > batch_idx, "logits batch size doesn't match the batch number");
 
     size_t vocab_size = logits.get_shape().back();
     size_t batch_offset = batch_idx * logits.get_shape()[1] * vocab_size;
@@ -95,7 +94,7 @@ void process_whisper_timestamp_logits(ov::Tensor& logits,
         }
     }
 
-    auto tokens = ov::genai::log_softmax(logits, 0);
+    auto tokens = ov::genai::log_softmax(logits, batch_idx);
     float timestamp_exp_prov_sum = 0;
 
     for (size_t i = timestamp_begin; i < vocab_size; i++) {
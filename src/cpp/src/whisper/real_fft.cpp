@@ -0,0 +1,237 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include "real_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+using Complex = ov::genai::RealFFT::Complex;
+
+// std::complex operator* may call a slow path handling inf/nan, use plain arithmetic in hot loops
+inline Complex mul(const Complex& a, const Complex& b) {
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+
+// multiply by -i
+inline Complex mul_neg_i(const Complex& a) {
+    return {a.imag(), -a.real()};
+}
+
+Complex polar_root(const size_t k, const size_t n) {
+    const double theta = -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n);
+    return {static_cast<float>(std::cos(theta)), static_cast<float>(std::sin(theta))};
+}
+
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> radices;
+    for (size_t radix : {4, 2, 3, 5}) {
+        while (n % radix == 0) {
+            radices.push_back(radix);
+            n /= radix;
+        }
+    }
+    for (size_t radix = 7; n > 1; radix += 2) {
+        while (n % radix == 0) {
+            radices.push_back(radix);
+            n /= radix;
+        }
+    }
+    return radices;
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+RealFFT::RealFFT(size_t n) : m_n{n} {
+    OPENVINO_ASSERT(n > 0, "FFT size must be positive");
+
+    m_packed_real = n % 2 == 0;
+    m_complex_n = m_packed_real ? n / 2 : n;
+
+    size_t length = m_complex_n;
+    size_t stride = 1;
+    for (size_t radix : factorize(m_complex_n)) {
+        const size_t m = length / radix;
+        m_stages.push_back({radix, length, stride, m_twiddles.size()});
+        for (size_t q = 0; q < m; q++) {
+            for (size_t t = 1; t < radix; t++) {
+                m_twiddles.push_back(polar_root(q * t, length));
+            }
+        }
+        length = m;
+        stride *= radix;
+    }
+
+    m_roots.resize(m_complex_n);
+    for (size_t k = 0; k < m_complex_n; k++) {
+        m_roots[k] = polar_root(k, m_complex_n);
+    }
+
+    if (m_packed_real) {
+        m_split_twiddles.resize(m_complex_n + 1);
+        for (size_t k = 0; k <= m_complex_n; k++) {
+            m_split_twiddles[k] = polar_root(k, m_n);
+        }
+    }
+}
+
+RealFFT::Workspace RealFFT::create_workspace() const {
+    Workspace workspace;
+    workspace.buffer_a.resize(m_complex_n);
+    workspace.buffer_b.resize(std::max(m_complex_n, bins()));
+    return workspace;
+}
+
+// Self-sorting (Stockham) decimation-in-frequency stages, result ends up in workspace.buffer_a.
+void RealFFT::complex_transform(Workspace& workspace) const {
+    Complex* x = workspace.buffer_a.data();
+    Complex* y = workspace.buffer_b.data();
+
+    Complex generic_inputs_storage[16];
+    std::vector<Complex> generic_inputs_heap;
+
+    for (const Stage& stage : m_stages) {
+        const size_t p = stage.radix;
+        const size_t s = stage.stride;
+        const size_t m = stage.length / p;
+        const Complex* twiddles = m_twiddles.data() + stage.twiddle_offset;
+
+        Complex* generic_inputs = generic_inputs_storage;
+        if (p > 16) {
+            generic_inputs_heap.resize(p);
+            generic_inputs = generic_inputs_heap.data();
+        }
+
+        for (size_t q = 0; q < m; q++) {
+            const Complex* w = twiddles + q * (p - 1);
+            const Complex* in = x + s * q;
+            Complex* out = y + s * p * q;
+
+            switch (p) {
+            case 2:
+                for (size_t k = 0; k < s; k++) {
+                    const Complex a0 = in[k], a1 = in[k + s * m];
+                    out[k] = a0 + a1;
+                    out[k + s] = mul(a0 - a1, w[0]);
+                }
+                break;
+            case 3: {
+                const float sin_3 = static_cast<float>(std::sqrt(3.0) / 2.0);
+                for (size_t k = 0; k < s; k++) {
+                    const Complex a0 = in[k], a1 = in[k + s * m], a2 = in[k + 2 * s * m];
+                    const Complex t = a1 + a2;
+                    const Complex c = a0 - 0.5f * t;
+                    const Complex d = mul_neg_i(sin_3 * (a1 - a2));
+                    out[k] = a0 + t;
+                    out[k + s] = mul(c + d, w[0]);
+                    out[k + 2 * s] = mul(c - d, w[1]);
+                }
+                break;
+            }
+            case 4:
+                for (size_t k = 0; k < s; k++) {
+                    const Complex a0 = in[k], a1 = in[k + s * m], a2 = in[k + 2 * s * m], a3 = in[k + 3 * s * m];
+                    const Complex t0 = a0 + a2, t1 = a0 - a2;
+                    const Complex t2 = a1 + a3, t3 = mul_neg_i(a1 - a3);
+                    out[k] = t0 + t2;
+                    out[k + s] = mul(t1 + t3, w[0]);
+                    out[k + 2 * s] = mul(t0 - t2, w[1]);
+                    out[k + 3 * s] = mul(t1 - t3, w[2]);
+                }
+                break;
+            case 5: {
+                const float c1 = static_cast<float>(std::cos(2.0 * M_PI / 5.0));
+                const float c2 = static_cast<float>(std::cos(4.0 * M_PI / 5.0));
+                const float s1 = static_cast<float>(std::sin(2.0 * M_PI / 5.0));
+                const float s2 = static_cast<float>(std::sin(4.0 * M_PI / 5.0));
+                for (size_t k = 0; k < s; k++) {
+                    const Complex a0 = in[k], a1 = in[k + s * m], a2 = in[k + 2 * s * m], a3 = in[k + 3 * s * m],
+                                  a4 = in[k + 4 * s * m];
+                    const Complex t1 = a1 + a4, t2 = a2 + a3, d1 = a1 - a4, d2 = a2 - a3;
+                    const Complex e1 = a0 + c1 * t1 + c2 * t2, e2 = a0 + c2 * t1 + c1 * t2;
+                    const Complex o1 = mul_neg_i(s1 * d1 + s2 * d2), o2 = mul_neg_i(s2 * d1 - s1 * d2);
+                    out[k] = a0 + t1 + t2;
+                    out[k + s] = mul(e1 + o1, w[0]);
+                    out[k + 2 * s] = mul(e2 + o2, w[1]);
+                    out[k + 3 * s] = mul(e2 - o2, w[2]);
+                    out[k + 4 * s] = mul(e1 - o1, w[3]);
+                }
+                break;
+            }
+            default: {
+                const size_t root_step = m_complex_n / p;
+                for (size_t k = 0; k < s; k++) {
+                    for (size_t r = 0; r < p; r++) {
+                        generic_inputs[r] = in[k + r * s * m];
+                    }
+                    for (size_t t = 0; t < p; t++) {
+                        Complex sum = generic_inputs[0];
+                        for (size_t r = 1; r < p; r++) {
+                            sum += mul(generic_inputs[r], m_roots[(r * t % p) * root_step]);
+                        }
+                        out[k + t * s] = t == 0 ? sum : mul(sum, w[t - 1]);
+                    }
+                }
+            }
+            }
+        }
+
+        std::swap(x, y);
+    }
+
+    if (x != workspace.buffer_a.data()) {
+        std::copy_n(x, m_complex_n, workspace.buffer_a.data());
+    }
+}
+
+void RealFFT::transform(const float* in, Complex* out, Workspace& workspace) const {
+    Complex* z = workspace.buffer_a.data();
+
+    if (!m_packed_real) {
+        for (size_t i = 0; i < m_n; i++) {
+            z[i] = {in[i], 0.0f};
+        }
+        complex_transform(workspace);
+        std::copy_n(z, bins(), out);
+        return;
+    }
+
+    // pack even samples into real part and odd samples into imaginary part
+    for (size_t i = 0; i < m_complex_n; i++) {
+        z[i] = {in[2 * i], in[2 * i + 1]};
+    }
+    complex_transform(workspace);
+
+    // split the half size spectrum into the spectrum of the real input:
+    // X[k] = (Z[k] + conj(Z[M - k])) / 2 - i * W^k * (Z[k] - conj(Z[M - k])) / 2
+    const size_t half = m_complex_n;
+    for (size_t k = 0; k <= half; k++) {
+        const Complex zk = z[k % half];
+        const Complex zc = std::conj(z[(half - k) % half]);
+        const Complex even = 0.5f * (zk + zc);
+        const Complex odd = mul_neg_i(0.5f * (zk - zc));
+        out[k] = even + mul(m_split_twiddles[k], odd);
+    }
+}
+
+void RealFFT::power_spectrum(const float* in, float* power, Workspace& workspace) const {
+    Complex* spectrum = workspace.buffer_b.data();
+    transform(in, spectrum, workspace);
+    for (size_t k = 0; k < bins(); k++) {
+        power[k] = spectrum[k].real() * spectrum[k].real() + spectrum[k].imag() * spectrum[k].imag();
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
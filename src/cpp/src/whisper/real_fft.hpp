@@ -0,0 +1,85 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Iterative mixed-radix FFT for real-valued input.
+ *
+ * Twiddle factors and the stage plan are computed once in the constructor, so the plan can be shared between threads.
+ * Every thread owns a Workspace which holds all scratch memory, so transform() does not allocate.
+ *
+ * Even sizes are computed as a complex FFT of half size over the even/odd packed input followed by a split step.
+ * Radix 4, 2, 3 and 5 butterflies are specialized, other prime factors fall back to a generic butterfly,
+ * e.g. Whisper n_fft=400 runs as a 200-point complex FFT with radices 4, 2, 5, 5.
+ */
+class RealFFT {
+public:
+    using Complex = std::complex<float>;
+
+    struct Workspace {
+        std::vector<Complex> buffer_a;
+        std::vector<Complex> buffer_b;
+    };
+
+    explicit RealFFT(size_t n);
+
+    size_t size() const {
+        return m_n;
+    }
+
+    // number of non-redundant output bins: n / 2 + 1
+    size_t bins() const {
+        return m_n / 2 + 1;
+    }
+
+    Workspace create_workspace() const;
+
+    /**
+     * @brief Computes the first bins() complex coefficients of the DFT of `in`.
+     * @param in real input of size() elements
+     * @param out output of bins() elements
+     */
+    void transform(const float* in, Complex* out, Workspace& workspace) const;
+
+    /**
+     * @brief Computes squared magnitudes of the first bins() DFT coefficients of `in`.
+     * @param in real input of size() elements
+     * @param power output of bins() elements
+     */
+    void power_spectrum(const float* in, float* power, Workspace& workspace) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // length of the sub-transform processed by this stage
+        size_t length;
+        // input stride of this stage (product of previous radices)
+        size_t stride;
+        // offset of (radix - 1) * (length / radix) twiddles in m_twiddles
+        size_t twiddle_offset;
+    };
+
+    void complex_transform(Workspace& workspace) const;
+
+    size_t m_n;
+    // size of the underlying complex transform: n / 2 for even n, n otherwise
+    size_t m_complex_n;
+    bool m_packed_real;
+    std::vector<Stage> m_stages;
+    std::vector<Complex> m_twiddles;
+    // exp(-2 * pi * i * k / m_complex_n), used by generic butterflies
+    std::vector<Complex> m_roots;
+    // exp(-2 * pi * i * k / m_n), used by the real split step
+    std::vector<Complex> m_split_twiddles;
+};
+
+}  // namespace genai
+}  // namespace ov
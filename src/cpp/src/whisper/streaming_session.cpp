@@ -0,0 +1,263 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "streaming_session.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "timestamps.hpp"
+
+namespace ov {
+namespace genai {
+
+WhisperStreamingSession::WhisperStreamingSession(const WhisperGenerationConfig& config,
+                                                 const WhisperConfig& model_config,
+                                                 const WhisperContextTokens& context_tokens,
+                                                 WhisperInitializedModels& models,
+                                                 WhisperFeatureExtractor& feature_extractor,
+                                                 const std::shared_ptr<ChunkStreamerBase> streamer)
+    : m_config{config},
+      m_model_config{model_config},
+      m_context_tokens{context_tokens},
+      m_models{models},
+      m_feature_extractor{feature_extractor},
+      m_streamer{streamer},
+      m_timestamp_begin{config.no_timestamps_token_id + 1} {
+    m_time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
+    m_frame_duration = static_cast<float>(feature_extractor.chunk_length) / feature_extractor.nb_max_frames;
+
+    m_result.perf_metrics.num_input_tokens = 0;
+    m_result.perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+}
+
+void WhisperStreamingSession::push_audio(const RawSpeechInput& audio_chunk) {
+    if (m_cancelled) {
+        return;
+    }
+
+    const auto extract_start = std::chrono::steady_clock::now();
+    m_feature_extractor.extract_incremental(m_features, audio_chunk);
+    const auto extract_ms = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - extract_start);
+    m_result.perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(extract_ms);
+
+    const size_t end_frame = m_features.end_frame(m_feature_extractor.feature_size);
+    if (end_frame < m_last_decoded_frame + decode_interval_frames) {
+        return;
+    }
+
+    // the window can't grow anymore, everything decoded in it has to be committed
+    const bool flush = end_frame - m_window_start >= m_feature_extractor.nb_max_frames;
+    decode_window(flush);
+}
+
+WhisperGenerateResult WhisperStreamingSession::finish() {
+    const auto extract_start = std::chrono::steady_clock::now();
+    m_feature_extractor.extract_incremental(m_features, {}, true);
+    const auto extract_ms = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - extract_start);
+    m_result.perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(extract_ms);
+
+    const size_t end_frame = m_features.end_frame(m_feature_extractor.feature_size);
+    while (!m_cancelled && m_window_start < end_frame) {
+        const size_t window_start = m_window_start;
+        decode_window(true);
+        if (m_window_start == window_start) {
+            break;
+        }
+    }
+
+    if (m_streamer) {
+        m_streamer->end();
+    }
+
+    if (m_config.return_timestamps) {
+        m_result.segments = m_segments;
+    }
+
+    return std::move(m_result);
+}
+
+void WhisperStreamingSession::decode_window(const bool flush) {
+    const size_t end_frame = m_features.end_frame(m_feature_extractor.feature_size);
+    m_last_decoded_frame = end_frame;
+
+    const size_t max_new_tokens = m_config.get_max_new_tokens();
+    if (m_result.output_tokens.size() >= max_new_tokens) {
+        return;
+    }
+
+    RawPerfMetrics& raw_metrics = m_result.perf_metrics.raw_metrics;
+
+    auto input_features = m_feature_extractor.get_streaming_window(m_features, m_window_start);
+    ov::Tensor hidden_state_tensor = whisper_encode(m_models.encoder,
+                                                    input_features,
+                                                    m_feature_extractor.feature_size,
+                                                    m_feature_extractor.nb_max_frames,
+                                                    raw_metrics);
+
+    // language is detected on the first window only, timestamps are required to find finished segments
+    if (m_init_tokens.empty()) {
+        m_init_tokens = whisper_init_tokens(hidden_state_tensor, m_models, m_config, true, raw_metrics);
+    }
+
+    std::vector<int64_t> init_ids = get_window_prompt();
+    init_ids.insert(init_ids.end(), m_init_tokens.begin(), m_init_tokens.end());
+
+    const size_t used_positions = init_ids.size() + m_window_tokens.size();
+    const size_t window_max_new_tokens =
+        std::min(m_model_config.max_target_positions - std::min(used_positions, m_model_config.max_target_positions),
+                 max_new_tokens - m_result.output_tokens.size());
+
+    std::vector<int64_t> hypothesis;
+    if (window_max_new_tokens > 0) {
+        auto output_tokens = whisper_decode_with_prefix(hidden_state_tensor,
+                                                        m_config,
+                                                        m_models,
+                                                        init_ids,
+                                                        m_window_tokens,
+                                                        window_max_new_tokens,
+                                                        true,
+                                                        raw_metrics);
+        hypothesis.assign(output_tokens.begin() + m_window_tokens.size(), output_tokens.end());
+    }
+
+    // drop eos and everything predicted for the silence after received audio
+    const int64_t last_timestamp =
+        m_timestamp_begin + static_cast<int64_t>(std::min(end_frame - m_window_start, m_feature_extractor.nb_max_frames) / 2);
+    auto hypothesis_end = std::find_if(hypothesis.begin(), hypothesis.end(), [&](int64_t token) {
+        return token == m_config.eos_token_id || token > last_timestamp;
+    });
+    hypothesis.erase(hypothesis_end, hypothesis.end());
+
+    if (flush) {
+        commit(hypothesis);
+        m_pending_tokens.clear();
+    } else {
+        // local agreement: commit the prefix confirmed by two consecutive hypotheses
+        size_t agreed_size = 0;
+        while (agreed_size < hypothesis.size() && agreed_size < m_pending_tokens.size() &&
+               hypothesis[agreed_size] == m_pending_tokens[agreed_size]) {
+            agreed_size++;
+        }
+
+        commit({hypothesis.begin(), hypothesis.begin() + agreed_size});
+        m_pending_tokens.assign(hypothesis.begin() + agreed_size, hypothesis.end());
+    }
+
+    advance_window(flush);
+}
+
+void WhisperStreamingSession::commit(const std::vector<int64_t>& tokens) {
+    if (tokens.empty()) {
+        return;
+    }
+
+    m_window_tokens.insert(m_window_tokens.end(), tokens.begin(), tokens.end());
+
+    std::vector<int64_t> text_tokens;
+    std::copy_if(tokens.begin(), tokens.end(), std::back_inserter(text_tokens), [&](int64_t token) {
+        return !is_timestamp(token);
+    });
+
+    if (text_tokens.empty()) {
+        return;
+    }
+
+    m_result.output_tokens.insert(m_result.output_tokens.end(), text_tokens.begin(), text_tokens.end());
+
+    if (m_streamer && m_streamer->put_chunk(text_tokens)) {
+        m_cancelled = true;
+    }
+}
+
+void WhisperStreamingSession::advance_window(const bool flush) {
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+    const size_t end_frame = m_features.end_frame(m_feature_extractor.feature_size);
+    const size_t window_size = std::min(end_frame - std::min(m_window_start, end_frame), nb_max_frames);
+    const float window_offset = m_window_start * m_frame_duration;
+
+    auto extracted_segments = extract_segments(m_window_tokens, m_config, nb_max_frames, m_time_precision);
+
+    // index after the closing timestamp of the last finished segment
+    size_t cut_index = 0;
+    for (size_t i = 0; i < extracted_segments.segments.size(); i++) {
+        auto& segment = extracted_segments.segments[i];
+        if (segment.m_end < 0.0f) {
+            break;
+        }
+
+        segment.m_start += window_offset;
+        segment.m_end += window_offset;
+        m_segments.push_back(segment);
+        cut_index = extracted_segments.segment_ranges[i].second + 1;
+    }
+
+    size_t shift = cut_index > 0 ? (m_window_tokens[cut_index - 1] - m_timestamp_begin) * 2 : 0;
+
+    if (flush) {
+        // close the unfinished segment at the end of the window
+        auto first_text = std::find_if(m_window_tokens.begin() + cut_index, m_window_tokens.end(), [&](int64_t token) {
+            return !is_timestamp(token);
+        });
+        if (first_text != m_window_tokens.end()) {
+            Segment segment;
+            const bool has_start = is_timestamp(m_window_tokens[cut_index]);
+            segment.m_start = window_offset + (has_start ? (m_window_tokens[cut_index] - m_timestamp_begin) * m_time_precision
+                                                         : shift * m_frame_duration);
+            segment.m_end = window_offset + window_size * m_frame_duration;
+            std::copy_if(first_text, m_window_tokens.end(), std::back_inserter(segment.m_tokens), [&](int64_t token) {
+                return !is_timestamp(token);
+            });
+            m_segments.push_back(segment);
+        }
+
+        shift = window_size;
+        cut_index = m_window_tokens.size();
+    }
+
+    if (shift == 0) {
+        return;
+    }
+
+    // timestamps of the rest are relative to the new window start
+    const int64_t timestamps_shift = shift / 2;
+    auto rebase = [&](int64_t token) {
+        return is_timestamp(token) ? std::max(token - timestamps_shift, m_timestamp_begin) : token;
+    };
+    std::vector<int64_t> window_tokens;
+    std::transform(m_window_tokens.begin() + cut_index, m_window_tokens.end(), std::back_inserter(window_tokens), rebase);
+    m_window_tokens = std::move(window_tokens);
+    std::transform(m_pending_tokens.begin(), m_pending_tokens.end(), m_pending_tokens.begin(), rebase);
+
+    m_window_start = std::min(m_window_start + shift, end_frame);
+    m_feature_extractor.discard_streaming_frames(m_features, m_window_start);
+}
+
+std::vector<int64_t> WhisperStreamingSession::get_window_prompt() const {
+    std::vector<int64_t> prompt_tokens = get_prompt_tokens(m_context_tokens, m_config, m_window_start);
+
+    // text committed before the current window conditions decoding like previous chunks in HF long-form generation
+    const size_t window_text_size = std::count_if(m_window_tokens.begin(), m_window_tokens.end(), [&](int64_t token) {
+        return !is_timestamp(token);
+    });
+    const size_t history_end = m_result.output_tokens.size() - window_text_size;
+    const size_t history_begin = history_end - std::min(history_end, max_history_prompt_tokens);
+    if (history_begin == history_end) {
+        return prompt_tokens;
+    }
+
+    if (prompt_tokens.empty()) {
+        prompt_tokens.push_back(m_config.prev_sot_token_id);
+    }
+    prompt_tokens.insert(prompt_tokens.end(),
+                         m_result.output_tokens.begin() + history_begin,
+                         m_result.output_tokens.begin() + history_end);
+    return prompt_tokens;
+}
+
+bool WhisperStreamingSession::is_timestamp(const int64_t token) const {
+    return token >= m_timestamp_begin;
+}
+
+}  // namespace genai
+}  // namespace ov
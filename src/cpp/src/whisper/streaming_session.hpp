@@ -0,0 +1,77 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "context_tokens.hpp"
+#include "whisper.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Transcribes audio which arrives in pieces.
+ *
+ * Mel frames are computed incrementally and the encoder re-runs on a sliding window which starts at the end of the
+ * last finished segment. Every decoding continues the tokens already committed in the window. Tokens are committed
+ * with the local agreement policy: the common prefix of two consecutive hypotheses is considered stable and is sent
+ * to the streamer, the rest of the hypothesis may change when more audio arrives.
+ */
+class WhisperStreamingSession {
+public:
+    WhisperStreamingSession(const WhisperGenerationConfig& config,
+                            const WhisperConfig& model_config,
+                            const WhisperContextTokens& context_tokens,
+                            WhisperInitializedModels& models,
+                            WhisperFeatureExtractor& feature_extractor,
+                            const std::shared_ptr<ChunkStreamerBase> streamer);
+
+    void push_audio(const RawSpeechInput& audio_chunk);
+
+    /**
+     * @brief Commits everything left in the window and returns the whole transcription.
+     * Segments are returned only if return_timestamps is enabled in config.
+     */
+    WhisperGenerateResult finish();
+
+private:
+    // decode as soon as 0.5s of new audio is received
+    static constexpr size_t decode_interval_frames = 50;
+    // number of previously committed tokens passed as prompt to the next window
+    static constexpr size_t max_history_prompt_tokens = 64;
+
+    void decode_window(const bool flush);
+    void commit(const std::vector<int64_t>& tokens);
+    void advance_window(const bool flush);
+    std::vector<int64_t> get_window_prompt() const;
+    bool is_timestamp(const int64_t token) const;
+
+    WhisperGenerationConfig m_config;
+    const WhisperConfig& m_model_config;
+    WhisperContextTokens m_context_tokens;
+    WhisperInitializedModels& m_models;
+    WhisperFeatureExtractor& m_feature_extractor;
+    std::shared_ptr<ChunkStreamerBase> m_streamer;
+
+    WhisperStreamingFeatures m_features;
+    WhisperGenerateResult m_result;
+    std::vector<Segment> m_segments;
+    std::vector<int64_t> m_init_tokens;
+
+    size_t m_window_start = 0;
+    size_t m_last_decoded_frame = 0;
+    // committed tokens of the current window including timestamps relative to the window start
+    std::vector<int64_t> m_window_tokens;
+    // not committed tail of the last hypothesis
+    std::vector<int64_t> m_pending_tokens;
+    bool m_cancelled = false;
+
+    int64_t m_timestamp_begin;
+    // 0.02 by default
+    float m_time_precision;
+    // 0.01 by default
+    float m_frame_duration;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -3,13 +3,19 @@
 
 #include "whisper.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
 #include <openvino/openvino.hpp>
-#include <regex>
 #include <thread>
+#include <tuple>
 
 #include "context_tokens.hpp"
 #include "logit_processor.hpp"
+#include "sampler.hpp"
 #include "openvino/genai/perf_metrics.hpp"
 #include "openvino/genai/whisper_generation_config.hpp"
 #include "openvino/genai/whisper_pipeline.hpp"
@@ -24,21 +30,24 @@ using ov::genai::MicroSeconds;
 
 namespace {
 
+// mel_data holds one or more stacked chunks of [feature_size, nb_max_frames] features
 ov::Tensor encode(ov::InferRequest& request,
                   std::vector<float>& mel_data,
                   const size_t feature_size,
                   const size_t nb_max_frames,
                   ov::genai::RawPerfMetrics& raw_metrics) {
-    OPENVINO_ASSERT(mel_data.size() == feature_size * nb_max_frames,
+    const size_t chunk_size = feature_size * nb_max_frames;
+    OPENVINO_ASSERT(!mel_data.empty() && mel_data.size() % chunk_size == 0,
                     "Mel spectrogram required size: ",
                     feature_size,
                     " * ",
                     nb_max_frames,
-                    ". Actual size: ",
+                    " per chunk. Actual size: ",
                     mel_data.size(),
                     ".");
 
-    ov::Tensor input_tensor(ov::element::f32, {1, feature_size, nb_max_frames}, mel_data.data());
+    const size_t batch_size = mel_data.size() / chunk_size;
+    ov::Tensor input_tensor(ov::element::f32, {batch_size, feature_size, nb_max_frames}, mel_data.data());
 
     request.set_tensor("input_features", input_tensor);
 
@@ -53,48 +62,155 @@ ov::Tensor encode(ov::InferRequest& request,
     return request.get_tensor("last_hidden_state");
 }
 
-void set_past_key_value(ov::InferRequest& source, ov::InferRequest& dest) {
-    // source outputs:
-    // present.0.decoder.key
-    // present.0.decoder.value
-    // present.0.encoder.key
-    // present.0.encoder.value
+// copies selected rows of the outermost (batch) dimension into a new tensor
+ov::Tensor gather_rows(const ov::Tensor& tensor, const std::vector<size_t>& rows) {
+    ov::Shape shape = tensor.get_shape();
+    const size_t row_byte_size = tensor.get_byte_size() / shape.at(0);
+    shape[0] = rows.size();
+
+    ov::Tensor result(tensor.get_element_type(), shape);
+    const auto* src = static_cast<const uint8_t*>(tensor.data());
+    auto* dst = static_cast<uint8_t*>(result.data());
+    for (size_t i = 0; i < rows.size(); i++) {
+        std::copy_n(src + rows[i] * row_byte_size, row_byte_size, dst + i * row_byte_size);
+    }
+    return result;
+}
+
+bool has_input(ov::InferRequest& request, const std::string& name) {
+    const auto inputs = request.get_compiled_model().inputs();
+    return std::any_of(inputs.begin(), inputs.end(), [&name](const ov::Output<const ov::Node>& input) {
+        return input.get_names().count(name);
+    });
+}
 
-    // dest inputs:
-    // past_key_values.0.decoder.key
-    // past_key_values.0.decoder.value
-    // past_key_values.0.encoder.key
-    // past_key_values.0.encoder.value
+void set_cache_position(ov::InferRequest& request, const size_t start, const size_t length) {
+    ov::Tensor cache_position_tensor = request.get_tensor("cache_position");
+    cache_position_tensor.set_shape({length});
+    std::iota(cache_position_tensor.data<int64_t>(), cache_position_tensor.data<int64_t>() + length, start);
+}
 
-    for (auto& source_output : source.get_compiled_model().outputs()) {
-        std::string source_output_name = source_output.get_any_name();
-        if (source_output_name.find("logits") != std::string::npos) {
-            continue;
+// beam_idx of a stateful decoder selects rows of kv cache states for the next inference
+void set_beam_idx(ov::InferRequest& decoder, const std::vector<size_t>& rows) {
+    ov::Tensor beam_idx_tensor = decoder.get_tensor("beam_idx");
+    beam_idx_tensor.set_shape({rows.size()});
+    std::copy(rows.begin(), rows.end(), beam_idx_tensor.data<int32_t>());
+}
+
+std::vector<size_t> all_rows(const size_t batch_size) {
+    std::vector<size_t> rows(batch_size);
+    std::iota(rows.begin(), rows.end(), 0);
+    return rows;
+}
+
+ov::InferRequest& get_step_decoder(ov::genai::WhisperInitializedModels& models) {
+    return models.is_stateful_decoder ? models.decoder : models.decoder_with_past;
+}
+
+void reset_decoder_state(ov::genai::WhisperInitializedModels& models) {
+    get_step_decoder(models).reset_state();
+}
+
+// Runs the first decoding step over the whole input_ids. Cross attention kv cache is computed here once per chunk.
+void infer_prefill(ov::genai::WhisperInitializedModels& models,
+                   const ov::Tensor& encoder_hidden_states,
+                   const ov::Tensor& input_ids,
+                   const std::vector<ov::genai::RawPerfMetrics*>& rows_raw_metrics) {
+    const size_t batch_size = rows_raw_metrics.size();
+    models.decoder.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_states});
+    models.decoder.set_tensor("input_ids", input_ids);
+
+    if (models.is_stateful_decoder) {
+        models.decoder.reset_state();
+        set_cache_position(models.decoder, 0, input_ids.get_shape().at(1));
+        set_beam_idx(models.decoder, all_rows(batch_size));
+    }
+
+    ov::genai::utils::infer_with_perf_metrics(models.decoder, rows_raw_metrics);
+}
+
+// Shares decoder kv cache outputs with decoder_with_past inputs without copies.
+// Cross attention kv cache stays bound for all decoder_with_past steps of the chunk.
+void bind_decoder_kv_cache(ov::genai::WhisperInitializedModels& models) {
+    const auto& names = models.kv_cache_names;
+    for (const auto* pairs : {&names.self_attention, &names.cross_attention}) {
+        for (const auto& [present_name, past_name] : *pairs) {
+            models.decoder_with_past.set_tensor(past_name, ov::Tensor{models.decoder.get_tensor(present_name)});
         }
+    }
+}
+
+// Prepares the step decoder after the first decoding step of a chunk. Stateful decoder already holds everything.
+void prepare_step_decoder(ov::genai::WhisperInitializedModels& models, const ov::Tensor& encoder_hidden_states) {
+    if (models.is_stateful_decoder) {
+        return;
+    }
 
-        std::string with_past_input_name =
-            std::regex_replace(source_output_name, std::regex("present"), "past_key_values");
+    bind_decoder_kv_cache(models);
 
-        auto kv_tensor = source.get_tensor(source_output_name);
-        dest.set_tensor(with_past_input_name, ov::Tensor{kv_tensor});
+    // cross attention kv cache replaces encoder hidden states, the input is set once only if the model has it
+    if (has_input(models.decoder_with_past, "encoder_hidden_states")) {
+        models.decoder_with_past.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_states});
+    }
+}
+
+// Binds self attention present outputs of decoder_with_past to its own past inputs,
+// so every next step reads kv cache written by the previous one.
+void bind_self_attention_kv_cache(ov::genai::WhisperInitializedModels& models) {
+    for (const auto& [present_name, past_name] : models.kv_cache_names.self_attention) {
+        models.decoder_with_past.set_tensor(past_name, ov::Tensor{models.decoder_with_past.get_tensor(present_name)});
+    }
+}
+
+// Keeps only `rows` of kv cache and encoder hidden states for the next step.
+// If `from_present` is set, self attention kv cache is taken from the present outputs of the last inference.
+// If all rows decode the same chunk, encoder side tensors are identical for every row and are gathered only
+// when the number of rows changes.
+void compact_step_decoder(ov::genai::WhisperInitializedModels& models,
+                          const std::vector<size_t>& rows,
+                          const bool from_present,
+                          const bool same_chunk = false) {
+    ov::InferRequest& decoder_with_past = get_step_decoder(models);
+
+    auto needs_gather = [&](const ov::Tensor& tensor) {
+        return !same_chunk || tensor.get_shape().at(0) != rows.size();
+    };
+
+    if (has_input(decoder_with_past, "encoder_hidden_states")) {
+        ov::Tensor encoder_hidden_states = decoder_with_past.get_tensor("encoder_hidden_states");
+        if (needs_gather(encoder_hidden_states)) {
+            decoder_with_past.set_tensor("encoder_hidden_states", gather_rows(encoder_hidden_states, rows));
+        }
+    }
+
+    if (models.is_stateful_decoder) {
+        set_beam_idx(decoder_with_past, rows);
+        return;
+    }
+
+    for (const auto& [present_name, past_name] : models.kv_cache_names.self_attention) {
+        ov::Tensor source = decoder_with_past.get_tensor(from_present ? present_name : past_name);
+        decoder_with_past.set_tensor(past_name, gather_rows(source, rows));
+    }
+    for (const auto& [present_name, past_name] : models.kv_cache_names.cross_attention) {
+        ov::Tensor source = decoder_with_past.get_tensor(past_name);
+        if (needs_gather(source)) {
+            decoder_with_past.set_tensor(past_name, gather_rows(source, rows));
+        }
     }
 }
 
 int64_t decode(ov::Tensor& encoder_hidden_state,
-               ov::InferRequest& decoder,
+               ov::genai::WhisperInitializedModels& models,
                std::vector<int64_t>& input_ids,
                const ov::genai::WhisperGenerationConfig& config,
                ov::genai::RawPerfMetrics& raw_metrics,
                const bool apply_logit_processors = true,
                const bool return_timestamps = false) {
-    decoder.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_state});
-
     ov::Tensor input_ids_tensor(ov::element::i64, {1, input_ids.size()}, input_ids.data());
-    decoder.set_tensor("input_ids", input_ids_tensor);
+    infer_prefill(models, encoder_hidden_state, input_ids_tensor, {&raw_metrics});
 
-    ov::genai::utils::infer_with_perf_metrics(decoder, raw_metrics);
-
-    auto output_tensor = decoder.get_tensor("logits");
+    auto output_tensor = models.decoder.get_tensor("logits");
 
     if (apply_logit_processors) {
         ov::genai::do_suppress_tokens(output_tensor, 0, config.begin_suppress_tokens);
@@ -110,23 +226,21 @@ int64_t decode(ov::Tensor& encoder_hidden_state,
     return output_token;
 }
 
-int64_t decode_with_past(ov::Tensor& encoder_hidden_state,
-                         ov::InferRequest& decoder_with_past,
+// encoder_hidden_states input of the step decoder is set once per chunk, cross attention kv cache is already known
+int64_t decode_with_past(ov::genai::WhisperInitializedModels& models,
                          int64_t input_id,
                          const size_t cache_position,
                          const ov::genai::WhisperGenerationConfig& config,
                          ov::genai::RawPerfMetrics& raw_metrics,
                          const bool return_timestamps,
                          const std::vector<int64_t>& generated_tokens) {
-    decoder_with_past.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_state});
+    ov::InferRequest& decoder_with_past = get_step_decoder(models);
 
     std::vector<int64_t> input_ids = {input_id};
     ov::Tensor input_ids_tensor(ov::element::i64, {1, 1}, input_ids.data());
     decoder_with_past.set_tensor("input_ids", input_ids_tensor);
 
-    ov::Tensor cache_position_tensor = decoder_with_past.get_tensor("cache_position");
-    cache_position_tensor.set_shape({1});
-    cache_position_tensor.data<int64_t>()[0] = cache_position;
+    set_cache_position(decoder_with_past, cache_position, 1);
 
     ov::genai::utils::infer_with_perf_metrics(decoder_with_past, raw_metrics);
 
@@ -143,17 +257,26 @@ int64_t decode_with_past(ov::Tensor& encoder_hidden_state,
     return output_token;
 }
 
-int64_t detect_language(ov::Tensor& encoder_hidden_state,
-                        ov::InferRequest& decoder,
-                        const ov::genai::WhisperGenerationConfig& config,
-                        ov::genai::RawPerfMetrics& raw_metrics) {
-    std::vector<int64_t> input_ids{config.decoder_start_token_id};
+// detects language for every batch row of encoder_hidden_state
+std::vector<int64_t> detect_language(ov::Tensor& encoder_hidden_state,
+                                     ov::genai::WhisperInitializedModels& models,
+                                     const ov::genai::WhisperGenerationConfig& config,
+                                     ov::genai::RawPerfMetrics& raw_metrics) {
+    const size_t batch_size = encoder_hidden_state.get_shape().at(0);
+    std::vector<int64_t> input_ids(batch_size, config.decoder_start_token_id);
 
+    ov::InferRequest& decoder = models.decoder;
     decoder.set_tensor("encoder_hidden_states", ov::Tensor{encoder_hidden_state});
 
-    ov::Tensor input_ids_tensor(ov::element::i64, {1, input_ids.size()}, input_ids.data());
+    ov::Tensor input_ids_tensor(ov::element::i64, {batch_size, 1}, input_ids.data());
     decoder.set_tensor("input_ids", input_ids_tensor);
 
+    if (models.is_stateful_decoder) {
+        decoder.reset_state();
+        set_cache_position(decoder, 0, 1);
+        set_beam_idx(decoder, all_rows(batch_size));
+    }
+
     const auto infer_start = std::chrono::steady_clock::now();
     decoder.infer();
     const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
@@ -161,22 +284,47 @@ int64_t detect_language(ov::Tensor& encoder_hidden_state,
 
     auto output_tensor = decoder.get_tensor("logits");
 
-    int64_t output_token = ov::genai::utils::argmax(output_tensor, 0);
+    std::vector<int64_t> language_token_ids(batch_size);
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        language_token_ids[batch] = ov::genai::utils::argmax(output_tensor, batch);
+    }
 
-    return output_token;
+    return language_token_ids;
+}
+
+std::vector<int64_t> build_init_tokens(const ov::genai::WhisperGenerationConfig& config,
+                                       const int64_t language_token_id,
+                                       const bool return_timestamps) {
+    int64_t task_token_id = config.transcribe_token_id;
+    if (config.task.has_value() && *config.task == "translate") {
+        task_token_id = config.translate_token_id;
+    }
+
+    if (return_timestamps) {
+        return std::vector<int64_t>{config.decoder_start_token_id, language_token_id, task_token_id};
+    }
+
+    return std::vector<int64_t>{config.decoder_start_token_id,
+                                language_token_id,
+                                task_token_id,
+                                config.no_timestamps_token_id};
+}
+
+std::vector<int64_t> build_non_multilingual_init_tokens(const ov::genai::WhisperGenerationConfig& config,
+                                                        const bool return_timestamps) {
+    if (return_timestamps) {
+        return std::vector<int64_t>{config.decoder_start_token_id};
+    }
+    return std::vector<int64_t>{config.decoder_start_token_id, config.no_timestamps_token_id};
 }
 
 std::vector<int64_t> prepare_init_tokens(ov::Tensor& encoder_hidden_state,
-                                         ov::InferRequest decoder,
+                                         ov::genai::WhisperInitializedModels& models,
                                          const ov::genai::WhisperGenerationConfig& config,
                                          const bool return_timestamps,
                                          ov::genai::RawPerfMetrics& raw_metrics) {
     if (!config.is_multilingual) {
-        if (return_timestamps) {
-            return std::vector<int64_t>{config.decoder_start_token_id};
-        } else {
-            return std::vector<int64_t>{config.decoder_start_token_id, config.no_timestamps_token_id};
-        }
+        return build_non_multilingual_init_tokens(config, return_timestamps);
     }
 
     int64_t language_token_id;
@@ -186,22 +334,10 @@ std::vector<int64_t> prepare_init_tokens(ov::Tensor& encoder_hidden_state,
             language_token_id = config.lang_to_id.at(language);
         }
     } else {
-        language_token_id = detect_language(encoder_hidden_state, decoder, config, raw_metrics);
-    }
-
-    int64_t task_token_id = config.transcribe_token_id;
-    if (config.task.has_value() && *config.task == "translate") {
-        task_token_id = config.translate_token_id;
-    }
-
-    if (return_timestamps) {
-        return std::vector<int64_t>{config.decoder_start_token_id, language_token_id, task_token_id};
+        language_token_id = detect_language(encoder_hidden_state, models, config, raw_metrics)[0];
     }
 
-    return std::vector<int64_t>{config.decoder_start_token_id,
-                                language_token_id,
-                                task_token_id,
-                                config.no_timestamps_token_id};
+    return build_init_tokens(config, language_token_id, return_timestamps);
 }
 
 std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_state,
@@ -212,8 +348,7 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
                                                   const bool return_timestamps,
                                                   ov::genai::RawPerfMetrics& raw_metrics,
                                                   const std::shared_ptr<ov::genai::StreamerBase> streamer) {
-    int64_t output_token =
-        decode(encoder_hidden_state, models.decoder, init_ids, config, raw_metrics, true, return_timestamps);
+    int64_t output_token = decode(encoder_hidden_state, models, init_ids, config, raw_metrics, true, return_timestamps);
 
     std::vector<int64_t> output_tokens{output_token};
 
@@ -225,11 +360,10 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
         return {false, output_tokens};
     }
 
-    set_past_key_value(models.decoder, models.decoder_with_past);
+    prepare_step_decoder(models, encoder_hidden_state);
 
     for (size_t i = 0; i < max_new_tokens - 1; i++) {
-        auto output_token = decode_with_past(encoder_hidden_state,
-                                             models.decoder_with_past,
+        auto output_token = decode_with_past(models,
                                              output_tokens.back(),
                                              init_ids.size() + i,
                                              config,
@@ -237,8 +371,8 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
                                              return_timestamps,
                                              output_tokens);
 
-        if (i == 0) {
-            set_past_key_value(models.decoder_with_past, models.decoder_with_past);
+        if (i == 0 && !models.is_stateful_decoder) {
+            bind_self_attention_kv_cache(models);
         }
 
         if (output_token == config.eos_token_id) {
@@ -255,6 +389,457 @@ std::pair<bool, std::vector<int64_t>> full_decode(ov::Tensor& encoder_hidden_sta
     return {false, output_tokens};
 }
 
+/**
+ * Greedy decoding of a batch of chunks which share the same length of init_ids + forced_tokens.
+ * forced_tokens are an already known beginning of the output: they are processed together with init_ids
+ * and returned as a prefix of the output tokens.
+ * Each row stops on eos or its own max_new_tokens. Finished rows are dropped from the batch:
+ * past key values and encoder hidden states are compacted only on steps where some rows finish.
+ * raw_metrics of every row get inferences the row took part in.
+ */
+std::vector<std::vector<int64_t>> full_decode_batch(const ov::Tensor& encoder_hidden_states,
+                                                    const ov::genai::WhisperGenerationConfig& config,
+                                                    ov::genai::WhisperInitializedModels& models,
+                                                    const std::vector<std::vector<int64_t>>& init_ids,
+                                                    const std::vector<size_t>& max_new_tokens,
+                                                    const std::vector<bool>& return_timestamps,
+                                                    const std::vector<ov::genai::RawPerfMetrics*>& raw_metrics,
+                                                    const std::vector<std::vector<int64_t>>& forced_tokens = {}) {
+    const size_t batch_size = init_ids.size();
+    const bool has_forced_tokens = !forced_tokens.empty();
+    const auto get_forced_tokens_size = [&](size_t batch) {
+        return has_forced_tokens ? forced_tokens[batch].size() : 0;
+    };
+    const size_t init_ids_size = init_ids.at(0).size() + get_forced_tokens_size(0);
+
+    std::vector<int64_t> input_ids;
+    input_ids.reserve(batch_size * init_ids_size);
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        OPENVINO_ASSERT(init_ids[batch].size() + get_forced_tokens_size(batch) == init_ids_size,
+                        "Batched init ids are required to have the same length");
+        input_ids.insert(input_ids.end(), init_ids[batch].begin(), init_ids[batch].end());
+        if (has_forced_tokens) {
+            input_ids.insert(input_ids.end(), forced_tokens[batch].begin(), forced_tokens[batch].end());
+        }
+    }
+
+    infer_prefill(models,
+                  encoder_hidden_states,
+                  ov::Tensor(ov::element::i64, {batch_size, init_ids_size}, input_ids.data()),
+                  raw_metrics);
+
+    auto logits = models.decoder.get_tensor("logits");
+
+    std::vector<std::vector<int64_t>> output_tokens(batch_size);
+    // indices of rows which continue decoding, in the order of the current decoder_with_past batch
+    std::vector<size_t> active_rows;
+
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        const bool initial_step = get_forced_tokens_size(batch) == 0;
+        if (!initial_step) {
+            output_tokens[batch] = forced_tokens[batch];
+        }
+
+        if (initial_step) {
+            ov::genai::do_suppress_tokens(logits, batch, config.begin_suppress_tokens);
+        }
+        ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
+        if (return_timestamps[batch]) {
+            ov::genai::process_whisper_timestamp_logits(logits, batch, config, output_tokens[batch], initial_step);
+        }
+
+        const int64_t output_token = ov::genai::utils::argmax(logits, batch);
+        if (!initial_step && output_token == config.eos_token_id) {
+            continue;
+        }
+
+        output_tokens[batch].push_back(output_token);
+
+        if (max_new_tokens[batch] > 1) {
+            active_rows.push_back(batch);
+        }
+    }
+
+    if (active_rows.empty()) {
+        return output_tokens;
+    }
+
+    ov::InferRequest& decoder_with_past = get_step_decoder(models);
+    prepare_step_decoder(models, encoder_hidden_states);
+
+    if (active_rows.size() != batch_size) {
+        compact_step_decoder(models, active_rows, false);
+    }
+
+    // present outputs have to be bound to past inputs after the first inference with new past tensors
+    bool bind_present_to_past = !models.is_stateful_decoder;
+    std::vector<int64_t> step_input_ids;
+    std::vector<ov::genai::RawPerfMetrics*> step_raw_metrics;
+
+    for (size_t step = 0; !active_rows.empty(); step++) {
+        const size_t step_batch_size = active_rows.size();
+
+        step_input_ids.resize(step_batch_size);
+        step_raw_metrics.resize(step_batch_size);
+        for (size_t row = 0; row < step_batch_size; row++) {
+            step_input_ids[row] = output_tokens[active_rows[row]].back();
+            step_raw_metrics[row] = raw_metrics[active_rows[row]];
+        }
+
+        decoder_with_past.set_tensor("input_ids",
+                                     ov::Tensor(ov::element::i64, {step_batch_size, 1}, step_input_ids.data()));
+        set_cache_position(decoder_with_past, init_ids_size + step, 1);
+
+        ov::genai::utils::infer_with_perf_metrics(decoder_with_past, step_raw_metrics);
+
+        if (bind_present_to_past) {
+            bind_self_attention_kv_cache(models);
+            bind_present_to_past = false;
+        }
+
+        // states of a stateful decoder are already reordered, keep them as is on the next step
+        if (models.is_stateful_decoder) {
+            set_beam_idx(decoder_with_past, all_rows(step_batch_size));
+        }
+
+        auto step_logits = decoder_with_past.get_tensor("logits");
+
+        std::vector<size_t> kept_positions;
+        std::vector<size_t> next_active_rows;
+        for (size_t row = 0; row < step_batch_size; row++) {
+            const size_t batch = active_rows[row];
+            auto& tokens = output_tokens[batch];
+
+            ov::genai::do_suppress_tokens(step_logits, row, config.suppress_tokens);
+            if (return_timestamps[batch]) {
+                ov::genai::process_whisper_timestamp_logits(step_logits, row, config, tokens);
+            }
+
+            const int64_t output_token = ov::genai::utils::argmax(step_logits, row);
+            if (output_token == config.eos_token_id) {
+                continue;
+            }
+
+            tokens.push_back(output_token);
+            if (tokens.size() - get_forced_tokens_size(batch) < max_new_tokens[batch]) {
+                kept_positions.push_back(row);
+                next_active_rows.push_back(batch);
+            }
+        }
+
+        if (!next_active_rows.empty() && next_active_rows.size() != step_batch_size) {
+            compact_step_decoder(models, kept_positions, true);
+            bind_present_to_past = !models.is_stateful_decoder;
+        }
+
+        active_rows = std::move(next_active_rows);
+    }
+
+    return output_tokens;
+}
+
+struct DecodedCandidate {
+    // generated tokens without eos
+    std::vector<int64_t> tokens;
+    float sum_logprob = 0.0f;
+};
+
+float length_normalized_score(const DecodedCandidate& candidate, const float length_penalty) {
+    if (candidate.tokens.empty()) {
+        return candidate.sum_logprob;
+    }
+    return candidate.sum_logprob / std::pow(static_cast<float>(candidate.tokens.size()), length_penalty);
+}
+
+/**
+ * Batched search of a single chunk. Every temperature is a group of config.num_beams rows: temperature 0 runs
+ * beam search, other temperatures sample independent candidates. Rows of all groups are decoded together, after
+ * every step kv cache is reordered by the parent row of every hypothesis like beam_idx does in stateful LLMs.
+ * Returns the best candidate of every group.
+ */
+std::vector<DecodedCandidate> search_chunk(ov::Tensor& encoder_hidden_state,
+                                           const ov::genai::WhisperGenerationConfig& config,
+                                           ov::genai::WhisperInitializedModels& models,
+                                           std::vector<int64_t>& init_ids,
+                                           const size_t max_new_tokens,
+                                           const bool return_timestamps,
+                                           const std::vector<float>& temperatures,
+                                           std::mt19937& rng,
+                                           ov::genai::RawPerfMetrics& raw_metrics) {
+    struct Hypothesis {
+        DecodedCandidate candidate;
+        // row of the hypothesis in logits of the last inference
+        size_t row;
+    };
+
+    struct Group {
+        float temperature;
+        std::vector<Hypothesis> live;
+        std::vector<DecodedCandidate> finished;
+    };
+
+    const size_t width = config.num_beams;
+
+    std::vector<Group> groups;
+    for (float temperature : temperatures) {
+        Hypothesis root{{{}, 0.0f}, 0};
+        groups.push_back({temperature, {root}, {}});
+    }
+
+    ov::Tensor input_ids_tensor(ov::element::i64, {1, init_ids.size()}, init_ids.data());
+    infer_prefill(models, encoder_hidden_state, input_ids_tensor, {&raw_metrics});
+    ov::Tensor logits = models.decoder.get_tensor("logits");
+
+    ov::InferRequest& decoder_with_past = get_step_decoder(models);
+    bool is_first_step = true;
+    bool bind_present_to_past = false;
+    std::vector<int64_t> step_input_ids;
+
+    for (size_t step = 0; step < max_new_tokens; step++) {
+        // log probabilities of every row of the last inference, rows are processed once
+        std::map<size_t, std::vector<ov::genai::Token>> row_logprobs;
+        auto get_logprobs = [&](const Hypothesis& hypothesis) -> std::vector<ov::genai::Token>& {
+            auto it = row_logprobs.find(hypothesis.row);
+            if (it != row_logprobs.end()) {
+                return it->second;
+            }
+
+            if (is_first_step) {
+                ov::genai::do_suppress_tokens(logits, hypothesis.row, config.begin_suppress_tokens);
+            }
+            ov::genai::do_suppress_tokens(logits, hypothesis.row, config.suppress_tokens);
+            if (return_timestamps) {
+                ov::genai::process_whisper_timestamp_logits(logits,
+                                                            hypothesis.row,
+                                                            config,
+                                                            hypothesis.candidate.tokens,
+                                                            is_first_step);
+            }
+            return row_logprobs.emplace(hypothesis.row, ov::genai::log_softmax(logits, hypothesis.row)).first->second;
+        };
+
+        const bool is_last_step = step + 1 == max_new_tokens;
+        std::vector<size_t> parent_rows;
+        step_input_ids.clear();
+
+        for (auto& group : groups) {
+            std::vector<Hypothesis> next_live;
+
+            auto extend = [&](const Hypothesis& hypothesis, const ov::genai::Token& token) {
+                DecodedCandidate candidate = hypothesis.candidate;
+                candidate.sum_logprob += token.m_log_prob;
+                if (token.m_index == config.eos_token_id) {
+                    group.finished.push_back(std::move(candidate));
+                    return;
+                }
+
+                candidate.tokens.push_back(token.m_index);
+                if (is_last_step) {
+                    group.finished.push_back(std::move(candidate));
+                    return;
+                }
+                next_live.push_back({std::move(candidate), hypothesis.row});
+            };
+
+            if (group.temperature == 0.0f) {
+                // every live beam proposes its width + 1 best tokens, so width beams survive even if one ends with eos
+                std::vector<std::pair<size_t, ov::genai::Token>> proposals;
+                for (size_t i = 0; i < group.live.size(); i++) {
+                    auto& logprobs = get_logprobs(group.live[i]);
+                    const size_t top_k = std::min(width + 1, logprobs.size());
+                    std::partial_sort(logprobs.begin(),
+                                      logprobs.begin() + top_k,
+                                      logprobs.end(),
+                                      [](const ov::genai::Token& left, const ov::genai::Token& right) {
+                                          return left.m_log_prob > right.m_log_prob;
+                                      });
+                    for (size_t k = 0; k < top_k; k++) {
+                        proposals.emplace_back(i, logprobs[k]);
+                    }
+                }
+
+                std::stable_sort(proposals.begin(), proposals.end(), [&](const auto& left, const auto& right) {
+                    return group.live[left.first].candidate.sum_logprob + left.second.m_log_prob >
+                           group.live[right.first].candidate.sum_logprob + right.second.m_log_prob;
+                });
+
+                for (const auto& [live_idx, token] : proposals) {
+                    if (next_live.size() == width || group.finished.size() >= width) {
+                        break;
+                    }
+                    extend(group.live[live_idx], token);
+                }
+
+                // beam search is over once width hypotheses are finished
+                if (group.finished.size() >= width) {
+                    next_live.clear();
+                }
+            } else {
+                // the root of a sampling group is split into width independent candidates
+                const size_t samples_per_hypothesis = is_first_step ? width : 1;
+                for (const auto& hypothesis : group.live) {
+                    const auto& logprobs = get_logprobs(hypothesis);
+                    std::vector<float> weights(logprobs.size());
+                    for (size_t i = 0; i < logprobs.size(); i++) {
+                        weights[i] = std::exp(logprobs[i].m_log_prob / group.temperature);
+                    }
+                    std::discrete_distribution<size_t> distribution(weights.begin(), weights.end());
+                    for (size_t sample = 0; sample < samples_per_hypothesis; sample++) {
+                        extend(hypothesis, logprobs[distribution(rng)]);
+                    }
+                }
+            }
+
+            for (auto& hypothesis : next_live) {
+                parent_rows.push_back(hypothesis.row);
+                hypothesis.row = parent_rows.size() - 1;
+                step_input_ids.push_back(hypothesis.candidate.tokens.back());
+            }
+            group.live = std::move(next_live);
+        }
+
+        if (parent_rows.empty()) {
+            break;
+        }
+
+        if (is_first_step) {
+            prepare_step_decoder(models, encoder_hidden_state);
+            compact_step_decoder(models, parent_rows, false, true);
+            bind_present_to_past = !models.is_stateful_decoder;
+        } else {
+            const size_t batch_size = logits.get_shape().at(0);
+            bool is_identity = parent_rows.size() == batch_size;
+            for (size_t row = 0; is_identity && row < parent_rows.size(); row++) {
+                is_identity = parent_rows[row] == row;
+            }
+            if (!is_identity) {
+                compact_step_decoder(models, parent_rows, true, true);
+                bind_present_to_past = !models.is_stateful_decoder;
+            } else if (models.is_stateful_decoder) {
+                set_beam_idx(decoder_with_past, parent_rows);
+            }
+        }
+
+        const size_t step_batch_size = parent_rows.size();
+        decoder_with_past.set_tensor("input_ids",
+                                     ov::Tensor(ov::element::i64, {step_batch_size, 1}, step_input_ids.data()));
+        set_cache_position(decoder_with_past, init_ids.size() + step, 1);
+
+        ov::genai::utils::infer_with_perf_metrics(decoder_with_past, raw_metrics, step_batch_size);
+
+        if (bind_present_to_past) {
+            bind_self_attention_kv_cache(models);
+            bind_present_to_past = false;
+        }
+
+        logits = decoder_with_past.get_tensor("logits");
+        is_first_step = false;
+    }
+
+    std::vector<DecodedCandidate> best_candidates;
+    for (auto& group : groups) {
+        for (auto& hypothesis : group.live) {
+            group.finished.push_back(std::move(hypothesis.candidate));
+        }
+        OPENVINO_ASSERT(!group.finished.empty(), "Search finished without candidates");
+
+        auto best = std::max_element(group.finished.begin(),
+                                     group.finished.end(),
+                                     [&](const DecodedCandidate& left, const DecodedCandidate& right) {
+                                         return length_normalized_score(left, config.length_penalty) <
+                                                length_normalized_score(right, config.length_penalty);
+                                     });
+        best_candidates.push_back(std::move(*best));
+    }
+
+    return best_candidates;
+}
+
+// Number of tokens divided by the number of phrases of greedy LZ77 parsing, high for looped output.
+float compression_ratio(const std::vector<int64_t>& tokens) {
+    if (tokens.empty()) {
+        return 0.0f;
+    }
+
+    size_t phrases = 0;
+    for (size_t i = 0; i < tokens.size(); phrases++) {
+        size_t longest_match = 1;
+        for (size_t j = 0; j < i; j++) {
+            size_t length = 0;
+            while (i + length < tokens.size() && tokens[j + length] == tokens[i + length]) {
+                length++;
+            }
+            longest_match = std::max(longest_match, length);
+        }
+        i += longest_match;
+    }
+
+    return static_cast<float>(tokens.size()) / phrases;
+}
+
+bool needs_fallback(const DecodedCandidate& candidate, const ov::genai::WhisperGenerationConfig& config) {
+    if (config.compression_ratio_threshold.has_value() &&
+        compression_ratio(candidate.tokens) > *config.compression_ratio_threshold) {
+        return true;
+    }
+
+    // + 1 accounts for eos as in OpenAI Whisper
+    const float avg_logprob = candidate.sum_logprob / (candidate.tokens.size() + 1);
+    return config.logprob_threshold.has_value() && avg_logprob < *config.logprob_threshold;
+}
+
+bool is_quality_decoding(const ov::genai::WhisperGenerationConfig& config) {
+    return config.num_beams > 1 || config.temperatures.size() > 1 || config.temperatures.front() > 0.0f;
+}
+
+/**
+ * Decodes a chunk with the first temperature. If the result fails quality thresholds, all remaining temperatures
+ * are decoded as one batch and the first candidate which passes the thresholds is taken, the last one otherwise.
+ */
+std::vector<int64_t> decode_with_fallback(ov::Tensor& encoder_hidden_state,
+                                          const ov::genai::WhisperGenerationConfig& config,
+                                          ov::genai::WhisperInitializedModels& models,
+                                          std::vector<int64_t>& init_ids,
+                                          const size_t max_new_tokens,
+                                          const bool return_timestamps,
+                                          std::mt19937& rng,
+                                          ov::genai::RawPerfMetrics& raw_metrics) {
+    const auto& temperatures = config.temperatures;
+
+    auto candidates = search_chunk(encoder_hidden_state,
+                                   config,
+                                   models,
+                                   init_ids,
+                                   max_new_tokens,
+                                   return_timestamps,
+                                   {temperatures.front()},
+                                   rng,
+                                   raw_metrics);
+    reset_decoder_state(models);
+
+    if (temperatures.size() == 1 || !needs_fallback(candidates.front(), config)) {
+        return candidates.front().tokens;
+    }
+
+    candidates = search_chunk(encoder_hidden_state,
+                              config,
+                              models,
+                              init_ids,
+                              max_new_tokens,
+                              return_timestamps,
+                              {temperatures.begin() + 1, temperatures.end()},
+                              rng,
+                              raw_metrics);
+    reset_decoder_state(models);
+
+    for (auto& candidate : candidates) {
+        if (!needs_fallback(candidate, config)) {
+            return candidate.tokens;
+        }
+    }
+    return candidates.back().tokens;
+}
+
 }  // namespace
 
 namespace ov {
@@ -290,6 +875,10 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     std::vector<int64_t>& output_tokens = result.output_tokens;
     std::vector<Segment> segments;
 
+    // beam search and temperature fallback replace greedy decoding
+    const bool quality_decoding = is_quality_decoding(config);
+    std::mt19937 rng(config.rng_seed);
+
     // 0.02 by default
     const float time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
     size_t segment_offset = 0;
@@ -310,22 +899,40 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
         // prepare init_ids just once for whole input
         if (init_tokens.empty()) {
             init_tokens =
-                prepare_init_tokens(hidden_state_tensor, models.decoder, config, return_timestamps, raw_metrics);
+                prepare_init_tokens(hidden_state_tensor, models, config, return_timestamps, raw_metrics);
         }
 
         std::vector<int64_t> chunk_init_tokens = ov::genai::get_prompt_tokens(context_tokens, config, chunk_offset);
         chunk_init_tokens.insert(chunk_init_tokens.end(), init_tokens.begin(), init_tokens.end());
 
-        auto [cancelled, chunk_output_tokens] = full_decode(hidden_state_tensor,
-                                                            config,
-                                                            models,
-                                                            chunk_init_tokens,
-                                                            max_new_tokens - output_tokens.size(),
-                                                            return_timestamps,
-                                                            raw_metrics,
-                                                            streamer);
+        bool cancelled = false;
+        std::vector<int64_t> chunk_output_tokens;
+        if (quality_decoding) {
+            chunk_output_tokens = decode_with_fallback(hidden_state_tensor,
+                                                       config,
+                                                       models,
+                                                       chunk_init_tokens,
+                                                       max_new_tokens - output_tokens.size(),
+                                                       return_timestamps,
+                                                       rng,
+                                                       raw_metrics);
+
+            // the best hypothesis is known only after the whole chunk is decoded
+            if (!return_timestamps && streamer && streamer->put_chunk(chunk_output_tokens)) {
+                cancelled = true;
+            }
+        } else {
+            std::tie(cancelled, chunk_output_tokens) = full_decode(hidden_state_tensor,
+                                                                   config,
+                                                                   models,
+                                                                   chunk_init_tokens,
+                                                                   max_new_tokens - output_tokens.size(),
+                                                                   return_timestamps,
+                                                                   raw_metrics,
+                                                                   streamer);
+        }
 
-        models.decoder_with_past.reset_state();
+        reset_decoder_state(models);
 
         if (return_timestamps) {
             auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
@@ -373,5 +980,256 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
 
     return result;
 }
+
+ov::Tensor whisper_encode(ov::InferRequest& encoder,
+                          std::vector<float>& mel_data,
+                          const size_t feature_size,
+                          const size_t nb_max_frames,
+                          ov::genai::RawPerfMetrics& raw_metrics) {
+    return encode(encoder, mel_data, feature_size, nb_max_frames, raw_metrics);
+}
+
+std::vector<int64_t> whisper_init_tokens(ov::Tensor& encoder_hidden_state,
+                                         ov::genai::WhisperInitializedModels& models,
+                                         const ov::genai::WhisperGenerationConfig& config,
+                                         const bool return_timestamps,
+                                         ov::genai::RawPerfMetrics& raw_metrics) {
+    return prepare_init_tokens(encoder_hidden_state, models, config, return_timestamps, raw_metrics);
+}
+
+std::vector<int64_t> whisper_decode_with_prefix(const ov::Tensor& encoder_hidden_state,
+                                                const ov::genai::WhisperGenerationConfig& config,
+                                                ov::genai::WhisperInitializedModels& models,
+                                                const std::vector<int64_t>& init_ids,
+                                                const std::vector<int64_t>& forced_tokens,
+                                                const size_t max_new_tokens,
+                                                const bool return_timestamps,
+                                                ov::genai::RawPerfMetrics& raw_metrics) {
+    auto output_tokens = full_decode_batch(encoder_hidden_state,
+                                           config,
+                                           models,
+                                           {init_ids},
+                                           {max_new_tokens},
+                                           {return_timestamps},
+                                           {&raw_metrics},
+                                           {forced_tokens});
+    reset_decoder_state(models);
+    return output_tokens[0];
+}
+
+std::vector<WhisperGenerateResult> whisper_generate(const ov::genai::WhisperGenerationConfig& config,
+                                                    const ov::genai::WhisperConfig& model_config,
+                                                    const WhisperContextTokens& context_tokens,
+                                                    const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                    ov::genai::WhisperInitializedModels& models,
+                                                    WhisperFeatureExtractor& feature_extractor) {
+    const size_t max_new_tokens = config.get_max_new_tokens();
+    const size_t batch_size = raw_speech_inputs.size();
+
+    // search keeps its own batch of hypotheses per chunk, inputs are transcribed one by one
+    if (is_quality_decoding(config)) {
+        std::vector<WhisperGenerateResult> results;
+        for (const auto& raw_speech : raw_speech_inputs) {
+            results.push_back(
+                whisper_generate(config, model_config, context_tokens, raw_speech, models, feature_extractor, nullptr));
+        }
+        return results;
+    }
+
+    std::vector<WhisperGenerateResult> results(batch_size);
+    for (auto& result : results) {
+        result.perf_metrics.num_input_tokens = 0;
+        result.perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+    }
+
+    // adds duration of an inference of a batch to metrics of the inputs of the batch
+    const auto add_inference_duration = [&results](const RawPerfMetrics& batch_raw_metrics, size_t input_idx) {
+        results[input_idx].perf_metrics.raw_metrics.m_inference_durations[0] += batch_raw_metrics.m_inference_durations[0];
+    };
+
+    struct InputState {
+        WhisperFeatures features;
+        bool is_shortform;
+        bool return_timestamps;
+        size_t chunk_offset = 0;
+        std::vector<int64_t> init_tokens;
+        std::vector<Segment> segments;
+    };
+    std::vector<InputState> states(batch_size);
+
+    for (size_t i = 0; i < batch_size; i++) {
+        const auto extract_start = std::chrono::steady_clock::now();
+        states[i].features = feature_extractor.extract(raw_speech_inputs[i]);
+        const auto extract_ms =
+            ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - extract_start);
+        results[i].perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(extract_ms);
+
+        states[i].is_shortform = states[i].features.n_frames <= feature_extractor.nb_max_frames;
+        // long-form audio processing requires timestamps to be enabled
+        states[i].return_timestamps = config.return_timestamps || !states[i].is_shortform;
+    }
+
+    // 0.02 by default
+    const float time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
+    const size_t chunk_size = feature_extractor.feature_size * feature_extractor.nb_max_frames;
+
+    // Every round encodes the next chunk of every unfinished input as a single batch.
+    // Chunks of the same input can't be encoded together: with timestamps the next chunk starts
+    // at the last timestamp predicted for the previous chunk.
+    while (true) {
+        std::vector<size_t> active_inputs;
+        for (size_t i = 0; i < batch_size; i++) {
+            if (states[i].chunk_offset < states[i].features.n_frames &&
+                results[i].output_tokens.size() < max_new_tokens) {
+                active_inputs.push_back(i);
+            }
+        }
+
+        if (active_inputs.empty()) {
+            break;
+        }
+
+        std::vector<float> mel_data;
+        mel_data.reserve(active_inputs.size() * chunk_size);
+        for (size_t i : active_inputs) {
+            auto chunk = states[i].features.get_data_with_offset(states[i].chunk_offset, feature_extractor.nb_max_frames);
+            mel_data.insert(mel_data.end(), chunk.begin(), chunk.end());
+        }
+
+        RawPerfMetrics encoder_raw_metrics;
+        encoder_raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+        ov::Tensor hidden_states = encode(models.encoder,
+                                          mel_data,
+                                          feature_extractor.feature_size,
+                                          feature_extractor.nb_max_frames,
+                                          encoder_raw_metrics);
+        for (size_t i : active_inputs) {
+            add_inference_duration(encoder_raw_metrics, i);
+        }
+
+        // prepare init_ids just once for every input
+        std::vector<size_t> rows_to_detect_language;
+        for (size_t row = 0; row < active_inputs.size(); row++) {
+            auto& state = states[active_inputs[row]];
+            if (!state.init_tokens.empty()) {
+                continue;
+            }
+
+            if (!config.is_multilingual) {
+                state.init_tokens = build_non_multilingual_init_tokens(config, state.return_timestamps);
+            } else if (config.language.has_value()) {
+                OPENVINO_ASSERT(config.lang_to_id.count(*config.language),
+                                "Language ",
+                                *config.language,
+                                " is not found in lang_to_id");
+                state.init_tokens =
+                    build_init_tokens(config, config.lang_to_id.at(*config.language), state.return_timestamps);
+            } else {
+                rows_to_detect_language.push_back(row);
+            }
+        }
+
+        if (!rows_to_detect_language.empty()) {
+            ov::Tensor language_hidden_states = rows_to_detect_language.size() == active_inputs.size()
+                                                    ? hidden_states
+                                                    : gather_rows(hidden_states, rows_to_detect_language);
+            RawPerfMetrics language_raw_metrics;
+            language_raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+            auto language_token_ids = detect_language(language_hidden_states, models, config, language_raw_metrics);
+            for (size_t i = 0; i < rows_to_detect_language.size(); i++) {
+                const size_t input_idx = active_inputs[rows_to_detect_language[i]];
+                auto& state = states[input_idx];
+                state.init_tokens = build_init_tokens(config, language_token_ids[i], state.return_timestamps);
+                add_inference_duration(language_raw_metrics, input_idx);
+            }
+        }
+
+        // decoder has no attention mask, so rows are decoded together only if their init ids have the same length
+        std::vector<std::vector<int64_t>> chunk_init_tokens(active_inputs.size());
+        std::map<size_t, std::vector<size_t>> rows_by_init_size;
+        for (size_t row = 0; row < active_inputs.size(); row++) {
+            auto& state = states[active_inputs[row]];
+            chunk_init_tokens[row] = ov::genai::get_prompt_tokens(context_tokens, config, state.chunk_offset);
+            chunk_init_tokens[row].insert(chunk_init_tokens[row].end(),
+                                          state.init_tokens.begin(),
+                                          state.init_tokens.end());
+            rows_by_init_size[chunk_init_tokens[row].size()].push_back(row);
+        }
+
+        for (auto& [init_size, rows] : rows_by_init_size) {
+            std::vector<std::vector<int64_t>> group_init_tokens;
+            std::vector<size_t> group_max_new_tokens;
+            std::vector<bool> group_return_timestamps;
+            std::vector<RawPerfMetrics*> group_raw_metrics;
+            for (size_t row : rows) {
+                const size_t input_idx = active_inputs[row];
+                group_init_tokens.push_back(chunk_init_tokens[row]);
+                group_max_new_tokens.push_back(max_new_tokens - results[input_idx].output_tokens.size());
+                group_return_timestamps.push_back(states[input_idx].return_timestamps);
+                group_raw_metrics.push_back(&results[input_idx].perf_metrics.raw_metrics);
+            }
+
+            ov::Tensor group_hidden_states =
+                rows.size() == active_inputs.size() ? hidden_states : gather_rows(hidden_states, rows);
+
+            auto group_output_tokens = full_decode_batch(group_hidden_states,
+                                                         config,
+                                                         models,
+                                                         group_init_tokens,
+                                                         group_max_new_tokens,
+                                                         group_return_timestamps,
+                                                         group_raw_metrics);
+
+            reset_decoder_state(models);
+
+            for (size_t i = 0; i < rows.size(); i++) {
+                const size_t input_idx = active_inputs[rows[i]];
+                auto& state = states[input_idx];
+                auto& output_tokens = results[input_idx].output_tokens;
+                auto& chunk_output_tokens = group_output_tokens[i];
+
+                size_t segment_offset = 0;
+                if (state.return_timestamps) {
+                    auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
+                                                                          config,
+                                                                          feature_extractor.nb_max_frames,
+                                                                          time_precision);
+
+                    ov::genai::utils::filter_non_segment_metrics(results[input_idx].perf_metrics.raw_metrics,
+                                                                 output_tokens.size(),
+                                                                 extracted_segments.segment_ranges);
+
+                    state.segments.insert(state.segments.end(),
+                                          extracted_segments.segments.begin(),
+                                          extracted_segments.segments.end());
+
+                    output_tokens.insert(output_tokens.end(),
+                                         extracted_segments.non_timestamp_tokens.begin(),
+                                         extracted_segments.non_timestamp_tokens.end());
+
+                    segment_offset = extracted_segments.last_offset;
+                } else {
+                    output_tokens.insert(output_tokens.end(), chunk_output_tokens.begin(), chunk_output_tokens.end());
+                }
+
+                if (state.is_shortform) {
+                    segment_offset = state.features.n_frames;
+                }
+
+                state.chunk_offset += segment_offset;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < batch_size; i++) {
+        // if return_timestamps wasn't enabled by user
+        if (config.return_timestamps) {
+            results[i].segments = std::move(states[i].segments);
+        }
+    }
+
+    return results;
+}
+
 }  // namespace genai
 }  // namespace ov
@@ -35,5 +35,50 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        ov::genai::WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<ChunkStreamerBase> streamer);
 
+/**
+ * Transcribes multiple inputs at once: chunks of all unfinished inputs are encoded as one batch and decoded
+ * with a dynamic batch, inputs finish independently. Returns one result per input. Perf metrics of a result
+ * hold inferences the input took part in, durations of batched inferences are counted for every input of the batch.
+ */
+std::vector<WhisperGenerateResult> whisper_generate(const ov::genai::WhisperGenerationConfig& config,
+                                                    const ov::genai::WhisperConfig& model_config,
+                                                    const WhisperContextTokens& context_tokens,
+                                                    const std::vector<ov::genai::RawSpeechInput>& raw_speech_inputs,
+                                                    ov::genai::WhisperInitializedModels& models,
+                                                    ov::genai::WhisperFeatureExtractor& feature_extractor);
+
+/**
+ * Encodes stacked chunks of [feature_size, nb_max_frames] features.
+ * Returned tensor is owned by the encoder request and is valid until its next inference.
+ */
+ov::Tensor whisper_encode(ov::InferRequest& encoder,
+                          std::vector<float>& mel_data,
+                          const size_t feature_size,
+                          const size_t nb_max_frames,
+                          ov::genai::RawPerfMetrics& raw_metrics);
+
+/**
+ * Returns decoder start tokens: start of transcript, language (detected if not set in config), task and
+ * no timestamps tokens.
+ */
+std::vector<int64_t> whisper_init_tokens(ov::Tensor& encoder_hidden_state,
+                                         ov::genai::WhisperInitializedModels& models,
+                                         const ov::genai::WhisperGenerationConfig& config,
+                                         const bool return_timestamps,
+                                         ov::genai::RawPerfMetrics& raw_metrics);
+
+/**
+ * Greedy decoding of a single encoded chunk which continues already known forced_tokens.
+ * Returns forced_tokens followed by at most max_new_tokens generated tokens.
+ */
+std::vector<int64_t> whisper_decode_with_prefix(const ov::Tensor& encoder_hidden_state,
+                                                const ov::genai::WhisperGenerationConfig& config,
+                                                ov::genai::WhisperInitializedModels& models,
+                                                const std::vector<int64_t>& init_ids,
+                                                const std::vector<int64_t>& forced_tokens,
+                                                const size_t max_new_tokens,
+                                                const bool return_timestamps,
+                                                ov::genai::RawPerfMetrics& raw_metrics);
+
 }  // namespace genai
 }  // namespace ov
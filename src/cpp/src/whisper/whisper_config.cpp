@@ -27,6 +27,7 @@ WhisperConfig::WhisperConfig(const std::filesystem::path& json_path) {
     nlohmann::json data = nlohmann::json::parse(f);
 
     read_json_param(data, "max_source_positions", max_source_positions);
+    read_json_param(data, "max_target_positions", max_target_positions);
 }
 
 }  // namespace genai
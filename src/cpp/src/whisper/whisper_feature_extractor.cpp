@@ -11,6 +11,7 @@
 #include <cassert>
 #include <cmath>
 #include <fstream>
+#include <iterator>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include <openvino/core/except.hpp>
@@ -40,93 +41,8 @@ static bool hann_window(const size_t length, const bool periodic, std::vector<fl
     return true;
 }
 
-// naive Discrete Fourier Transform
-// input is real-valued
-// output is complex-valued
-static void dft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    int N = in.size();
-
-    out.resize(N * 2);
-    const int sin_cos_step = n_fft / N;
-
-    for (int k = 0; k < N; k++) {
-        float re = 0;
-        float im = 0;
-
-        for (int n = 0; n < N; n++) {
-            int idx = (k * n * sin_cos_step) % (n_fft);  // t = 2*M_PI*k*n/N
-            re += in[n] * cos_vals[idx];                 // cos(t)
-            im -= in[n] * sin_vals[idx];                 // sin(t)
-        }
-
-        out[k * 2 + 0] = re;
-        out[k * 2 + 1] = im;
-    }
-}
-
-// Cooley-Tukey FFT
-// input is real-valued
-// output is complex-valued
-static void fft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    out.resize(in.size() * 2);
-
-    int N = in.size();
-
-    if (N == 1) {
-        out[0] = in[0];
-        out[1] = 0;
-        return;
-    }
-
-    if (N % 2 == 1) {
-        dft(in, out, sin_vals, cos_vals, n_fft);
-        return;
-    }
-
-    std::vector<float> even;
-    std::vector<float> odd;
-
-    even.reserve(N / 2);
-    odd.reserve(N / 2);
-
-    for (int i = 0; i < N; i++) {
-        if (i % 2 == 0) {
-            even.push_back(in[i]);
-        } else {
-            odd.push_back(in[i]);
-        }
-    }
-
-    std::vector<float> even_fft;
-    std::vector<float> odd_fft;
-
-    fft(even, even_fft, sin_vals, cos_vals, n_fft);
-    fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
-
-    const int sin_cos_step = n_fft / N;
-    for (int k = 0; k < N / 2; k++) {
-        int idx = k * sin_cos_step;  // t = 2*M_PI*k/N
-        float re = cos_vals[idx];    // cos(t)
-        float im = -sin_vals[idx];   // sin(t)
-
-        float re_odd = odd_fft[2 * k + 0];
-        float im_odd = odd_fft[2 * k + 1];
-
-        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
-        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
-
-        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
-        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
-    }
-}
+// number of frames transformed before the mel filter bank is applied to all of them at once
+constexpr int frames_block_size = 16;
 
 static void log_mel_spectrogram_worker_thread(int ith,
                                               const std::vector<float>& hann,
@@ -136,63 +52,70 @@ static void log_mel_spectrogram_worker_thread(int ith,
                                               int frame_step,
                                               int n_threads,
                                               const std::vector<float>& mel_filter,
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
                                               WhisperFeatures& features,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
-    std::vector<float> fft_in(frame_size, 0.0);
-    std::vector<float> fft_out(2 * frame_size);
-    int n_fft = 1 + (frame_size / 2);
-    int i = ith;
+                                              const ov::genai::RealFFT& fft) {
+    const int n_bins = fft.bins();
 
-    OPENVINO_ASSERT(mel_filter.size() == n_fft * features.feature_size);
+    OPENVINO_ASSERT(mel_filter.size() == n_bins * features.feature_size);
+
+    ov::genai::RealFFT::Workspace workspace = fft.create_workspace();
+    std::vector<float> fft_in(frame_size, 0.0f);
+    std::vector<float> power(n_bins);
+    // power spectra of a block of frames with shape [n_bins, frames_block_size]
+    std::vector<float> power_block(n_bins * frames_block_size, 0.0f);
+    std::vector<float> mel_block(frames_block_size);
+
+    const int n_fft_frames = std::min(n_samples / frame_step + 1, int(features.n_frames));
 
     // calculate FFT only when fft_in are not all zero
-    for (; i < std::min(n_samples / frame_step + 1, int(features.n_frames)); i += n_threads) {
-        const int offset = i * frame_step;
+    for (int block_start = ith * frames_block_size; block_start < n_fft_frames;
+         block_start += n_threads * frames_block_size) {
+        const int block_size = std::min(frames_block_size, n_fft_frames - block_start);
 
-        // apply Hanning window (~10% faster)
-        for (int j = 0; j < std::min(frame_size, n_samples - offset); j++) {
-            fft_in[j] = hann[j] * samples[offset + j];
-        }
-        // fill the rest with zeros
-        if (n_samples - offset < frame_size) {
-            std::fill(fft_in.begin() + (n_samples - offset), fft_in.end(), 0.0);
-        }
+        for (int f = 0; f < block_size; f++) {
+            const int offset = (block_start + f) * frame_step;
+            const int n_valid = std::min(frame_size, n_samples - offset);
+
+            // apply Hanning window (~10% faster)
+            for (int j = 0; j < n_valid; j++) {
+                fft_in[j] = hann[j] * samples[offset + j];
+            }
+            // fill the rest with zeros
+            std::fill(fft_in.begin() + n_valid, fft_in.end(), 0.0f);
 
-        // FFT
-        fft(fft_in, fft_out, sin_vals, cos_vals, frame_size);
+            fft.power_spectrum(fft_in.data(), power.data(), workspace);
 
-        // Calculate modulus^2 of complex numbers
-        // Use pow(fft_out[2 * j + 0], 2) + pow(fft_out[2 * j + 1], 2) causes inference quality problem? Interesting.
-        for (int j = 0; j < n_fft; j++) {
-            fft_out[j] = (fft_out[2 * j + 0] * fft_out[2 * j + 0] + fft_out[2 * j + 1] * fft_out[2 * j + 1]);
+            for (int k = 0; k < n_bins; k++) {
+                power_block[k * frames_block_size + f] = power[k];
+            }
         }
 
-        // mel spectrogram
+        // mel spectrogram: [feature_size, n_bins] x [n_bins, frames_block_size]
+        // mel filters are triangular, so only the non-zero range of each row is multiplied.
+        // The inner loop runs over frames with a fixed trip count and is vectorized by the compiler.
         for (int j = 0; j < features.feature_size; j++) {
-            double sum = 0.0;
-
-            // unroll loop (suggested by GH user @lunixbochs)
-            int k = 0;
-            for (k = 0; k < n_fft - 3; k += 4) {
-                sum += fft_out[k + 0] * mel_filter[j * n_fft + k + 0] + fft_out[k + 1] * mel_filter[j * n_fft + k + 1] +
-                       fft_out[k + 2] * mel_filter[j * n_fft + k + 2] + fft_out[k + 3] * mel_filter[j * n_fft + k + 3];
+            std::fill(mel_block.begin(), mel_block.end(), 0.0f);
+            const float* filter_row = mel_filter.data() + j * n_bins;
+
+            for (size_t k = mel_filter_ranges[j].first; k < mel_filter_ranges[j].second; k++) {
+                const float weight = filter_row[k];
+                const float* power_row = power_block.data() + k * frames_block_size;
+                for (int f = 0; f < frames_block_size; f++) {
+                    mel_block[f] += weight * power_row[f];
+                }
             }
 
-            // handle n_fft remainder
-            for (; k < n_fft; k++) {
-                sum += fft_out[k] * mel_filter[j * n_fft + k];
+            float* output = features.data.data() + j * features.n_frames + block_start;
+            for (int f = 0; f < block_size; f++) {
+                output[f] = log10f(std::max(mel_block[f], 1e-10f));
             }
-
-            sum = log10(std::max(sum, 1e-10));
-
-            features.data[j * features.n_frames + i] = sum;
         }
     }
 
     // Otherwise fft_out are all zero
-    double sum = log10(1e-10);
-    for (; i < features.n_frames; i += n_threads) {
+    const float sum = log10(1e-10);
+    for (int i = n_fft_frames + ith; i < features.n_frames; i += n_threads) {
         for (int j = 0; j < features.feature_size; j++) {
             features.data[j * features.n_frames + i] = sum;
         }
@@ -302,19 +225,6 @@ std::vector<std::vector<float>> mel_filter_bank(const int64_t num_frequency_bins
     return mel_filters;
 }
 
-// In FFT, we frequently use sine and cosine operations with the same values.
-// We can use precalculated values to speed up the process.
-void fill_sin_cos_table(std::vector<float>& sin_vals, std::vector<float>& cos_vals, const size_t n_fft) {
-    sin_vals.resize(n_fft);
-    cos_vals.resize(n_fft);
-
-    for (size_t i = 0; i < n_fft; i++) {
-        double theta = (2 * M_PI * i) / n_fft;
-        sin_vals[i] = sinf(theta);
-        cos_vals[i] = cosf(theta);
-    }
-}
-
 std::vector<float> pad(const std::vector<float>& raw_speech,
                        const size_t minimum_length,
                        const size_t reflect_pad_size) {
@@ -343,15 +253,10 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                               const size_t n_fft,
                                               const size_t hop_length,
                                               const size_t n_threads,
+                                              const std::vector<float>& hann,
                                               const std::vector<float>& mel_filter,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
-    // Hanning window (Use cosf to eliminate difference)
-    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
-    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
-    std::vector<float> hann;
-    hann_window(n_fft, true, hann);
-
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
+                                              const ov::genai::RealFFT& fft) {
     const size_t reflect_pad_size = n_fft / 2;
     auto padded_raw_speech = pad(raw_speech, sampling_rate * 30, reflect_pad_size);
 
@@ -368,15 +273,15 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
             workers[iw] = std::thread(log_mel_spectrogram_worker_thread,
                                       iw + 1,
                                       std::cref(hann),
-                                      padded_raw_speech,
+                                      std::cref(padded_raw_speech),
                                       raw_speech.size() + reflect_pad_size,
                                       n_fft,
                                       hop_length,
                                       n_threads,
                                       std::cref(mel_filter),
+                                      std::cref(mel_filter_ranges),
                                       std::ref(features),
-                                      std::cref(sin_vals),
-                                      std::cref(cos_vals));
+                                      std::cref(fft));
         }
 
         // main thread
@@ -388,9 +293,9 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                           hop_length,
                                           n_threads,
                                           mel_filter,
+                                          mel_filter_ranges,
                                           features,
-                                          sin_vals,
-                                          cos_vals);
+                                          fft);
 
         for (int iw = 0; iw < n_threads - 1; ++iw) {
             workers[iw].join();
@@ -442,7 +347,11 @@ std::vector<float> WhisperFeatures::get_data_with_offset(const size_t frame_offs
 
 WhisperFeatureExtractor::WhisperFeatureExtractor(const std::filesystem::path& preprocessor_json_path) {
     init_parameters(preprocessor_json_path);
-    fill_sin_cos_table(sin_vals, cos_vals, n_fft);
+    fft = std::make_shared<RealFFT>(n_fft);
+    // Hanning window (Use cosf to eliminate difference)
+    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
+    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
+    hann_window(n_fft, true, hann);
     init_mel_filter();
 }
 
@@ -477,6 +386,23 @@ void WhisperFeatureExtractor::init_mel_filter() {
             mel_filter[col * mel_data.size() + row] = mel_data[row][col];
         }
     }
+
+    mel_filter_ranges.assign(feature_size, {0, 0});
+    for (size_t col = 0; col < mel_data[0].size(); col++) {
+        const float* filter_row = mel_filter.data() + col * mel_data.size();
+        const auto is_non_zero = [](float weight) {
+            return weight != 0.0f;
+        };
+        const auto first = std::find_if(filter_row, filter_row + mel_data.size(), is_non_zero);
+        if (first == filter_row + mel_data.size()) {
+            continue;
+        }
+        const auto last = std::find_if(std::make_reverse_iterator(filter_row + mel_data.size()),
+                                       std::make_reverse_iterator(filter_row),
+                                       is_non_zero);
+        mel_filter_ranges[col] = {static_cast<size_t>(first - filter_row),
+                                  static_cast<size_t>(last.base() - filter_row)};
+    }
 }
 
 WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_speech) {
@@ -487,9 +413,120 @@ WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_s
                                          n_fft,
                                          hop_length,
                                          n_threads,
+                                         hann,
                                          mel_filter,
-                                         sin_vals,
-                                         cos_vals);
+                                         mel_filter_ranges,
+                                         *fft);
+}
+
+void WhisperFeatureExtractor::extract_incremental(WhisperStreamingFeatures& state,
+                                                  const std::vector<float>& raw_speech,
+                                                  bool finish) {
+    OPENVINO_ASSERT(!state.finished, "Streaming features extraction is already finished");
+
+    const size_t reflect_pad_size = n_fft / 2;
+
+    if (!state.padding_ready) {
+        state.pending_samples.insert(state.pending_samples.end(), raw_speech.begin(), raw_speech.end());
+        if (state.pending_samples.size() <= reflect_pad_size && !finish) {
+            return;
+        }
+
+        // too short audio is followed by zeros anyway
+        if (state.pending_samples.size() <= reflect_pad_size) {
+            state.pending_samples.resize(reflect_pad_size + 1, 0.0f);
+        }
+
+        // reflect pad
+        state.samples.resize(reflect_pad_size);
+        std::reverse_copy(state.pending_samples.begin() + 1,
+                          state.pending_samples.begin() + 1 + reflect_pad_size,
+                          state.samples.begin());
+        state.samples.insert(state.samples.end(), state.pending_samples.begin(), state.pending_samples.end());
+
+        state.pending_samples.clear();
+        state.padding_ready = true;
+    } else {
+        state.samples.insert(state.samples.end(), raw_speech.begin(), raw_speech.end());
+    }
+
+    // same as in offline extraction audio is followed by zeros, the last frames partially cover the audio end
+    if (finish) {
+        state.samples.resize(state.samples.size() + n_fft, 0.0f);
+        state.finished = true;
+    }
+
+    const size_t n_bins = fft->bins();
+    RealFFT::Workspace workspace = fft->create_workspace();
+    std::vector<float> fft_in(n_fft);
+    std::vector<float> power(n_bins);
+
+    size_t n_frames = state.frames.size() / feature_size;
+    while (n_frames * hop_length + n_fft <= state.samples.size()) {
+        const float* frame_samples = state.samples.data() + n_frames * hop_length;
+        for (size_t j = 0; j < n_fft; j++) {
+            fft_in[j] = hann[j] * frame_samples[j];
+        }
+
+        fft->power_spectrum(fft_in.data(), power.data(), workspace);
+
+        for (size_t j = 0; j < feature_size; j++) {
+            const float* filter_row = mel_filter.data() + j * n_bins;
+            float sum = 0.0f;
+            for (size_t k = mel_filter_ranges[j].first; k < mel_filter_ranges[j].second; k++) {
+                sum += filter_row[k] * power[k];
+            }
+            state.frames.push_back(log10f(std::max(sum, 1e-10f)));
+        }
+
+        n_frames++;
+    }
+}
+
+void WhisperFeatureExtractor::discard_streaming_frames(WhisperStreamingFeatures& state, const size_t frame) {
+    OPENVINO_ASSERT(frame >= state.frames_offset && frame <= state.end_frame(feature_size),
+                    "Frame ",
+                    frame,
+                    " is out of stored frames range");
+
+    const size_t n_discarded = frame - state.frames_offset;
+    state.frames.erase(state.frames.begin(), state.frames.begin() + n_discarded * feature_size);
+
+    // samples[0] is the first sample of frame frames_offset
+    const size_t n_discarded_samples = std::min(n_discarded * hop_length, state.samples.size());
+    state.samples.erase(state.samples.begin(), state.samples.begin() + n_discarded_samples);
+
+    state.frames_offset = frame;
+}
+
+std::vector<float> WhisperFeatureExtractor::get_streaming_window(const WhisperStreamingFeatures& state,
+                                                                 const size_t frame) const {
+    OPENVINO_ASSERT(frame >= state.frames_offset, "Frame ", frame, " is already discarded");
+
+    const size_t end_frame = state.end_frame(feature_size);
+    const size_t n_available = end_frame > frame ? std::min(end_frame - frame, nb_max_frames) : 0;
+
+    // not received frames are processed as silence
+    const float silence = log10(1e-10);
+    std::vector<float> window(feature_size * nb_max_frames, silence);
+
+    float mmax = n_available < nb_max_frames ? silence : -1e20f;
+    const float* frames = state.frames.data() + (frame - state.frames_offset) * feature_size;
+    for (size_t i = 0; i < n_available; i++) {
+        for (size_t j = 0; j < feature_size; j++) {
+            const float value = frames[i * feature_size + j];
+            window[j * nb_max_frames + i] = value;
+            mmax = std::max(mmax, value);
+        }
+    }
+
+    // clamping and normalization
+    mmax -= 8.0f;
+    for (auto& value : window) {
+        value = (std::max(value, mmax) + 4.0f) / 4.0f;
+    }
+
+    return window;
 }
 
 }  // namespace genai
@@ -4,9 +4,12 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "openvino/genai/visibility.hpp"
+#include "real_fft.hpp"
 
 namespace ov {
 namespace genai {
@@ -31,6 +34,28 @@ struct WhisperFeatures {
     std::vector<float> get_data_with_offset(const size_t frame_offset, const size_t min_frames);
 };
 
+/**
+ * @brief State of incremental log-mel extraction for audio which arrives in pieces.
+ * Frames are kept not normalized: Whisper normalization depends on the whole window passed to the encoder.
+ */
+struct WhisperStreamingFeatures {
+    // reflect padded audio, samples[0] is the first sample of frame `frames_offset`
+    std::vector<float> samples;
+    // audio received before the leading reflect padding could be built
+    std::vector<float> pending_samples;
+    bool padding_ready = false;
+    bool finished = false;
+
+    // flattened 2d array of log10 mel energies with shape [n_frames, feature_size]
+    std::vector<float> frames;
+    // index of frames[0] since the stream start
+    size_t frames_offset = 0;
+
+    size_t end_frame(const size_t feature_size) const {
+        return frames_offset + frames.size() / feature_size;
+    }
+};
+
 class WhisperFeatureExtractor {
 public:
     size_t feature_size = 80;
@@ -51,10 +76,31 @@ public:
      */
     WhisperFeatures extract(const std::vector<float>& raw_speech);
 
+    /**
+     * @brief Appends raw speech to the streaming state and computes all frames which became complete.
+     * Finishing pads the end of audio with zeros and computes the remaining frames.
+     */
+    void extract_incremental(WhisperStreamingFeatures& state, const std::vector<float>& raw_speech, bool finish = false);
+
+    /**
+     * @brief Drops frames and audio preceding `frame`
+     */
+    void discard_streaming_frames(WhisperStreamingFeatures& state, const size_t frame);
+
+    /**
+     * @brief Returns flattened normalized features [feature_size, nb_max_frames] of the window starting at `frame`.
+     * Frames which are not received yet are filled as silence.
+     */
+    std::vector<float> get_streaming_window(const WhisperStreamingFeatures& state, const size_t frame) const;
+
 private:
-    std::vector<float> sin_vals;
-    std::vector<float> cos_vals;
+    std::shared_ptr<const RealFFT> fft;
+    // periodic Hann window of n_fft samples
+    std::vector<float> hann;
+    // flattened 2d array with shape [feature_size, n_fft / 2 + 1]
     std::vector<float> mel_filter;
+    // [begin, end) range of non-zero weights for each mel filter row
+    std::vector<std::pair<size_t, size_t>> mel_filter_ranges;
 
     void init_mel_filter();
     void init_parameters(const std::filesystem::path& preprocessor_json_path);
@@ -0,0 +1,41 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper_models.hpp"
+
+namespace ov {
+namespace genai {
+
+WhisperKVCacheNames get_kv_cache_names(const ov::CompiledModel& decoder) {
+    // decoder outputs:
+    // present.0.decoder.key
+    // present.0.decoder.value
+    // present.0.encoder.key
+    // present.0.encoder.value
+
+    // decoder_with_past inputs:
+    // past_key_values.0.decoder.key
+    // past_key_values.0.decoder.value
+    // past_key_values.0.encoder.key
+    // past_key_values.0.encoder.value
+
+    const std::string present_prefix = "present";
+    WhisperKVCacheNames names;
+    for (auto& output : decoder.outputs()) {
+        const std::string output_name = output.get_any_name();
+        if (output_name.rfind(present_prefix, 0) != 0) {
+            continue;
+        }
+
+        std::string input_name = "past_key_values" + output_name.substr(present_prefix.size());
+        if (output_name.find(".encoder.") != std::string::npos) {
+            names.cross_attention.emplace_back(output_name, input_name);
+        } else {
+            names.self_attention.emplace_back(output_name, input_name);
+        }
+    }
+    return names;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -8,10 +8,30 @@
 namespace ov {
 namespace genai {
 
+/**
+ * Names of kv cache tensors which are passed from decoder outputs to decoder_with_past inputs.
+ * Computed once per compiled model to avoid name matching on every chunk.
+ */
+struct WhisperKVCacheNames {
+    // present.N.decoder.* outputs to past_key_values.N.decoder.* inputs
+    std::vector<std::pair<std::string, std::string>> self_attention;
+    // present.N.encoder.* outputs to past_key_values.N.encoder.* inputs
+    std::vector<std::pair<std::string, std::string>> cross_attention;
+};
+
 struct WhisperInitializedModels {
     ov::InferRequest encoder;
     ov::InferRequest decoder;
+    // not used if decoder is stateful
     ov::InferRequest decoder_with_past;
+
+    // Stateful decoder keeps self and cross attention kv cache in its states: the same request runs the first
+    // and all next decoding steps and rows of the batch are reordered with the beam_idx input.
+    bool is_stateful_decoder = false;
+    WhisperKVCacheNames kv_cache_names;
 };
+
+WhisperKVCacheNames get_kv_cache_names(const ov::CompiledModel& decoder);
+
 }  // namespace genai
 }  // namespace ov
@@ -22,7 +22,9 @@ namespace ov {
 namespace genai {
 namespace utils {
 
-void infer_with_perf_metrics(ov::InferRequest& request, ov::genai::RawPerfMetrics& raw_metrics) {
+void infer_with_perf_metrics(ov::InferRequest& request,
+                             ov::genai::RawPerfMetrics& raw_metrics,
+                             const size_t batch_size) {
     const auto infer_start = std::chrono::steady_clock::now();
     request.infer();
     const auto infer_end = std::chrono::steady_clock::now();
@@ -30,7 +32,21 @@ void infer_with_perf_metrics(ov::InferRequest& request, ov::genai::RawPerfMetric
     raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
     raw_metrics.m_token_infer_durations.emplace_back(infer_ms);
     raw_metrics.m_new_token_times.emplace_back(infer_end);
-    raw_metrics.m_batch_sizes.emplace_back(1);
+    raw_metrics.m_batch_sizes.emplace_back(batch_size);
+}
+
+void infer_with_perf_metrics(ov::InferRequest& request,
+                             const std::vector<ov::genai::RawPerfMetrics*>& rows_raw_metrics) {
+    const auto infer_start = std::chrono::steady_clock::now();
+    request.infer();
+    const auto infer_end = std::chrono::steady_clock::now();
+    const auto infer_ms = ov::genai::PerfMetrics::get_microsec(infer_end - infer_start);
+    for (ov::genai::RawPerfMetrics* raw_metrics : rows_raw_metrics) {
+        raw_metrics->m_inference_durations[0] += MicroSeconds(infer_ms);
+        raw_metrics->m_token_infer_durations.emplace_back(infer_ms);
+        raw_metrics->m_new_token_times.emplace_back(infer_end);
+        raw_metrics->m_batch_sizes.emplace_back(rows_raw_metrics.size());
+    }
 }
 
 void filter_non_segment_metrics(ov::genai::RawPerfMetrics& raw_metrics,
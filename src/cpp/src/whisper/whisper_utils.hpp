@@ -11,7 +11,13 @@ namespace ov {
 namespace genai {
 namespace utils {
 
-void infer_with_perf_metrics(ov::InferRequest& request, ov::genai::RawPerfMetrics& raw_metrics);
+void infer_with_perf_metrics(ov::InferRequest& request,
+                             ov::genai::RawPerfMetrics& raw_metrics,
+                             const size_t batch_size = 1);
+
+// Infers a batch and adds the inference to metrics of every row, as if each row was inferred alone
+void infer_with_perf_metrics(ov::InferRequest& request,
+                             const std::vector<ov::genai::RawPerfMetrics*>& rows_raw_metrics);
 
 void filter_non_segment_metrics(ov::genai::RawPerfMetrics& raw_metrics,
                                 size_t offset,
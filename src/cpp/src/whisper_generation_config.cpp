@@ -32,6 +32,8 @@ WhisperGenerationConfig::WhisperGenerationConfig(const std::filesystem::path& js
     read_json_param(data, "no_timestamps_token_id", no_timestamps_token_id);
     read_json_param(data, "max_initial_timestamp_index", max_initial_timestamp_index);
     read_json_param(data, "prev_sot_token_id", prev_sot_token_id);
+    read_json_param(data, "num_beams", num_beams);
+    read_json_param(data, "length_penalty", length_penalty);
 
     read_json_param(data, "is_multilingual", is_multilingual);
     if (is_multilingual) {
@@ -76,6 +78,19 @@ void WhisperGenerationConfig::update_generation_config(const ov::AnyMap& config_
     read_anymap_param(config_map, "return_timestamps", return_timestamps);
     read_anymap_param(config_map, "initial_prompt", initial_prompt);
     read_anymap_param(config_map, "hotwords", hotwords);
+    read_anymap_param(config_map, "num_beams", num_beams);
+    read_anymap_param(config_map, "length_penalty", length_penalty);
+    // python float lists are converted to std::vector<double>
+    auto temperatures_it = config_map.find("temperatures");
+    if (temperatures_it != config_map.end() && temperatures_it->second.is<std::vector<double>>()) {
+        const auto values = temperatures_it->second.as<std::vector<double>>();
+        temperatures.assign(values.begin(), values.end());
+    } else {
+        read_anymap_param(config_map, "temperatures", temperatures);
+    }
+    read_anymap_param(config_map, "compression_ratio_threshold", compression_ratio_threshold);
+    read_anymap_param(config_map, "logprob_threshold", logprob_threshold);
+    read_anymap_param(config_map, "rng_seed", rng_seed);
 }
 
 size_t WhisperGenerationConfig::get_max_new_tokens(size_t prompt_length) const {
@@ -98,6 +113,12 @@ void WhisperGenerationConfig::validate() const {
     OPENVINO_ASSERT(eos_token_id != -1 || max_new_tokens != SIZE_MAX || max_length != SIZE_MAX,
                     "Either 'eos_token_id', or 'max_new_tokens', or 'max_length' should be defined.");
 
+    OPENVINO_ASSERT(num_beams > 0, "'num_beams' must be greater than 0");
+    OPENVINO_ASSERT(!temperatures.empty(), "'temperatures' must contain at least one temperature");
+    for (float temperature : temperatures) {
+        OPENVINO_ASSERT(temperature >= 0.0f, "'temperatures' must be non-negative, got ", temperature);
+    }
+
     if (is_multilingual && language.has_value()) {
         OPENVINO_ASSERT(lang_to_id.count(*language),
                         "'language' " + *language + " must be provided in generation_config.json 'lang_to_id' map.");
@@ -10,6 +10,7 @@
 
 #include "utils.hpp"
 #include "whisper/context_tokens.hpp"
+#include "whisper/streaming_session.hpp"
 #include "whisper/streamer.hpp"
 #include "whisper/whisper.hpp"
 #include "whisper/whisper_config.hpp"
@@ -66,9 +67,24 @@ public:
             core.compile_model((models_path / "openvino_decoder_model.xml").string(), device, compile_properties);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper decoder model");
         m_models.decoder = compiled_model.create_infer_request();
-        compiled_model = core.compile_model(models_path / "openvino_decoder_with_past_model.xml", device, compile_properties);
-        m_models.decoder_with_past = compiled_model.create_infer_request();
-        ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper decoder with past model");
+
+        // stateful decoder export has no separate decoder with past model
+        const auto decoder_with_past_path = models_path / "openvino_decoder_with_past_model.xml";
+        if (std::filesystem::exists(decoder_with_past_path)) {
+            m_models.kv_cache_names = get_kv_cache_names(compiled_model);
+            compiled_model = core.compile_model(decoder_with_past_path, device, compile_properties);
+            m_models.decoder_with_past = compiled_model.create_infer_request();
+            ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper decoder with past model");
+        } else {
+            const auto decoder_inputs = compiled_model.inputs();
+            m_models.is_stateful_decoder =
+                std::any_of(decoder_inputs.begin(), decoder_inputs.end(), [](const ov::Output<const ov::Node>& input) {
+                    return input.get_names().count("beam_idx");
+                });
+            OPENVINO_ASSERT(m_models.is_stateful_decoder,
+                            "openvino_decoder_with_past_model.xml is not found and openvino_decoder_model.xml is not "
+                            "stateful");
+        }
 
         // If eos_token_id was not provided, take value
         if (m_generation_config.eos_token_id == -1) {
@@ -83,14 +99,7 @@ public:
         WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
         config.validate();
 
-        std::shared_ptr<ChunkStreamerBase> streamer_ptr;
-        if (auto streamer_obj = std::get_if<std::monostate>(&streamer)) {
-            streamer_ptr = nullptr;
-        } else if (auto streamer_obj = std::get_if<std::shared_ptr<ChunkStreamerBase>>(&streamer)) {
-            streamer_ptr = *streamer_obj;
-        } else if (auto callback = std::get_if<std::function<bool(std::string)>>(&streamer)) {
-            streamer_ptr = std::make_shared<ChunkTextCallbackStreamer>(m_tokenizer, *callback);
-        }
+        std::shared_ptr<ChunkStreamerBase> streamer_ptr = create_streamer(streamer);
 
         auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
 
@@ -135,6 +144,138 @@ public:
 
         return result;
     }
+
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                OptionalWhisperGenerationConfig generation_config) override {
+        auto start_time = std::chrono::steady_clock::now();
+        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+        config.validate();
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+
+        auto generate_results = ov::genai::whisper_generate(config,
+                                                            m_model_config,
+                                                            context_tokens,
+                                                            raw_speech_inputs,
+                                                            m_models,
+                                                            m_feature_extractor);
+
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(generate_results.size());
+
+        for (auto& generate_result : generate_results) {
+            auto decode_start_time = std::chrono::steady_clock::now();
+            WhisperDecodedResults result{std::vector{m_tokenizer.decode(generate_result.output_tokens)},
+                                         std::vector{1.f}};
+            result.perf_metrics = generate_result.perf_metrics;
+            result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+                PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+
+            if (generate_result.segments.has_value()) {
+                std::vector<WhisperDecodedResultChunk> chunks;
+                chunks.reserve((*generate_result.segments).size());
+
+                for (auto& segment : *generate_result.segments) {
+                    decode_start_time = std::chrono::steady_clock::now();
+                    chunks.push_back(WhisperDecodedResultChunk{segment.m_start,
+                                                               segment.m_end,
+                                                               m_tokenizer.decode(segment.m_tokens)});
+                    result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+                        PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+                }
+
+                result.chunks = chunks;
+            }
+
+            results.push_back(std::move(result));
+        }
+
+        auto stop_time = std::chrono::steady_clock::now();
+        for (auto& result : results) {
+            auto& metrics = result.perf_metrics;
+            metrics.load_time = this->m_load_time_ms;
+            metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
+            metrics.raw_metrics.tokenization_durations.emplace_back(tokenization_duration_microseconds);
+            metrics.evaluate_statistics(start_time);
+        }
+
+        return results;
+    }
+
+    void start_stream(OptionalWhisperGenerationConfig generation_config, ChunkStreamerVariant streamer) override {
+        m_stream_start_time = std::chrono::steady_clock::now();
+        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+        config.validate();
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+        m_stream_tokenization_duration = tokenization_duration_microseconds;
+
+        m_stream_session = std::make_unique<WhisperStreamingSession>(config,
+                                                                     m_model_config,
+                                                                     context_tokens,
+                                                                     m_models,
+                                                                     m_feature_extractor,
+                                                                     create_streamer(streamer));
+    }
+
+    void push_audio(const RawSpeechInput& audio_chunk) override {
+        OPENVINO_ASSERT(m_stream_session, "start_stream() has to be called before push_audio()");
+        m_stream_session->push_audio(audio_chunk);
+    }
+
+    WhisperDecodedResults finish_stream() override {
+        OPENVINO_ASSERT(m_stream_session, "start_stream() has to be called before finish_stream()");
+        auto generate_result = m_stream_session->finish();
+        m_stream_session.reset();
+
+        auto decode_start_time = std::chrono::steady_clock::now();
+        WhisperDecodedResults result{std::vector{m_tokenizer.decode(generate_result.output_tokens)}, std::vector{1.f}};
+        result.perf_metrics = generate_result.perf_metrics;
+        result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+            PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+
+        if (generate_result.segments.has_value()) {
+            std::vector<WhisperDecodedResultChunk> chunks;
+            chunks.reserve((*generate_result.segments).size());
+
+            for (auto& segment : *generate_result.segments) {
+                decode_start_time = std::chrono::steady_clock::now();
+                chunks.push_back(
+                    WhisperDecodedResultChunk{segment.m_start, segment.m_end, m_tokenizer.decode(segment.m_tokens)});
+                result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+                    PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+            }
+
+            result.chunks = chunks;
+        }
+
+        // generate duration covers the whole stream including time spent waiting for audio
+        auto& metrics = result.perf_metrics;
+        metrics.load_time = this->m_load_time_ms;
+        auto stop_time = std::chrono::steady_clock::now();
+        metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - m_stream_start_time));
+        metrics.raw_metrics.tokenization_durations.emplace_back(m_stream_tokenization_duration);
+        metrics.evaluate_statistics(m_stream_start_time);
+
+        return result;
+    }
+
+private:
+    std::unique_ptr<WhisperStreamingSession> m_stream_session;
+    std::chrono::steady_clock::time_point m_stream_start_time;
+    float m_stream_tokenization_duration = 0.0f;
+
+    std::shared_ptr<ChunkStreamerBase> create_streamer(ChunkStreamerVariant& streamer) {
+        std::shared_ptr<ChunkStreamerBase> streamer_ptr;
+        if (auto streamer_obj = std::get_if<std::monostate>(&streamer)) {
+            streamer_ptr = nullptr;
+        } else if (auto streamer_obj = std::get_if<std::shared_ptr<ChunkStreamerBase>>(&streamer)) {
+            streamer_ptr = *streamer_obj;
+        } else if (auto callback = std::get_if<std::function<bool(std::string)>>(&streamer)) {
+            streamer_ptr = std::make_shared<ChunkTextCallbackStreamer>(m_tokenizer, *callback);
+        }
+        return streamer_ptr;
+    }
 };
 
 std::pair<std::string, Any> streamer(ChunkStreamerVariant func) {
@@ -181,6 +322,35 @@ ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawS
     return m_impl->generate(raw_speech_input, config, get_chunk_streamer_from_map(config_map));
 }
 
+std::vector<ov::genai::WhisperDecodedResults> ov::genai::WhisperPipeline::generate(
+    const std::vector<RawSpeechInput>& raw_speech_inputs,
+    OptionalWhisperGenerationConfig generation_config) {
+    return m_impl->generate(raw_speech_inputs, generation_config);
+}
+
+std::vector<ov::genai::WhisperDecodedResults> ov::genai::WhisperPipeline::generate(
+    const std::vector<RawSpeechInput>& raw_speech_inputs,
+    const ov::AnyMap& config_map) {
+    auto config_arg = get_config_from_map(config_map);
+    WhisperGenerationConfig config = (config_arg.has_value()) ? *config_arg : get_generation_config();
+    config.update_generation_config(config_map);
+
+    return m_impl->generate(raw_speech_inputs, config);
+}
+
+void ov::genai::WhisperPipeline::start_stream(OptionalWhisperGenerationConfig generation_config,
+                                             ChunkStreamerVariant streamer) {
+    m_impl->start_stream(generation_config, streamer);
+}
+
+void ov::genai::WhisperPipeline::push_audio(const RawSpeechInput& audio_chunk) {
+    m_impl->push_audio(audio_chunk);
+}
+
+ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::finish_stream() {
+    return m_impl->finish_stream();
+}
+
 ov::genai::WhisperGenerationConfig ov::genai::WhisperPipeline::get_generation_config() const {
     return m_impl->m_generation_config;
 }
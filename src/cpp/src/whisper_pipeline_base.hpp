@@ -32,6 +32,23 @@ public:
                                            OptionalWhisperGenerationConfig generation_config,
                                            ChunkStreamerVariant streamer) = 0;
 
+    virtual std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                        OptionalWhisperGenerationConfig generation_config) {
+        OPENVINO_THROW("Batched generate is not supported by this WhisperPipeline implementation");
+    }
+
+    virtual void start_stream(OptionalWhisperGenerationConfig generation_config, ChunkStreamerVariant streamer) {
+        OPENVINO_THROW("Streaming transcription is not supported by this WhisperPipeline implementation");
+    }
+
+    virtual void push_audio(const RawSpeechInput& audio_chunk) {
+        OPENVINO_THROW("Streaming transcription is not supported by this WhisperPipeline implementation");
+    }
+
+    virtual WhisperDecodedResults finish_stream() {
+        OPENVINO_THROW("Streaming transcription is not supported by this WhisperPipeline implementation");
+    }
+
     virtual ~WhisperPipelineImplBase() = default;
 };
 
@@ -19,6 +19,8 @@ class WhisperPipeline::StaticWhisperPipeline : public WhisperPipeline::WhisperPi
 public:
     StaticWhisperPipeline(const std::filesystem::path& model_path, const ov::AnyMap& properties);
 
+    using WhisperPipelineImplBase::generate;
+
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input,
                                    OptionalWhisperGenerationConfig generation_config,
                                    ChunkStreamerVariant streamer) override;
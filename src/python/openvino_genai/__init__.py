@@ -23,11 +23,13 @@ from .py_openvino_genai import (
 
 from .py_openvino_genai import (
     VLMPipeline,
+    VisionEmbeddingCache,
 )
 
 # LLM pipeline
 from .py_openvino_genai import (
     LLMPipeline, 
+    ChatSnapshot,
     draft_model,
 )
 
@@ -72,8 +74,11 @@ from .py_openvino_genai import (
     InpaintingPipeline,
     Scheduler,
     ImageGenerationConfig,
+    ImageGenerationRequest,
+    PromptEmbeddingCache,
     Generator,
     CppStdGenerator,
+    PhiloxGenerator,
     TorchGenerator,
 )
 
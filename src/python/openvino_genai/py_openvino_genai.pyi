@@ -5,7 +5,7 @@ from __future__ import annotations
 import openvino._pyopenvino
 import os
 import typing
-__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'T5EncoderModel', 'Text2ImagePipeline', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model']
+__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatSnapshot', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationRequest', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PhiloxGenerator', 'PipelineMetrics', 'PromptEmbeddingCache', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'T5EncoderModel', 'Text2ImagePipeline', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -204,8 +204,12 @@ class AutoencoderKL:
         """
     def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
+    def decode_tiled(self, latent: openvino._pyopenvino.Tensor, tile_size: int, tile_overlap: int) -> openvino._pyopenvino.Tensor:
+        ...
     def encode(self, image: openvino._pyopenvino.Tensor, generator: Generator) -> openvino._pyopenvino.Tensor:
         ...
+    def encode_tiled(self, image: openvino._pyopenvino.Tensor, generator: Generator, tile_size: int, tile_overlap: int) -> openvino._pyopenvino.Tensor:
+        ...
     def get_config(self) -> AutoencoderKL.Config:
         ...
     def get_vae_scale_factor(self) -> int:
@@ -337,6 +341,25 @@ class CacheEvictionConfig:
         ...
     def get_start_size(self) -> int:
         ...
+class ChatSnapshot:
+    """
+    Snapshot of a chat of LLMPipeline: KV cache of the model and history of the chat
+    """
+    @staticmethod
+    def load(path: os.PathLike) -> ChatSnapshot:
+        """
+        Reads a snapshot saved by save(), KV cache is memory mapped
+        """
+    def __init__(self) -> None:
+        ...
+    def get_history(self) -> list[dict[str, str]]:
+        ...
+    def get_kv_cache_length(self) -> int:
+        ...
+    def save(self, path: os.PathLike) -> None:
+        """
+        Writes the snapshot into a file
+        """
 class ChunkStreamerBase:
     """
     
@@ -373,11 +396,17 @@ class ContinuousBatchingPipeline:
     def add_request(self, request_id: int, prompt: str, generation_config: GenerationConfig) -> GenerationHandle:
         ...
     @typing.overload
+    def add_request(self, request_id: int, prompt: str, images: list[openvino._pyopenvino.Tensor], generation_config: GenerationConfig) -> GenerationHandle:
+        ...
+    @typing.overload
     def generate(self, input_ids: list[openvino._pyopenvino.Tensor], generation_config: list[GenerationConfig], streamer: typing.Callable[[str], bool] | StreamerBase | None = None) -> list[EncodedGenerationResult]:
         ...
     @typing.overload
     def generate(self, prompts: list[str], generation_config: list[GenerationConfig], streamer: typing.Callable[[str], bool] | StreamerBase | None = None) -> list[GenerationResult]:
         ...
+    @typing.overload
+    def generate(self, prompts: list[str], images: list[list[openvino._pyopenvino.Tensor]], generation_config: list[GenerationConfig], streamer: typing.Callable[[str], bool] | StreamerBase | None = None) -> list[GenerationResult]:
+        ...
     def get_config(self) -> GenerationConfig:
         ...
     def get_metrics(self) -> PipelineMetrics:
@@ -821,7 +850,12 @@ class Image2ImagePipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            vae_tiling: bool - decode / encode images by overlapping tiles to bound VAE memory consumption,
+            vae_tile_size: int - size of VAE tile in image pixels,
+            vae_tile_overlap: int - overlap of neighboring VAE tiles in image pixels,
+            unet_cache_interval: int - UNet is inferred on every N-th denoising step, other steps reuse the last noise prediction,
+            guidance_end: float - fraction of denoising steps performed with classifier free guidance
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -840,6 +874,7 @@ class ImageGenerationConfig:
     """
     adapters: AdapterConfig | None
     generator: Generator
+    guidance_end: float
     guidance_scale: float
     height: int
     max_sequence_length: int
@@ -852,6 +887,10 @@ class ImageGenerationConfig:
     prompt_3: str | None
     rng_seed: int
     strength: float
+    unet_cache_interval: int
+    vae_tile_overlap: int
+    vae_tile_size: int
+    vae_tiling: bool
     width: int
     def __init__(self) -> None:
         ...
@@ -859,6 +898,18 @@ class ImageGenerationConfig:
         ...
     def validate(self) -> None:
         ...
+class ImageGenerationRequest:
+    """
+    Handle of an image generation request submitted by Text2ImagePipeline.generate_async().
+    """
+    def get(self) -> openvino._pyopenvino.Tensor:
+        """
+        Waits for the request to finish and returns ov.Tensor with resulting images. Raises an exception if the request failed.
+        """
+    def is_ready(self) -> bool:
+        """
+        Returns True if the request is finished, so get() returns without waiting.
+        """
 class InpaintingPipeline:
     """
     This class is used for generation with inpainting models.
@@ -922,7 +973,12 @@ class InpaintingPipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            vae_tiling: bool - decode / encode images by overlapping tiles to bound VAE memory consumption,
+            vae_tile_size: int - size of VAE tile in image pixels,
+            vae_tile_overlap: int - overlap of neighboring VAE tiles in image pixels,
+            unet_cache_interval: int - UNet is inferred on every N-th denoising step, other steps reuse the last noise prediction,
+            guidance_end: float - fraction of denoising steps performed with classifier free guidance
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -1088,10 +1144,20 @@ class LLMPipeline:
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
         """
+    def get_chat_snapshot(self) -> ChatSnapshot:
+        """
+                    Takes snapshot of the current chat: KV cache and history.
+                    If it's called right after start_chat(system_message), the system message is processed by the model,
+                    so the snapshot can seed new chats with the system message at no cost of its processing.
+        """
     def get_generation_config(self) -> GenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def restore_chat(self, snapshot: ChatSnapshot) -> None:
+        """
+        Starts chat from the snapshot, the current chat is finished.
+        """
     def set_generation_config(self, config: GenerationConfig) -> None:
         ...
     def start_chat(self, system_message: str = '') -> None:
@@ -1189,6 +1255,18 @@ class PerfMetrics:
     @property
     def raw_metrics(self) -> RawPerfMetrics:
         ...
+class PhiloxGenerator(Generator):
+    """
+    This class implements counter-based Philox4x32-10 pseudo-random generator, which generates tensors in parallel.
+    """
+    def __init__(self, seed: int) -> None:
+        ...
+    def next(self) -> float:
+        ...
+    def randn_tensor(self, shape: openvino._pyopenvino.Shape) -> openvino._pyopenvino.Tensor:
+        ...
+    def seed(self, new_seed: int) -> None:
+        ...
 class PipelineMetrics:
     """
     
@@ -1228,6 +1306,44 @@ class PipelineMetrics:
     @property
     def scheduled_requests(self) -> int:
         ...
+class PromptEmbeddingCache:
+    """
+    Process-wide LRU cache of text encoder outputs shared by all image generation pipelines.
+    """
+    class Statistics:
+        def __init__(self) -> None:
+            ...
+        @property
+        def capacity_bytes(self) -> int:
+            ...
+        @property
+        def evictions(self) -> int:
+            ...
+        @property
+        def hits(self) -> int:
+            ...
+        @property
+        def misses(self) -> int:
+            ...
+        @property
+        def num_entries(self) -> int:
+            ...
+        @property
+        def size_bytes(self) -> int:
+            ...
+    @staticmethod
+    def instance() -> PromptEmbeddingCache:
+        ...
+    def clear(self) -> None:
+        ...
+    def get_capacity(self) -> int:
+        ...
+    def get_statistics(self) -> PromptEmbeddingCache.Statistics:
+        ...
+    def set_capacity(self, capacity_bytes: int) -> None:
+        """
+        Sets cache budget in bytes and evicts least recently used entries exceeding it. 0 disables the cache.
+        """
 class RawPerfMetrics:
     """
     
@@ -1610,11 +1726,33 @@ class Text2ImagePipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            vae_tiling: bool - decode / encode images by overlapping tiles to bound VAE memory consumption,
+            vae_tile_size: int - size of VAE tile in image pixels,
+            vae_tile_overlap: int - overlap of neighboring VAE tiles in image pixels,
+            unet_cache_interval: int - UNet is inferred on every N-th denoising step, other steps reuse the last noise prediction,
+            guidance_end: float - fraction of denoising steps performed with classifier free guidance
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
         """
+    def generate_async(self, prompt: str, **kwargs) -> ImageGenerationRequest:
+        """
+            Submits an image generation request to the pipeline queue and returns immediately. Requests are processed by
+            a background thread, which denoises concurrent requests with the same resolution, guidance mode and current timestep
+            within a single UNet inference per step. Batched denoising is supported by Stable Diffusion, Latent Consistency Model
+            and Stable Diffusion XL pipelines which are not reshaped to static shapes, other pipelines process queued requests one by one.
+            LoRA adapters cannot be changed per request. Requests must not be mixed with concurrent 'generate()' calls.
+        
+            :param prompt: input prompt
+            :type prompt: str
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to generate params, see 'generate()'.
+            'callback' is called from the background thread.
+        
+            :return: a handle of the request
+            :rtype: ImageGenerationRequest
+        """
     def get_generation_config(self) -> ImageGenerationConfig:
         ...
     def reshape(self, num_images_per_prompt: int, height: int, width: int, guidance_scale: float) -> None:
@@ -1664,6 +1802,10 @@ class Tokenizer:
         """
         Encodes a single prompt into tokenized input.
         """
+    def encode_batches(self, prompts: list[str], batch_size: int, callback: typing.Callable[[int, TokenizedInputs], bool | None], add_special_tokens: bool = True) -> None:
+        """
+        Encodes a large list of prompts batch by batch and passes the batches with index of their first prompt to the callback in order. Return True from the callback to stop.
+        """
     def get_bos_token(self) -> str:
         ...
     def get_bos_token_id(self) -> int:
@@ -1882,12 +2024,68 @@ class VLMRawPerfMetrics:
     
         :param prepare_embeddings_durations: Durations of embeddings preparation.
         :type prepare_embeddings_durations: List[MicroSeconds]
+    
+        :param vision_embedding_cache_hits: Number of images which embeddings were taken from VisionEmbeddingCache.
+        :type vision_embedding_cache_hits: int
+    
+        :param vision_embedding_cache_misses: Number of images which were encoded by vision models.
+        :type vision_embedding_cache_misses: int
+    
+        :param vision_embedding_cache_size_bytes: Size of VisionEmbeddingCache in bytes after the last generate call.
+        :type vision_embedding_cache_size_bytes: int
     """
     def __init__(self) -> None:
         ...
     @property
     def prepare_embeddings_durations(self) -> list[float]:
         ...
+    @property
+    def vision_embedding_cache_hits(self) -> int:
+        ...
+    @property
+    def vision_embedding_cache_misses(self) -> int:
+        ...
+    @property
+    def vision_embedding_cache_size_bytes(self) -> int:
+        ...
+class VisionEmbeddingCache:
+    """
+    Process-wide LRU cache of image embeddings shared by all VLM pipelines.
+    """
+    class Statistics:
+        def __init__(self) -> None:
+            ...
+        @property
+        def capacity_bytes(self) -> int:
+            ...
+        @property
+        def evictions(self) -> int:
+            ...
+        @property
+        def hits(self) -> int:
+            ...
+        @property
+        def misses(self) -> int:
+            ...
+        @property
+        def num_entries(self) -> int:
+            ...
+        @property
+        def size_bytes(self) -> int:
+            ...
+    @staticmethod
+    def instance() -> VisionEmbeddingCache:
+        ...
+    def clear(self) -> None:
+        ...
+    def get_capacity(self) -> int:
+        ...
+    def get_statistics(self) -> VisionEmbeddingCache.Statistics:
+        ...
+    def set_capacity(self, capacity_bytes: int) -> None:
+        """
+        Sets cache budget in bytes and evicts least recently used entries exceeding it. 0 disables the cache.
+        """
 class WhisperDecodedResultChunk:
     """
     
@@ -2017,8 +2215,31 @@ class WhisperGenerationConfig:
           auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
           //  He has gone and gone for good answered Polychrome who...
         :type hotwords: Optional[str]
+        
+        :param num_beams: Number of beams decoded together as one batch. 1 means greedy decoding.
+        :type num_beams: int
+        
+        :param length_penalty: Exponential penalty to the length: sequences are ranked by sum of log probabilities / length^length_penalty.
+        :type length_penalty: float
+        
+        :param temperatures: Temperatures tried one after another while a decoded chunk fails `compression_ratio_threshold` or
+        `logprob_threshold`. Temperature 0 means beam search (or greedy) decoding, other temperatures sample `num_beams` candidates.
+        All non-zero temperatures are decoded as one batch which runs only if the result of temperature 0 fails the thresholds.
+        :type temperatures: list[float]
+        
+        :param compression_ratio_threshold: Repetition threshold: the number of tokens divided by the number of LZ77 phrases needed to encode them.
+        Ordinary text of a 30 seconds chunk stays below 1.2, a phrase repeated 3 times or more gives 1.5 and above, so 1.5 is a reasonable threshold.
+        Note that it isn't the gzip ratio of text bytes used by OpenAI Whisper, so OpenAI's threshold 2.4 misses most of the loops.
+        :type compression_ratio_threshold: Optional[float]
+        
+        :param logprob_threshold: Threshold of the average log probability of generated tokens.
+        :type logprob_threshold: Optional[float]
+        
+        :param rng_seed: Seed of the random generator used by temperature fallback.
+        :type rng_seed: int
     """
     begin_suppress_tokens: list[int]
+    compression_ratio_threshold: float | None
     decoder_start_token_id: int
     eos_token_id: int
     hotwords: str | None
@@ -2026,15 +2247,20 @@ class WhisperGenerationConfig:
     is_multilingual: bool
     lang_to_id: dict[str, int]
     language: str | None
+    length_penalty: float
+    logprob_threshold: float | None
     max_initial_timestamp_index: int
     max_length: int
     max_new_tokens: int
     no_timestamps_token_id: int
+    num_beams: int
     pad_token_id: int
     prev_sot_token_id: int
     return_timestamps: bool
+    rng_seed: int
     suppress_tokens: list[int]
     task: str | None
+    temperatures: list[float]
     transcribe_token_id: int
     translate_token_id: int
     @typing.overload
@@ -2077,6 +2303,11 @@ class WhisperPipeline:
                     models_path (os.PathLike): Path to the model file.
                     device (str): Device to run the model on (e.g., CPU, GPU).
         """
+    def finish_stream(self) -> WhisperDecodedResults:
+        """
+        Decodes the rest of the started stream and returns the whole transcription.
+        """
+    @typing.overload
     def generate(self, raw_speech_input: list[float], generation_config: WhisperGenerationConfig | None = None, streamer: typing.Callable[[str], bool] | ChunkStreamerBase | None = None, **kwargs) -> WhisperDecodedResults:
         """
             High level generate that receives raw speech as a vector of floats and returns decoded output.
@@ -2179,13 +2410,165 @@ class WhisperPipeline:
               auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
               //  He has gone and gone for good answered Polychrome who...
             :type hotwords: Optional[str]
+            
+            :param num_beams: Number of beams decoded together as one batch. 1 means greedy decoding.
+            :type num_beams: int
+            
+            :param length_penalty: Exponential penalty to the length: sequences are ranked by sum of log probabilities / length^length_penalty.
+            :type length_penalty: float
+            
+            :param temperatures: Temperatures tried one after another while a decoded chunk fails `compression_ratio_threshold` or
+            `logprob_threshold`. Temperature 0 means beam search (or greedy) decoding, other temperatures sample `num_beams` candidates.
+            All non-zero temperatures are decoded as one batch which runs only if the result of temperature 0 fails the thresholds.
+            :type temperatures: list[float]
+            
+            :param compression_ratio_threshold: Repetition threshold: the number of tokens divided by the number of LZ77 phrases needed to encode them.
+            Ordinary text of a 30 seconds chunk stays below 1.2, a phrase repeated 3 times or more gives 1.5 and above, so 1.5 is a reasonable threshold.
+            Note that it isn't the gzip ratio of text bytes used by OpenAI Whisper, so OpenAI's threshold 2.4 misses most of the loops.
+            :type compression_ratio_threshold: Optional[float]
+            
+            :param logprob_threshold: Threshold of the average log probability of generated tokens.
+            :type logprob_threshold: Optional[float]
+            
+            :param rng_seed: Seed of the random generator used by temperature fallback.
+            :type rng_seed: int
+        """
+    @typing.overload
+    def generate(self, raw_speech_inputs: list[list[float]], generation_config: WhisperGenerationConfig | None = None, **kwargs) -> list[WhisperDecodedResults]:
+        """
+            Batched generate that transcribes multiple raw speech inputs at once. Streaming is not supported.
+        
+            :param raw_speech_inputs: inputs in the form of list of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_inputs: List[List[float]]
+        
+            :param generation_config: generation_config shared by all inputs
+            :type generation_config: WhisperGenerationConfig or a Dict
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to WhisperGenerationConfig fields.
+            :type : Dict
+        
+            :return: decoded results, one per input
+            :rtype: List[WhisperDecodedResults]
+         
+         
+            WhisperGenerationConfig
+            :param max_length: the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
+                               `max_new_tokens`. Its effect is overridden by `max_new_tokens`, if also set.
+            :type max_length: int
+        
+            :param max_new_tokens: the maximum numbers of tokens to generate, excluding the number of tokens in the prompt. max_new_tokens has priority over max_length.
+            :type max_new_tokens: int
+        
+            :param eos_token_id: End of stream token id.
+            :type eos_token_id: int
+        
+            Whisper specific parameters:
+        
+            :param decoder_start_token_id: Corresponds to the ”<|startoftranscript|>” token.
+            :type decoder_start_token_id: int
+        
+            :param pad_token_id: Padding token id.
+            :type pad_token_id: int
+        
+            :param translate_token_id: Translate token id.
+            :type translate_token_id: int
+        
+            :param transcribe_token_id: Transcribe token id.
+            :type transcribe_token_id: int
+        
+            :param no_timestamps_token_id: No timestamps token id.
+            :type no_timestamps_token_id: int
+        
+            :param prev_sot_token_id: Corresponds to the ”<|startofprev|>” token.
+            :type prev_sot_token_id: int
+        
+            :param is_multilingual:
+            :type is_multilingual: bool
+        
+            :param begin_suppress_tokens: A list containing tokens that will be suppressed at the beginning of the sampling process.
+            :type begin_suppress_tokens: list[int]
+        
+            :param suppress_tokens: A list containing the non-speech tokens that will be suppressed during generation.
+            :type suppress_tokens: list[int]
+        
+            :param language: Language token to use for generation in the form of <|en|>.
+                             You can find all the possible language tokens in the generation_config.json lang_to_id dictionary.
+            :type language: Optional[str]
+        
+            :param lang_to_id: Language token to token_id map. Initialized from the generation_config.json lang_to_id dictionary.
+            :type lang_to_id: Dict[str, int]
+        
+            :param task: Task to use for generation, either “translate” or “transcribe”
+            :type task: int
+        
+            :param return_timestamps: If `true` the pipeline will return timestamps along the text for *segments* of words in the text.
+                               For instance, if you get
+                               WhisperDecodedResultChunk
+                                   start_ts = 0.5
+                                   end_ts = 1.5
+                                   text = " Hi there!"
+                               then it means the model predicts that the segment "Hi there!" was spoken after `0.5` and before `1.5` seconds.
+                               Note that a segment of text refers to a sequence of one or more words, rather than individual words.
+            :type return_timestamps: bool
+        
+            :param initial_prompt: Initial prompt tokens passed as a previous transcription (after `<|startofprev|>` token) to the first processing
+            window. Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::initial_prompt("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type initial_prompt: Optional[str]
+        
+            :param hotwords:  Hotwords tokens passed as a previous transcription (after `<|startofprev|>` token) to the all processing windows.
+            Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type hotwords: Optional[str]
+            
+            :param num_beams: Number of beams decoded together as one batch. 1 means greedy decoding.
+            :type num_beams: int
+            
+            :param length_penalty: Exponential penalty to the length: sequences are ranked by sum of log probabilities / length^length_penalty.
+            :type length_penalty: float
+            
+            :param temperatures: Temperatures tried one after another while a decoded chunk fails `compression_ratio_threshold` or
+            `logprob_threshold`. Temperature 0 means beam search (or greedy) decoding, other temperatures sample `num_beams` candidates.
+            All non-zero temperatures are decoded as one batch which runs only if the result of temperature 0 fails the thresholds.
+            :type temperatures: list[float]
+            
+            :param compression_ratio_threshold: Repetition threshold: the number of tokens divided by the number of LZ77 phrases needed to encode them.
+            Ordinary text of a 30 seconds chunk stays below 1.2, a phrase repeated 3 times or more gives 1.5 and above, so 1.5 is a reasonable threshold.
+            Note that it isn't the gzip ratio of text bytes used by OpenAI Whisper, so OpenAI's threshold 2.4 misses most of the loops.
+            :type compression_ratio_threshold: Optional[float]
+            
+            :param logprob_threshold: Threshold of the average log probability of generated tokens.
+            :type logprob_threshold: Optional[float]
+            
+            :param rng_seed: Seed of the random generator used by temperature fallback.
+            :type rng_seed: int
         """
     def get_generation_config(self) -> WhisperGenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def push_audio(self, audio_chunk: list[float]) -> None:
+        """
+        Appends raw speech to the started stream. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+        """
     def set_generation_config(self, config: WhisperGenerationConfig) -> None:
         ...
+    def start_stream(self, generation_config: WhisperGenerationConfig | None = None, streamer: typing.Callable[[str], bool] | ChunkStreamerBase | None = None, **kwargs) -> None:
+        """
+        Starts transcription of audio which arrives in pieces. Confirmed text is sent to the streamer while audio is pushed.
+        """
 class WhisperRawPerfMetrics:
     """
     
@@ -493,7 +493,9 @@ void init_autoencoder_kl(py::module_& m) {
                 kwargs: Device properties.
             )")
         .def("decode", &ov::genai::AutoencoderKL::decode, py::arg("latent"))
+        .def("decode_tiled", &ov::genai::AutoencoderKL::decode_tiled, py::arg("latent"), py::arg("tile_size"), py::arg("tile_overlap"))
         .def("encode", &ov::genai::AutoencoderKL::encode, py::arg("image"), py::arg("generator"))
+        .def("encode_tiled", &ov::genai::AutoencoderKL::encode_tiled, py::arg("image"), py::arg("generator"), py::arg("tile_size"), py::arg("tile_overlap"))
         .def("get_config", &ov::genai::AutoencoderKL::get_config)
         .def("get_vae_scale_factor", &ov::genai::AutoencoderKL::get_vae_scale_factor);
 }
@@ -1,7 +1,9 @@
 // Copyright (C) 2023-2024 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <chrono>
 #include <filesystem>
+#include <future>
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -13,6 +15,7 @@
 #include "openvino/genai/image_generation/text2image_pipeline.hpp"
 #include "openvino/genai/image_generation/image2image_pipeline.hpp"
 #include "openvino/genai/image_generation/inpainting_pipeline.hpp"
+#include "openvino/genai/image_generation/prompt_embedding_cache.hpp"
 
 #include "tokenizers_path.hpp"
 #include "py_utils.hpp"
@@ -48,12 +51,68 @@ auto text2image_generate_docstring = R"(
     generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
     adapters: LoRA adapters,
     strength: strength for image to image generation. 1.0f means initial image is fully noised,
-    max_sequence_length: int - length of t5_encoder_model input
+    max_sequence_length: int - length of t5_encoder_model input,
+    vae_tiling: bool - decode / encode images by overlapping tiles to bound VAE memory consumption,
+    vae_tile_size: int - size of VAE tile in image pixels,
+    vae_tile_overlap: int - overlap of neighboring VAE tiles in image pixels,
+    unet_cache_interval: int - UNet is inferred on every N-th denoising step, other steps reuse the last noise prediction,
+    guidance_end: float - fraction of denoising steps performed with classifier free guidance
 
     :return: ov.Tensor with resulting images
     :rtype: ov.Tensor
 )";
 
+auto text2image_generate_async_docstring = R"(
+    Submits an image generation request to the pipeline queue and returns immediately. Requests are processed by
+    a background thread, which denoises concurrent requests with the same resolution, guidance mode and current timestep
+    within a single UNet inference per step. Batched denoising is supported by Stable Diffusion, Latent Consistency Model
+    and Stable Diffusion XL pipelines which are not reshaped to static shapes, other pipelines process queued requests one by one.
+    LoRA adapters cannot be changed per request. Requests must not be mixed with concurrent 'generate()' calls.
+
+    :param prompt: input prompt
+    :type prompt: str
+
+    :param kwargs: arbitrary keyword arguments with keys corresponding to generate params, see 'generate()'.
+    'callback' is called from the background thread.
+
+    :return: a handle of the request
+    :rtype: ImageGenerationRequest
+)";
+
+// Python handle of a request submitted by 'Text2ImagePipeline::generate_async()'
+class ImageGenerationRequest {
+public:
+    explicit ImageGenerationRequest(std::future<ov::Tensor> result)
+        : m_result(result.share()) {
+    }
+
+    bool is_ready() const {
+        return m_result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    ov::Tensor get() const {
+        // background thread needs GIL to call Python callback or generator of the request
+        py::gil_scoped_release release;
+        return m_result.get();
+    }
+
+private:
+    std::shared_future<ov::Tensor> m_result;
+};
+
+// Text2ImagePipeline destructor waits for 'generate_async()' requests, which may call Python code from the background thread
+struct Text2ImagePipelineDeleter {
+    Text2ImagePipelineDeleter() = default;
+
+    // allows constructors to return std::make_unique<Text2ImagePipeline>
+    Text2ImagePipelineDeleter(std::default_delete<ov::genai::Text2ImagePipeline>) {}
+
+    void operator()(ov::genai::Text2ImagePipeline* pipe) const {
+        py::gil_scoped_release release;
+        delete pipe;
+    }
+};
+
 // Trampoline class to support inheritance from Generator in Python
 class PyGenerator : public ov::genai::Generator {
 public:
@@ -173,6 +232,14 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("randn_tensor", &ov::genai::CppStdGenerator::randn_tensor, py::arg("shape"))
         .def("seed", &ov::genai::CppStdGenerator::seed, py::arg("new_seed"));
 
+    py::class_<ov::genai::PhiloxGenerator, ov::genai::Generator, std::shared_ptr<ov::genai::PhiloxGenerator>>(m, "PhiloxGenerator", "This class implements counter-based Philox4x32-10 pseudo-random generator, which generates tensors in parallel.")
+        .def(py::init([](uint64_t seed) {
+            return std::make_unique<ov::genai::PhiloxGenerator>(seed);
+        }), py::arg("seed"))
+        .def("next", &ov::genai::PhiloxGenerator::next)
+        .def("randn_tensor", &ov::genai::PhiloxGenerator::randn_tensor, py::arg("shape"))
+        .def("seed", &ov::genai::PhiloxGenerator::seed, py::arg("new_seed"));
+
     py::class_<::TorchGenerator, ov::genai::CppStdGenerator, std::shared_ptr<::TorchGenerator>>(m, "TorchGenerator", "This class provides OpenVINO GenAI Generator wrapper for torch.Generator")
         .def(py::init([](uint32_t seed) {
             return std::make_unique<::TorchGenerator>(seed);
@@ -222,6 +289,11 @@ void init_image_generation_pipelines(py::module_& m) {
         .def_readwrite("adapters", &ov::genai::ImageGenerationConfig::adapters)
         .def_readwrite("strength", &ov::genai::ImageGenerationConfig::strength)
         .def_readwrite("max_sequence_length", &ov::genai::ImageGenerationConfig::max_sequence_length)
+        .def_readwrite("vae_tiling", &ov::genai::ImageGenerationConfig::vae_tiling)
+        .def_readwrite("vae_tile_size", &ov::genai::ImageGenerationConfig::vae_tile_size)
+        .def_readwrite("vae_tile_overlap", &ov::genai::ImageGenerationConfig::vae_tile_overlap)
+        .def_readwrite("unet_cache_interval", &ov::genai::ImageGenerationConfig::unet_cache_interval)
+        .def_readwrite("guidance_end", &ov::genai::ImageGenerationConfig::guidance_end)
         .def("validate", &ov::genai::ImageGenerationConfig::validate)
         .def("update_generation_config", [](
             ov::genai::ImageGenerationConfig& config,
@@ -229,7 +301,30 @@ void init_image_generation_pipelines(py::module_& m) {
             config.update_generation_config(pyutils::kwargs_to_any_map(kwargs));
         });
 
-    auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
+    auto prompt_embedding_cache = py::class_<ov::genai::PromptEmbeddingCache, std::unique_ptr<ov::genai::PromptEmbeddingCache, py::nodelete>>(m, "PromptEmbeddingCache",
+        "Process-wide LRU cache of text encoder outputs shared by all image generation pipelines.");
+    py::class_<ov::genai::PromptEmbeddingCache::Statistics>(prompt_embedding_cache, "Statistics")
+        .def(py::init<>())
+        .def_readonly("hits", &ov::genai::PromptEmbeddingCache::Statistics::hits)
+        .def_readonly("misses", &ov::genai::PromptEmbeddingCache::Statistics::misses)
+        .def_readonly("evictions", &ov::genai::PromptEmbeddingCache::Statistics::evictions)
+        .def_readonly("num_entries", &ov::genai::PromptEmbeddingCache::Statistics::num_entries)
+        .def_readonly("size_bytes", &ov::genai::PromptEmbeddingCache::Statistics::size_bytes)
+        .def_readonly("capacity_bytes", &ov::genai::PromptEmbeddingCache::Statistics::capacity_bytes);
+    prompt_embedding_cache
+        .def_static("instance", &ov::genai::PromptEmbeddingCache::instance, py::return_value_policy::reference)
+        .def("set_capacity", &ov::genai::PromptEmbeddingCache::set_capacity, py::arg("capacity_bytes"),
+            "Sets cache budget in bytes and evicts least recently used entries exceeding it. 0 disables the cache.")
+        .def("get_capacity", &ov::genai::PromptEmbeddingCache::get_capacity)
+        .def("get_statistics", &ov::genai::PromptEmbeddingCache::get_statistics)
+        .def("clear", &ov::genai::PromptEmbeddingCache::clear);
+
+    py::class_<ImageGenerationRequest>(m, "ImageGenerationRequest", "Handle of an image generation request submitted by Text2ImagePipeline.generate_async().")
+        .def("is_ready", &ImageGenerationRequest::is_ready, "Returns True if the request is finished, so get() returns without waiting.")
+        .def("get", &ImageGenerationRequest::get,
+            "Waits for the request to finish and returns ov.Tensor with resulting images. Raises an exception if the request failed.");
+
+    auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline, std::unique_ptr<ov::genai::Text2ImagePipeline, Text2ImagePipelineDeleter>>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
         .def(py::init([](const std::filesystem::path& models_path) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
             return std::make_unique<ov::genai::Text2ImagePipeline>(models_path);
@@ -294,6 +389,17 @@ void init_image_generation_pipelines(py::module_& m) {
             },
             py::arg("prompt"), "Input string",
             (text2image_generate_docstring + std::string(" \n ")).c_str())
+        .def(
+            "generate_async",
+            [](ov::genai::Text2ImagePipeline& pipe,
+                const std::string& prompt,
+                const py::kwargs& kwargs
+            ) {
+                ov::AnyMap params = pyutils::kwargs_to_any_map(kwargs);
+                return ImageGenerationRequest(pipe.generate_async(prompt, params));
+            },
+            py::arg("prompt"), "Input string",
+            text2image_generate_async_docstring)
         .def("decode", &ov::genai::Text2ImagePipeline::decode, py::arg("latent"));
 
 
@@ -18,6 +18,7 @@ namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::OptionalGenerationConfig;
 using ov::genai::LLMPipeline;
+using ov::genai::ChatSnapshot;
 using ov::genai::TokenizedInputs;
 using ov::genai::EncodedInputs;
 using ov::genai::StreamerVariant;
@@ -90,6 +91,13 @@ py::object call_common_generate(
 extern char generation_config_docstring[];
 
 void init_llm_pipeline(py::module_& m) {
+    py::class_<ChatSnapshot>(m, "ChatSnapshot", "Snapshot of a chat of LLMPipeline: KV cache of the model and history of the chat")
+        .def(py::init<>())
+        .def("save", &ChatSnapshot::save, py::arg("path"), "Writes the snapshot into a file")
+        .def_static("load", &ChatSnapshot::load, py::arg("path"), "Reads a snapshot saved by save(), KV cache is memory mapped")
+        .def("get_history", &ChatSnapshot::get_history)
+        .def("get_kv_cache_length", &ChatSnapshot::get_kv_cache_length);
+
     py::class_<LLMPipeline>(m, "LLMPipeline", "This class is used for generation with LLMs")
         // init(model_path, tokenizer, device, config, kwargs) should be defined before init(model_path, device, config, kwargs) 
         // to prevent tokenizer treated as kwargs argument
@@ -187,6 +195,12 @@ void init_llm_pipeline(py::module_& m) {
         .def("get_tokenizer", &LLMPipeline::get_tokenizer)
         .def("start_chat", &LLMPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &LLMPipeline::finish_chat)
+        .def("get_chat_snapshot", &LLMPipeline::get_chat_snapshot, R"(
+            Takes snapshot of the current chat: KV cache and history.
+            If it's called right after start_chat(system_message), the system message is processed by the model,
+            so the snapshot can seed new chats with the system message at no cost of its processing.
+        )")
+        .def("restore_chat", &LLMPipeline::restore_chat, py::arg("snapshot"), "Starts chat from the snapshot, the current chat is finished.")
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"));
 
@@ -61,6 +61,17 @@ void init_tokenizer(py::module_& m) {
             py::arg("prompt"), py::arg("add_special_tokens") = true,
             R"(Encodes a single prompt into tokenized input.)")
 
+        .def("encode_batches", [](Tokenizer& tok, const std::vector<std::string>& prompts, size_t batch_size, const py::function& callback, bool add_special_tokens) {
+                ov::AnyMap tokenization_params;
+                tokenization_params[ov::genai::add_special_tokens.name()] = add_special_tokens;
+                tok.encode_batches(prompts, batch_size, [&callback](size_t first_prompt, ov::genai::TokenizedInputs batch) {
+                    py::object stop = callback(first_prompt, batch);
+                    return !stop.is_none() && stop.cast<bool>();
+                }, tokenization_params);
+            },
+            py::arg("prompts"), py::arg("batch_size"), py::arg("callback"), py::arg("add_special_tokens") = true,
+            R"(Encodes a large list of prompts batch by batch and passes the batches with index of their first prompt to the callback in order. Return True from the callback to stop.)")
+
         .def(
             "decode",
             [](Tokenizer& tok, std::vector<int64_t>& tokens, bool skip_special_tokens) -> py::str {
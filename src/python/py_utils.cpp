@@ -82,7 +82,10 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
         "max_initial_timestamp_index",
         "num_images_per_prompt",
         "num_inference_steps",
-        "max_sequence_length"
+        "max_sequence_length",
+        "vae_tile_size",
+        "vae_tile_overlap",
+        "unet_cache_interval"
     };
     // These properties should be casted to ov::AnyMap, instead of std::map. 
     std::set<std::string> any_map_properties = {
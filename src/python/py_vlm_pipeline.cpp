@@ -12,6 +12,7 @@
 
 #include "openvino/genai/visual_language/pipeline.hpp"
 #include "openvino/genai/visual_language/perf_metrics.hpp"
+#include "openvino/genai/visual_language/vision_embedding_cache.hpp"
 #include "tokenizers_path.hpp"
 #include "py_utils.hpp"
 
@@ -64,6 +65,15 @@ auto raw_perf_metrics_docstring = R"(
 
     :param prepare_embeddings_durations: Durations of embeddings preparation.
     :type prepare_embeddings_durations: List[MicroSeconds]
+
+    :param vision_embedding_cache_hits: Number of images which embeddings were taken from VisionEmbeddingCache.
+    :type vision_embedding_cache_hits: int
+
+    :param vision_embedding_cache_misses: Number of images which were encoded by vision models.
+    :type vision_embedding_cache_misses: int
+
+    :param vision_embedding_cache_size_bytes: Size of VisionEmbeddingCache in bytes after the last generate call.
+    :type vision_embedding_cache_size_bytes: int
 )";
 
 auto perf_metrics_docstring = R"(
@@ -105,7 +115,28 @@ void init_vlm_pipeline(py::module_& m) {
         .def(py::init<>())
         .def_property_readonly("prepare_embeddings_durations", [](const ov::genai::VLMRawPerfMetrics& rw) {
             return pyutils::get_ms(rw, &ov::genai::VLMRawPerfMetrics::prepare_embeddings_durations);
-        });
+        })
+        .def_readonly("vision_embedding_cache_hits", &ov::genai::VLMRawPerfMetrics::vision_embedding_cache_hits)
+        .def_readonly("vision_embedding_cache_misses", &ov::genai::VLMRawPerfMetrics::vision_embedding_cache_misses)
+        .def_readonly("vision_embedding_cache_size_bytes", &ov::genai::VLMRawPerfMetrics::vision_embedding_cache_size_bytes);
+
+    auto vision_embedding_cache = py::class_<ov::genai::VisionEmbeddingCache, std::unique_ptr<ov::genai::VisionEmbeddingCache, py::nodelete>>(m, "VisionEmbeddingCache",
+        "Process-wide LRU cache of image embeddings shared by all VLM pipelines.");
+    py::class_<ov::genai::VisionEmbeddingCache::Statistics>(vision_embedding_cache, "Statistics")
+        .def(py::init<>())
+        .def_readonly("hits", &ov::genai::VisionEmbeddingCache::Statistics::hits)
+        .def_readonly("misses", &ov::genai::VisionEmbeddingCache::Statistics::misses)
+        .def_readonly("evictions", &ov::genai::VisionEmbeddingCache::Statistics::evictions)
+        .def_readonly("num_entries", &ov::genai::VisionEmbeddingCache::Statistics::num_entries)
+        .def_readonly("size_bytes", &ov::genai::VisionEmbeddingCache::Statistics::size_bytes)
+        .def_readonly("capacity_bytes", &ov::genai::VisionEmbeddingCache::Statistics::capacity_bytes);
+    vision_embedding_cache
+        .def_static("instance", &ov::genai::VisionEmbeddingCache::instance, py::return_value_policy::reference)
+        .def("set_capacity", &ov::genai::VisionEmbeddingCache::set_capacity, py::arg("capacity_bytes"),
+            "Sets cache budget in bytes and evicts least recently used entries exceeding it. 0 disables the cache.")
+        .def("get_capacity", &ov::genai::VisionEmbeddingCache::get_capacity)
+        .def("get_statistics", &ov::genai::VisionEmbeddingCache::get_statistics)
+        .def("clear", &ov::genai::VisionEmbeddingCache::clear);
 
     py::class_<ov::genai::VLMPerfMetrics, ov::genai::PerfMetrics>(m, "VLMPerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
@@ -36,6 +36,22 @@ namespace pyutils = ov::genai::pybind::utils;
 
 namespace {
 
+auto whisper_batch_generate_docstring = R"(
+    Batched generate that transcribes multiple raw speech inputs at once. Streaming is not supported.
+
+    :param raw_speech_inputs: inputs in the form of list of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+    :type raw_speech_inputs: List[List[float]]
+
+    :param generation_config: generation_config shared by all inputs
+    :type generation_config: WhisperGenerationConfig or a Dict
+
+    :param kwargs: arbitrary keyword arguments with keys corresponding to WhisperGenerationConfig fields.
+    :type : Dict
+
+    :return: decoded results, one per input
+    :rtype: List[WhisperDecodedResults]
+)";
+
 auto whisper_generate_docstring = R"(
     High level generate that receives raw speech as a vector of floats and returns decoded output.
 
@@ -156,6 +172,28 @@ auto whisper_generation_config_docstring = R"(
       auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
       //  He has gone and gone for good answered Polychrome who...
     :type hotwords: Optional[str]
+
+    :param num_beams: Number of beams decoded together as one batch. 1 means greedy decoding.
+    :type num_beams: int
+
+    :param length_penalty: Exponential penalty to the length: sequences are ranked by sum of log probabilities / length^length_penalty.
+    :type length_penalty: float
+
+    :param temperatures: Temperatures tried one after another while a decoded chunk fails `compression_ratio_threshold` or
+    `logprob_threshold`. Temperature 0 means beam search (or greedy) decoding, other temperatures sample `num_beams` candidates.
+    All non-zero temperatures are decoded as one batch which runs only if the result of temperature 0 fails the thresholds.
+    :type temperatures: list[float]
+
+    :param compression_ratio_threshold: Repetition threshold: the number of tokens divided by the number of LZ77 phrases needed to encode them.
+    Ordinary text of a 30 seconds chunk stays below 1.2, a phrase repeated 3 times or more gives 1.5 and above, so 1.5 is a reasonable threshold.
+    Note that it isn't the gzip ratio of text bytes used by OpenAI Whisper, so OpenAI's threshold 2.4 misses most of the loops.
+    :type compression_ratio_threshold: Optional[float]
+
+    :param logprob_threshold: Threshold of the average log probability of generated tokens.
+    :type logprob_threshold: Optional[float]
+
+    :param rng_seed: Seed of the random generator used by temperature fallback.
+    :type rng_seed: int
 )";
 
 auto streamer_base_docstring = R"(
@@ -298,6 +336,12 @@ void init_whisper_pipeline(py::module_& m) {
         .def_readwrite("return_timestamps", &WhisperGenerationConfig::return_timestamps)
         .def_readwrite("initial_prompt", &WhisperGenerationConfig::initial_prompt)
         .def_readwrite("hotwords", &WhisperGenerationConfig::hotwords)
+        .def_readwrite("num_beams", &WhisperGenerationConfig::num_beams)
+        .def_readwrite("length_penalty", &WhisperGenerationConfig::length_penalty)
+        .def_readwrite("temperatures", &WhisperGenerationConfig::temperatures)
+        .def_readwrite("compression_ratio_threshold", &WhisperGenerationConfig::compression_ratio_threshold)
+        .def_readwrite("logprob_threshold", &WhisperGenerationConfig::logprob_threshold)
+        .def_readwrite("rng_seed", &WhisperGenerationConfig::rng_seed)
         .def("set_eos_token_id", &WhisperGenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"))
         .def("update_generation_config", [](
             ov::genai::WhisperGenerationConfig& config,
@@ -381,6 +425,48 @@ void init_whisper_pipeline(py::module_& m) {
             "streamer",
             (whisper_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
 
+        .def(
+            "generate",
+            [](WhisperPipeline& pipe,
+               const std::vector<RawSpeechInput>& raw_speech_inputs,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const py::kwargs& kwargs) -> py::typing::List<ov::genai::WhisperDecodedResults> {
+                OptionalWhisperGenerationConfig base_config =
+                    generation_config.has_value() ? generation_config : pipe.get_generation_config();
+                auto updated_config = update_whisper_config_from_kwargs(base_config, kwargs);
+                return py::cast(pipe.generate(raw_speech_inputs, updated_config));
+            },
+            py::arg("raw_speech_inputs"),
+            "List of raw speech audios, each is a list of floats. "
+            "Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.",
+            py::arg("generation_config") = std::nullopt,
+            "generation_config",
+            (whisper_batch_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
+
+        .def(
+            "start_stream",
+            [](WhisperPipeline& pipe,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const PyBindChunkStreamerVariant& streamer,
+               const py::kwargs& kwargs) {
+                OptionalWhisperGenerationConfig base_config =
+                    generation_config.has_value() ? generation_config : pipe.get_generation_config();
+                auto updated_config = update_whisper_config_from_kwargs(base_config, kwargs);
+                pipe.start_stream(updated_config, pystreamer_to_chunk_streamer(streamer));
+            },
+            py::arg("generation_config") = std::nullopt,
+            "generation_config",
+            py::arg("streamer") = std::monostate(),
+            "streamer",
+            "Starts transcription of audio which arrives in pieces. Confirmed text is sent to the streamer while audio is pushed.")
+        .def("push_audio",
+             &WhisperPipeline::push_audio,
+             py::arg("audio_chunk"),
+             "Appends raw speech to the started stream. Required to be normalized to near [-1, 1] range and have 16k Hz "
+             "sampling rate.")
+        .def("finish_stream",
+             &WhisperPipeline::finish_stream,
+             "Decodes the rest of the started stream and returns the whole transcription.")
         .def("get_tokenizer", &WhisperPipeline::get_tokenizer)
         .def("get_generation_config", &WhisperPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &WhisperPipeline::set_generation_config, py::arg("config"));
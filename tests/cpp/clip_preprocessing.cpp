@@ -0,0 +1,112 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "visual_language/clip.hpp"
+
+namespace {
+
+clip_image_u8 make_image(int width, int height) {
+    clip_image_u8 image{width, height, std::vector<uint8_t>(3 * width * height)};
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    for (uint8_t& value : image.buf) {
+        value = static_cast<uint8_t>(distribution(generator));
+    }
+    return image;
+}
+
+// per pixel bicubic interpolation, which is used as a reference for separable implementation
+clip_image_u8 reference_bicubic_resize(const clip_image_u8& img, int target_width, int target_height) {
+    clip_image_u8 dst{target_width, target_height, std::vector<uint8_t>(3 * target_width * target_height)};
+    auto pixel = [&img](int y, int x, int c) -> float {
+        y = std::max(0, std::min(y, img.ny - 1));
+        x = std::max(0, std::min(x, img.nx - 1));
+        return img.buf[(y * img.nx + x) * 3 + c];
+    };
+    auto cubic = [](float p_1, float p0, float p1, float p2, float d) {
+        float d0 = p_1 - p0, d2 = p1 - p0, d3 = p2 - p0;
+        float a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
+        float a2 = 1.0 / 2 * d0 + 1.0 / 2 * d2;
+        float a3 = -1.0 / 6 * d0 - 1.0 / 2 * d2 + 1.0 / 6 * d3;
+        return p0 + a1 * d + a2 * d * d + a3 * d * d * d;
+    };
+
+    const float tx = (float)img.nx / target_width, ty = (float)img.ny / target_height;
+    for (int i = 0; i < target_height; i++) {
+        for (int j = 0; j < target_width; j++) {
+            int x = (int)(tx * j), y = (int)(ty * i);
+            float dx = tx * j - x, dy = ty * i - y;
+            for (int k = 0; k < 3; k++) {
+                float C[4];
+                for (int jj = 0; jj < 4; jj++) {
+                    int row = y - 1 + jj;
+                    C[jj] = cubic(pixel(row, x - 1, k), pixel(row, x, k), pixel(row, x + 1, k), pixel(row, x + 2, k), dx);
+                }
+                float Cc = cubic(C[0], C[1], C[2], C[3], dy);
+                dst.buf[(i * target_width + j) * 3 + k] = std::min(std::max(std::round(Cc), 0.0f), 255.0f);
+            }
+        }
+    }
+    return dst;
+}
+
+} // namespace
+
+TEST(ClipPreprocessingTest, BicubicResizeMatchesReference) {
+    const clip_image_u8 image = make_image(97, 61);
+
+    for (auto [width, height] : {std::pair<int, int>{48, 32}, {224, 224}, {97, 61}}) {
+        clip_image_u8 resized;
+        bicubic_resize(image, resized, width, height);
+        const clip_image_u8 reference = reference_bicubic_resize(image, width, height);
+
+        ASSERT_EQ(resized.nx, width);
+        ASSERT_EQ(resized.ny, height);
+        for (size_t i = 0; i < reference.buf.size(); ++i) {
+            // weights are precomputed, so rounding may differ in rare cases
+            ASSERT_LE(std::abs(int(resized.buf[i]) - int(reference.buf[i])), 1) << "at index " << i;
+        }
+    }
+}
+
+TEST(ClipPreprocessingTest, FusedResizeNormalizeMatchesSeparateSteps) {
+    const clip_image_u8 image = make_image(120, 80);
+    clip_ctx ctx;
+    ctx.image_mean[0] = 0.48145466f; ctx.image_mean[1] = 0.4578275f; ctx.image_mean[2] = 0.40821073f;
+    ctx.image_std[0] = 0.26862954f; ctx.image_std[1] = 0.26130258f; ctx.image_std[2] = 0.27577711f;
+
+    const int width = 64, height = 48, crop_x = 8, crop_y = 4, crop_width = 32, crop_height = 40;
+
+    clip_image_u8 resized;
+    bicubic_resize(image, resized, width, height);
+    clip_image_u8 cropped{crop_width, crop_height, std::vector<uint8_t>(3 * crop_width * crop_height)};
+    for (int y = 0; y < crop_height; ++y) {
+        std::copy_n(resized.buf.data() + ((crop_y + y) * width + crop_x) * 3, crop_width * 3, cropped.buf.data() + y * crop_width * 3);
+    }
+    const clip_image_f32 expected = clip_image_preprocess(ctx, cropped);
+
+    const clip_image_f32 fused = bicubic_resize_normalize(ctx, image, width, height, crop_x, crop_y, crop_width, crop_height);
+    ASSERT_EQ(fused.nx, crop_width);
+    ASSERT_EQ(fused.ny, crop_height);
+    EXPECT_EQ(fused.buf, expected.buf);
+}
+
+TEST(ClipPreprocessingTest, PreprocessNormalizesToPlanarLayout) {
+    clip_image_u8 image{2, 1, {0, 255, 51, 255, 0, 102}};
+    clip_ctx ctx;
+    ctx.image_mean[0] = 0.5f;
+    ctx.image_std[0] = 0.5f;
+
+    const clip_image_f32 res = clip_image_preprocess(ctx, image);
+    const std::vector<float> expected{-1.0f, 1.0f, 1.0f, 0.0f, 0.2f, 0.4f};
+    ASSERT_EQ(res.buf.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(res.buf[i], expected[i], 1e-6f);
+    }
+}
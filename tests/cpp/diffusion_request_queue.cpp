@@ -0,0 +1,205 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+
+#include "image_generation/diffusion_request_queue.hpp"
+
+using ov::genai::DiffusionPipeline;
+using ov::genai::DiffusionRequestQueue;
+
+namespace {
+
+// denoises requests without models: latent is filled with prompt length and returned as a result
+class FakeDiffusionPipeline : public DiffusionPipeline {
+public:
+    explicit FakeDiffusionPipeline(bool batched_denoising)
+        : DiffusionPipeline(ov::genai::PipelineType::TEXT_2_IMAGE),
+          m_batched_denoising(batched_denoising) { }
+
+    void reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale) override { }
+
+    void compile(const std::string& device, const ov::AnyMap& properties) override { }
+
+    std::tuple<ov::Tensor, ov::Tensor, ov::Tensor, ov::Tensor> prepare_latents(ov::Tensor initial_image, const ov::genai::ImageGenerationConfig& generation_config) const override {
+        return {};
+    }
+
+    void compute_hidden_states(const std::string& positive_prompt, const ov::genai::ImageGenerationConfig& generation_config) override { }
+
+    void set_lora_adapters(std::optional<ov::genai::AdapterConfig> adapters) override { }
+
+    ov::Tensor generate(const std::string& positive_prompt, ov::Tensor initial_image, ov::Tensor mask_image, const ov::AnyMap& properties) override {
+        return make_latent(positive_prompt);
+    }
+
+    ov::Tensor decode(const ov::Tensor latent) override {
+        return latent;
+    }
+
+    bool is_batched_denoising_supported() const override {
+        return m_batched_denoising;
+    }
+
+    std::shared_ptr<DenoisingRequest> create_denoising_request(const std::string& positive_prompt, const ov::AnyMap& properties) override {
+        OPENVINO_ASSERT(!positive_prompt.empty(), "Prompt must not be empty");
+
+        auto request = std::make_shared<DenoisingRequest>();
+        request->generation_config.update_generation_config(properties);
+
+        auto callback_iter = properties.find(ov::genai::callback.name());
+        if (callback_iter != properties.end()) {
+            request->callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+        }
+
+        for (size_t step = request->generation_config.num_inference_steps; step > 0; --step) {
+            request->timesteps.push_back(static_cast<int64_t>(step - 1) * 10);
+        }
+        request->latent = make_latent(positive_prompt);
+        request->hidden_states["encoder_hidden_states"] = ov::Tensor(ov::element::f32, {1, 77, 16});
+        return request;
+    }
+
+    void denoise_step(const std::vector<std::shared_ptr<DenoisingRequest>>& requests) override {
+        if (m_batch_sizes.empty()) {
+            m_first_step_started.set_value();
+            m_first_step_allowed.get_future().wait();
+        }
+
+        m_batch_sizes.push_back(requests.size());
+        for (const auto& request : requests) {
+            request->denoised = request->latent;
+            request->cancelled = request->callback && request->callback(request->inference_step, request->timesteps.size(), request->denoised);
+            ++request->inference_step;
+        }
+    }
+
+    LatentDecoder finish_denoising_request(const DenoisingRequest& request) override {
+        if (request.cancelled) {
+            return [] { return ov::Tensor(ov::element::u8, {}); };
+        }
+        ov::Tensor denoised = request.denoised;
+        return [denoised] { return denoised; };
+    }
+
+    std::promise<void> m_first_step_started, m_first_step_allowed;
+    std::vector<size_t> m_batch_sizes;
+
+protected:
+    void initialize_generation_config(const std::string& class_name) override { }
+
+    void check_image_size(const int height, const int width) const override { }
+
+    void check_inputs(const ov::genai::ImageGenerationConfig& generation_config, ov::Tensor initial_image) const override { }
+
+    static ov::Tensor make_latent(const std::string& positive_prompt) {
+        ov::Tensor latent(ov::element::f32, {1, 4, 8, 8});
+        std::fill_n(latent.data<float>(), latent.get_size(), static_cast<float>(positive_prompt.size()));
+        return latent;
+    }
+
+private:
+    bool m_batched_denoising;
+};
+
+// decoding of the first request waits until the second request is denoised
+class DeferredDecodingPipeline : public FakeDiffusionPipeline {
+public:
+    DeferredDecodingPipeline()
+        : FakeDiffusionPipeline(false) { }
+
+    LatentDecoder generate_deferred(const std::string& positive_prompt, const ov::AnyMap& properties) override {
+        ov::Tensor latent = make_latent(positive_prompt);
+        if (m_num_denoised++ > 0) {
+            m_next_denoised.set_value();
+            return [latent] { return latent; };
+        }
+
+        return [this, latent] {
+            m_overlapped = m_next_denoised_future.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+            return latent;
+        };
+    }
+
+    bool m_overlapped = false;
+
+private:
+    size_t m_num_denoised = 0;
+    std::promise<void> m_next_denoised;
+    std::shared_future<void> m_next_denoised_future = m_next_denoised.get_future().share();
+};
+
+} // namespace
+
+TEST(DiffusionRequestQueueTest, RequestsJoinBatchBetweenSteps) {
+    auto pipeline = std::make_shared<FakeDiffusionPipeline>(true);
+    auto first_step_started = pipeline->m_first_step_started.get_future();
+    std::future<ov::Tensor> a, b, c;
+
+    {
+        DiffusionRequestQueue queue(pipeline);
+        a = queue.add_request("a", {ov::genai::num_inference_steps(2)});
+
+        // 'b' and 'c' are admitted while 'a' makes its first step
+        first_step_started.wait();
+        b = queue.add_request("bb", {ov::genai::num_inference_steps(2)});
+        c = queue.add_request("ccc", {ov::genai::num_inference_steps(2)});
+        pipeline->m_first_step_allowed.set_value();
+    }
+
+    EXPECT_EQ(a.get().data<float>()[0], 1.0f);
+    EXPECT_EQ(b.get().data<float>()[0], 2.0f);
+    EXPECT_EQ(c.get().data<float>()[0], 3.0f);
+
+    // 'a' is at a different timestep than new requests, so it's denoised separately
+    EXPECT_EQ(pipeline->m_batch_sizes, std::vector<size_t>({1, 1, 2, 2}));
+}
+
+TEST(DiffusionRequestQueueTest, CallbackAndErrorsAffectOnlyTheirRequests) {
+    auto pipeline = std::make_shared<FakeDiffusionPipeline>(true);
+    pipeline->m_first_step_allowed.set_value();
+
+    size_t cancelled_steps = 0;
+    auto cancel = [&cancelled_steps] (size_t step, size_t num_steps, ov::Tensor& latent) {
+        ++cancelled_steps;
+        return true;
+    };
+
+    DiffusionRequestQueue queue(pipeline);
+    auto cancelled = queue.add_request("cancelled", {ov::genai::num_inference_steps(3), ov::genai::callback(cancel)});
+    auto failed = queue.add_request("", {ov::genai::num_inference_steps(3)});
+    auto finished = queue.add_request("finished", {ov::genai::num_inference_steps(3)});
+
+    EXPECT_EQ(cancelled.get().get_size(), 0);
+    EXPECT_EQ(cancelled_steps, 1);
+    EXPECT_THROW(failed.get(), ov::Exception);
+    EXPECT_EQ(finished.get().data<float>()[0], 8.0f);
+}
+
+TEST(DiffusionRequestQueueTest, PipelineWithoutBatchedDenoisingGeneratesOneByOne) {
+    auto pipeline = std::make_shared<FakeDiffusionPipeline>(false);
+
+    DiffusionRequestQueue queue(pipeline);
+    auto first = queue.add_request("first", {});
+    auto second = queue.add_request("second", {});
+
+    EXPECT_EQ(first.get().data<float>()[0], 5.0f);
+    EXPECT_EQ(second.get().data<float>()[0], 6.0f);
+    EXPECT_TRUE(pipeline->m_batch_sizes.empty());
+}
+
+TEST(DiffusionRequestQueueTest, DecodingOverlapsWithNextRequestDenoising) {
+    auto pipeline = std::make_shared<DeferredDecodingPipeline>();
+
+    DiffusionRequestQueue queue(pipeline);
+    auto first = queue.add_request("first", {});
+    auto second = queue.add_request("second", {});
+
+    EXPECT_EQ(first.get().data<float>()[0], 5.0f);
+    EXPECT_EQ(second.get().data<float>()[0], 6.0f);
+    EXPECT_TRUE(pipeline->m_overlapped);
+}
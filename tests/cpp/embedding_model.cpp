@@ -0,0 +1,98 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/serialize.hpp"
+
+#include "visual_language/embedding_model.hpp"
+
+using ov::genai::EmbeddingsModel;
+
+namespace {
+
+constexpr size_t VOCAB_SIZE = 16, HIDDEN_SIZE = 8;
+constexpr float SCALE_EMB = 2.0f;
+
+EmbeddingsModel make_embeddings_model(const std::shared_ptr<ov::Model>& model) {
+    std::stringstream xml, bin;
+    ov::pass::Serialize(xml, bin).run_on_model(model);
+    const std::string weights = bin.str();
+    ov::Tensor weights_tensor(ov::element::u8, {weights.size()});
+    std::copy(weights.begin(), weights.end(), weights_tensor.data<char>());
+    return EmbeddingsModel(xml.str(), weights_tensor, SCALE_EMB, "CPU", {});
+}
+
+// int8 table with per row scales and zero points like produced by weights compression
+std::shared_ptr<ov::Model> make_compressed_model(bool with_activation) {
+    std::vector<uint8_t> table(VOCAB_SIZE * HIDDEN_SIZE);
+    std::vector<uint8_t> zero_points(VOCAB_SIZE);
+    std::vector<float> scales(VOCAB_SIZE);
+    for (size_t row = 0; row < VOCAB_SIZE; ++row) {
+        zero_points[row] = static_cast<uint8_t>(100 + row);
+        scales[row] = 0.5f + 0.25f * row;
+        for (size_t col = 0; col < HIDDEN_SIZE; ++col) {
+            table[row * HIDDEN_SIZE + col] = static_cast<uint8_t>(90 + 3 * row + col);
+        }
+    }
+
+    auto input_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, -1});
+    auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{VOCAB_SIZE, HIDDEN_SIZE}, table);
+    auto zero_point = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{VOCAB_SIZE, 1}, zero_points);
+    auto scale = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{VOCAB_SIZE, 1}, scales);
+    auto subtract = std::make_shared<ov::op::v1::Subtract>(std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32),
+                                                           std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32));
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {0});
+    std::shared_ptr<ov::Node> embeds = std::make_shared<ov::op::v8::Gather>(multiply, input_ids, axis);
+    if (with_activation) {
+        // a model, which is not a plain lookup, is inferred
+        embeds = std::make_shared<ov::op::v0::Relu>(embeds);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{embeds}, ov::ParameterVector{input_ids});
+}
+
+float expected_value(int64_t token, size_t col, bool with_activation) {
+    const float value = (float(90 + 3 * token + col) - float(100 + token)) * (0.5f + 0.25f * token) * SCALE_EMB;
+    return with_activation ? std::max(value, 0.0f) : value;
+}
+
+} // namespace
+
+TEST(EmbeddingsModelTest, GatherMatchesDequantizedTable) {
+    for (bool with_activation : {false, true}) {
+        EmbeddingsModel embedding = make_embeddings_model(make_compressed_model(with_activation));
+        std::vector<int64_t> tokens{3, 0, 15, 3};
+        ov::Tensor input_ids(ov::element::i64, {1, tokens.size()}, tokens.data());
+
+        ov::Tensor embeds = embedding.infer(input_ids);
+        ASSERT_EQ(embeds.get_shape(), (ov::Shape{1, tokens.size(), HIDDEN_SIZE}));
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            for (size_t col = 0; col < HIDDEN_SIZE; ++col) {
+                EXPECT_NEAR(embeds.data<const float>()[i * HIDDEN_SIZE + col], expected_value(tokens[i], col, with_activation), 1e-5f);
+            }
+        }
+
+        // writing into a caller's tensor gives the same values
+        ov::Tensor inputs_embeds(ov::element::f32, {1, tokens.size(), HIDDEN_SIZE});
+        embedding.clone().infer(input_ids, inputs_embeds);
+        for (size_t i = 0; i < inputs_embeds.get_size(); ++i) {
+            EXPECT_EQ(inputs_embeds.data<const float>()[i], embeds.data<const float>()[i]);
+        }
+    }
+}
+
+TEST(EmbeddingsModelTest, RejectsTokensOutOfVocabulary) {
+    EmbeddingsModel embedding = make_embeddings_model(make_compressed_model(false));
+    std::vector<int64_t> tokens{int64_t(VOCAB_SIZE)};
+    EXPECT_THROW(embedding.infer(ov::Tensor(ov::element::i64, {1, 1}, tokens.data())), ov::Exception);
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/util/variable.hpp"
+
+#include "utils.hpp"
+
+namespace {
+
+constexpr size_t NUM_HEADS = 4, HEAD_SIZE = 16;
+
+// KV cache like states, which are concatenated with the input along the sequence length axis
+ov::InferRequest make_stateful_request(size_t num_states, size_t num_heads, size_t head_size, size_t seq_length_axis) {
+    ov::PartialShape shape{1, num_heads, head_size};
+    shape.insert(shape.begin() + seq_length_axis, ov::Dimension::dynamic());
+
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    ov::ResultVector results;
+    ov::SinkVector sinks;
+    for (size_t i = 0; i < num_states; ++i) {
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "past_key_values." + std::to_string(i)});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+        auto present = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, input}, seq_length_axis);
+        sinks.push_back(std::make_shared<ov::op::v6::Assign>(present, variable));
+        results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v3::ShapeOf>(present)));
+    }
+    auto model = std::make_shared<ov::Model>(results, sinks, ov::ParameterVector{input});
+    return ov::genai::utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+}
+
+void fill_states(ov::InferRequest& request, const ov::Shape& shape) {
+    for (auto& state : request.query_state()) {
+        ov::Tensor tensor(ov::element::f32, shape);
+        float* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            data[i] = static_cast<float>(i);
+        }
+        state.set_state(tensor);
+    }
+}
+
+} // namespace
+
+TEST(TrimKVCacheTest, KeepsPrefixOfSequence) {
+    // [BATCH_SIZE, num_kv_heads, seq_len, head_size] and chatglm like [seq_len, BATCH_SIZE, num_kv_heads, head_size] layouts
+    for (size_t seq_length_axis : {2, 0}) {
+        const size_t seq_len = 10, remove_from_end = 3;
+        ov::InferRequest request = make_stateful_request(2, NUM_HEADS, HEAD_SIZE, seq_length_axis);
+        ov::Shape shape{1, NUM_HEADS, HEAD_SIZE};
+        shape.insert(shape.begin() + seq_length_axis, seq_len);
+        fill_states(request, shape);
+
+        ov::genai::utils::trim_kv_cache(request, remove_from_end, seq_length_axis, std::nullopt);
+
+        ov::Shape trimmed_shape = shape;
+        trimmed_shape[seq_length_axis] -= remove_from_end;
+        const size_t outer = seq_length_axis == 0 ? 1 : NUM_HEADS;
+        const size_t row_size = seq_length_axis == 0 ? NUM_HEADS * HEAD_SIZE : HEAD_SIZE;
+        for (auto& state : request.query_state()) {
+            ov::Tensor trimmed = state.get_state();
+            ASSERT_EQ(trimmed.get_shape(), trimmed_shape);
+            const float* data = trimmed.data<const float>();
+            for (size_t block = 0; block < outer; ++block) {
+                for (size_t i = 0; i < (seq_len - remove_from_end) * row_size; ++i) {
+                    ASSERT_EQ(data[block * (seq_len - remove_from_end) * row_size + i], static_cast<float>(block * seq_len * row_size + i));
+                }
+            }
+        }
+    }
+}
+
+TEST(TrimKVCacheTest, RejectsRemovingMoreThanCached) {
+    ov::InferRequest request = make_stateful_request(1, NUM_HEADS, HEAD_SIZE, 2);
+    fill_states(request, {1, NUM_HEADS, 4, HEAD_SIZE});
+    EXPECT_THROW(ov::genai::utils::trim_kv_cache(request, 5, 2, std::nullopt), ov::Exception);
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "openvino/genai/image_generation/generation_config.hpp"
+#include "image_generation/philox.hpp"
+
+using ov::genai::PhiloxGenerator;
+
+TEST(PhiloxGeneratorTest, MatchesKnownAnswers) {
+    // known answer tests from Random123 library
+    using namespace ov::genai::philox;
+    EXPECT_EQ(philox4x32_10({0, 0, 0, 0}, {0, 0}), (Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(philox4x32_10({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(philox4x32_10({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(PhiloxGeneratorTest, StreamDoesNotDependOnSplit) {
+    PhiloxGenerator whole(42), split(42), elementwise(42);
+
+    ov::Tensor expected = whole.randn_tensor({2, 4, 32, 32});
+    ov::Tensor first = split.randn_tensor({1, 4, 32, 32});
+    ov::Tensor second = split.randn_tensor({1, 4, 32, 32});
+
+    const float* expected_data = expected.data<const float>();
+    const size_t half = first.get_size();
+    for (size_t i = 0; i < half; ++i) {
+        ASSERT_EQ(expected_data[i], first.data<const float>()[i]);
+        ASSERT_EQ(expected_data[half + i], second.data<const float>()[i]);
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+        ASSERT_EQ(expected_data[i], elementwise.next());
+    }
+}
+
+TEST(PhiloxGeneratorTest, UnalignedSplitContinuesStream) {
+    PhiloxGenerator whole(42), split(42);
+
+    ov::Tensor expected = whole.randn_tensor({64});
+    const float* expected_data = expected.data<const float>();
+    size_t pos = 0;
+
+    // sizes, which are not multiples of 4, leave values of the last counter for the following calls
+    for (const ov::Shape& shape : {ov::Shape{3}, ov::Shape{}, ov::Shape{2, 3}, ov::Shape{1}, ov::Shape{0}, ov::Shape{3, 7}}) {
+        if (shape.empty()) {
+            ASSERT_EQ(expected_data[pos++], split.next());
+            continue;
+        }
+        ov::Tensor values = split.randn_tensor(shape);
+        for (size_t i = 0; i < values.get_size(); ++i) {
+            ASSERT_EQ(expected_data[pos++], values.data<const float>()[i]) << "at " << pos - 1;
+        }
+    }
+    ASSERT_EQ(expected_data[pos], split.next());
+}
+
+TEST(PhiloxGeneratorTest, SeedRestartsStream) {
+    PhiloxGenerator generator(7);
+    ov::Tensor first = generator.randn_tensor({3, 5});
+    generator.next();
+
+    generator.seed(7);
+    ov::Tensor second = generator.randn_tensor({3, 5});
+    for (size_t i = 0; i < first.get_size(); ++i) {
+        EXPECT_EQ(first.data<const float>()[i], second.data<const float>()[i]);
+    }
+
+    // another seed produces another stream
+    generator.seed(8);
+    EXPECT_NE(first.data<const float>()[0], generator.next());
+}
+
+TEST(PhiloxGeneratorTest, ValuesAreNormallyDistributed) {
+    PhiloxGenerator generator(42);
+    ov::Tensor values = generator.randn_tensor({4, 4, 128, 128});
+
+    double sum = 0.0, squared_sum = 0.0;
+    const float* data = values.data<const float>();
+    for (size_t i = 0; i < values.get_size(); ++i) {
+        ASSERT_TRUE(std::isfinite(data[i]));
+        sum += data[i];
+        squared_sum += static_cast<double>(data[i]) * data[i];
+    }
+
+    const double mean = sum / values.get_size();
+    const double variance = squared_sum / values.get_size() - mean * mean;
+    EXPECT_NEAR(mean, 0.0, 0.01);
+    EXPECT_NEAR(variance, 1.0, 0.01);
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "openvino/genai/image_generation/prompt_embedding_cache.hpp"
+
+using ov::genai::PromptEmbeddingCache;
+
+namespace {
+
+ov::Tensor make_embedding(float value, size_t size) {
+    ov::Tensor tensor(ov::element::f32, {1, size});
+    std::fill_n(tensor.data<float>(), size, value);
+    return tensor;
+}
+
+class PromptEmbeddingCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        m_capacity = cache().get_capacity();
+        cache().clear();
+        m_statistics = cache().get_statistics();
+    }
+
+    void TearDown() override {
+        cache().clear();
+        cache().set_capacity(m_capacity);
+    }
+
+    PromptEmbeddingCache& cache() {
+        return PromptEmbeddingCache::instance();
+    }
+
+    size_t m_capacity = 0;
+    PromptEmbeddingCache::Statistics m_statistics;
+};
+
+}  // namespace
+
+TEST_F(PromptEmbeddingCacheTest, StoresCopiesOfAllOutputs) {
+    const size_t encoder_id = cache().create_encoder_id();
+    PromptEmbeddingCache::Key key{encoder_id, "a cat", "blurry", true, -1};
+
+    EXPECT_FALSE(cache().find(key).has_value());
+
+    ov::Tensor hidden_state = make_embedding(1.0f, 8), pooled = make_embedding(2.0f, 4);
+    cache().insert(key, {hidden_state, pooled});
+
+    // infer request output buffers are overwritten by the next inference
+    hidden_state.data<float>()[0] = 100.0f;
+
+    auto outputs = cache().find(key);
+    ASSERT_TRUE(outputs.has_value());
+    ASSERT_EQ(outputs->size(), 2);
+    EXPECT_EQ(outputs->at(0).data<float>()[0], 1.0f);
+    EXPECT_EQ(outputs->at(1).get_shape(), ov::Shape({1, 4}));
+
+    const auto statistics = cache().get_statistics();
+    EXPECT_EQ(statistics.hits - m_statistics.hits, 1);
+    EXPECT_EQ(statistics.misses - m_statistics.misses, 1);
+    EXPECT_EQ(statistics.num_entries, 1);
+    EXPECT_EQ(statistics.size_bytes, 12 * sizeof(float));
+}
+
+TEST_F(PromptEmbeddingCacheTest, KeyDistinguishesEncodersAndParameters) {
+    const size_t encoder_id = cache().create_encoder_id();
+    cache().insert({encoder_id, "a cat", "", false, -1}, {make_embedding(1.0f, 4)});
+
+    EXPECT_FALSE(cache().find({cache().create_encoder_id(), "a cat", "", false, -1}).has_value());
+    EXPECT_FALSE(cache().find({encoder_id, "a cat", "", true, -1}).has_value());
+    EXPECT_FALSE(cache().find({encoder_id, "a cat", "", false, 256}).has_value());
+    EXPECT_FALSE(cache().find({encoder_id, "a ca", "t", false, -1}).has_value());
+    EXPECT_TRUE(cache().find({encoder_id, "a cat", "", false, -1}).has_value());
+}
+
+TEST_F(PromptEmbeddingCacheTest, EvictsLeastRecentlyUsedOverBudget) {
+    const size_t encoder_id = cache().create_encoder_id();
+    const size_t entry_bytes = 16 * sizeof(float);
+    cache().set_capacity(2 * entry_bytes);
+
+    cache().insert({encoder_id, "first", "", false, -1}, {make_embedding(1.0f, 16)});
+    cache().insert({encoder_id, "second", "", false, -1}, {make_embedding(2.0f, 16)});
+    // touch the first one, so the second one is the least recently used
+    ASSERT_TRUE(cache().find({encoder_id, "first", "", false, -1}).has_value());
+    cache().insert({encoder_id, "third", "", false, -1}, {make_embedding(3.0f, 16)});
+
+    EXPECT_TRUE(cache().find({encoder_id, "first", "", false, -1}).has_value());
+    EXPECT_FALSE(cache().find({encoder_id, "second", "", false, -1}).has_value());
+    EXPECT_TRUE(cache().find({encoder_id, "third", "", false, -1}).has_value());
+
+    const auto statistics = cache().get_statistics();
+    EXPECT_EQ(statistics.evictions - m_statistics.evictions, 1);
+    EXPECT_LE(statistics.size_bytes, statistics.capacity_bytes);
+
+    // entries larger than the whole budget are not stored, zero capacity disables the cache
+    cache().insert({encoder_id, "large", "", false, -1}, {make_embedding(4.0f, 64)});
+    EXPECT_FALSE(cache().find({encoder_id, "large", "", false, -1}).has_value());
+
+    cache().set_capacity(0);
+    EXPECT_EQ(cache().get_statistics().num_entries, 0);
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "whisper/real_fft.hpp"
+
+using ov::genai::RealFFT;
+
+namespace {
+
+std::vector<float> random_signal(size_t n) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> signal(n);
+    for (auto& value : signal) {
+        value = distribution(generator);
+    }
+    return signal;
+}
+
+std::vector<std::complex<double>> reference_dft(const std::vector<float>& in) {
+    const size_t n = in.size();
+    std::vector<std::complex<double>> out(n / 2 + 1);
+    for (size_t k = 0; k < out.size(); k++) {
+        for (size_t j = 0; j < n; j++) {
+            const double theta = -2.0 * M_PI * static_cast<double>(k * j % n) / static_cast<double>(n);
+            out[k] += std::complex<double>(in[j] * std::cos(theta), in[j] * std::sin(theta));
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+using RealFFTTest = testing::TestWithParam<size_t>;
+
+TEST_P(RealFFTTest, TransformEqualToReferenceDFT) {
+    const size_t n = GetParam();
+    const auto signal = random_signal(n);
+    const auto expected = reference_dft(signal);
+
+    RealFFT fft(n);
+    auto workspace = fft.create_workspace();
+    std::vector<RealFFT::Complex> spectrum(fft.bins());
+    fft.transform(signal.data(), spectrum.data(), workspace);
+
+    ASSERT_EQ(fft.bins(), expected.size());
+    for (size_t k = 0; k < expected.size(); k++) {
+        EXPECT_NEAR(spectrum[k].real(), expected[k].real(), 1e-4) << "bin " << k;
+        EXPECT_NEAR(spectrum[k].imag(), expected[k].imag(), 1e-4) << "bin " << k;
+    }
+
+    // workspace is reused between calls
+    std::vector<float> power(fft.bins());
+    fft.power_spectrum(signal.data(), power.data(), workspace);
+    for (size_t k = 0; k < expected.size(); k++) {
+        EXPECT_NEAR(power[k], std::norm(expected[k]), 1e-3 * std::max(1.0, std::norm(expected[k]))) << "bin " << k;
+    }
+}
+
+// 400 is Whisper n_fft, other sizes cover every specialized radix, the generic butterfly and odd lengths
+INSTANTIATE_TEST_SUITE_P(VariousSizes, RealFFTTest, testing::Values(1, 2, 7, 8, 30, 77, 98, 256, 400, 1210));
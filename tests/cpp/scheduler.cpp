@@ -712,6 +712,40 @@ TEST(TestScheduler, prefix_caching_with_max_new_tokens_equal_1) {
 
 }
 
+TEST(TestScheduler, prefix_caching_with_prompt_embeds_uses_prompt_hash_ids) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.enable_prefix_caching = true;
+    // prompt ids are the same for any image, e.g. image positions are filled with pad token
+    std::vector<uint64_t> prompt_tokens = {0,1,2,3,4,5,6,7};
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // the first image, another image, the first image again
+    std::vector<TokenIds> prompt_hash_ids = {{10,11,12,13,14,15,16,17}, {20,21,22,23,24,25,26,27}, {10,11,12,13,14,15,16,17}};
+    for (size_t request_id = 0; request_id < prompt_hash_ids.size(); request_id++) {
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {prompt_tokens.size()}, prompt_tokens.data()),
+                                                                            ov::genai::greedy(), 4,
+                                                                            scheduler_config.enable_prefix_caching);
+        sequence_group->set_sequence_group_ptr(sequence_group);
+        sequence_group->set_prompt_embeds(ov::Tensor(ov::element::f32, {1, prompt_tokens.size(), 2}), prompt_hash_ids[request_id]);
+        scheduler.restore_cached_blocks(sequence_group);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+
+        auto out = scheduler.schedule(requests);
+        if (request_id < 2)
+            EXPECT_EQ(out.m_total_num_scheduled_tokens, prompt_tokens.size());
+        else
+            EXPECT_LT(out.m_total_num_scheduled_tokens, prompt_tokens.size());
+
+        auto sequence = sequence_group->get_running_sequences()[0];
+        sequence->append_token(23, 0.7);
+        sequence_group->finish_iteration();
+        sequence->set_status(SequenceStatus::FINISHED);
+        scheduler.free_sequence(sequence->get_id());
+    }
+}
+
 TEST(TestScheduler, test_partially_preempted_prompt_not_allowed) {
     SchedulerConfig scheduler_config;
     scheduler_config.max_num_batched_tokens = 32;
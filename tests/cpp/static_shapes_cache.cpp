@@ -0,0 +1,156 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include "image_generation/static_shapes_cache.hpp"
+
+using ov::genai::DiffusionPipeline;
+using ov::genai::ImageGenerationConfig;
+using ov::genai::StaticShapesCache;
+
+namespace {
+
+// records reshape and compile calls instead of reshaping and compiling models
+class FakeDiffusionPipeline : public DiffusionPipeline {
+public:
+    FakeDiffusionPipeline()
+        : DiffusionPipeline(ov::genai::PipelineType::TEXT_2_IMAGE) { }
+
+    void reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale) override {
+        m_reshaped_height = height;
+        m_reshaped_width = width;
+    }
+
+    void compile(const std::string& device, const ov::AnyMap& properties) override {
+        if (device == "FAIL") {
+            OPENVINO_THROW("Compilation failed");
+        }
+        m_compiled_device = device;
+    }
+
+    std::tuple<ov::Tensor, ov::Tensor, ov::Tensor, ov::Tensor> prepare_latents(ov::Tensor initial_image, const ImageGenerationConfig& generation_config) const override {
+        return {};
+    }
+
+    void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override { }
+
+    void set_lora_adapters(std::optional<ov::genai::AdapterConfig> adapters) override { }
+
+    ov::Tensor generate(const std::string& positive_prompt, ov::Tensor initial_image, ov::Tensor mask_image, const ov::AnyMap& properties) override {
+        return {};
+    }
+
+    ov::Tensor decode(const ov::Tensor latent) override {
+        return latent;
+    }
+
+    int m_reshaped_height = -1, m_reshaped_width = -1;
+    std::string m_compiled_device;
+
+protected:
+    void initialize_generation_config(const std::string& class_name) override { }
+
+    void check_image_size(const int height, const int width) const override { }
+
+    void check_inputs(const ImageGenerationConfig& generation_config, ov::Tensor initial_image) const override { }
+};
+
+ImageGenerationConfig make_config(int height, int width) {
+    ImageGenerationConfig generation_config;
+    generation_config.height = height;
+    generation_config.width = width;
+    return generation_config;
+}
+
+StaticShapesCache::PipelineFactory make_factory(std::atomic<size_t>& num_created) {
+    return [&num_created] () {
+        ++num_created;
+        return std::make_shared<FakeDiffusionPipeline>();
+    };
+}
+
+} // namespace
+
+TEST(StaticShapesCacheTest, SameShapesReuseCompiledPipeline) {
+    std::atomic<size_t> num_created{0};
+    StaticShapesCache cache(make_factory(num_created), "CPU", {}, 2);
+
+    auto first = cache.get(make_config(512, 768));
+    auto second = cache.get(make_config(512, 768));
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(num_created, 1);
+
+    auto fake = std::dynamic_pointer_cast<FakeDiffusionPipeline>(first);
+    EXPECT_EQ(fake->m_reshaped_height, 512);
+    EXPECT_EQ(fake->m_reshaped_width, 768);
+    EXPECT_EQ(fake->m_compiled_device, "CPU");
+
+    // guidance scales > 1 don't change shapes
+    ImageGenerationConfig other_guidance = make_config(512, 768);
+    other_guidance.guidance_scale = 3.0f;
+    EXPECT_EQ(StaticShapesCache::get_key(other_guidance), StaticShapesCache::get_key(make_config(512, 768)));
+
+    ImageGenerationConfig no_guidance = make_config(512, 768);
+    no_guidance.guidance_scale = 1.0f;
+    EXPECT_NE(StaticShapesCache::get_key(no_guidance), StaticShapesCache::get_key(make_config(512, 768)));
+
+    auto metrics = cache.get_metrics();
+    EXPECT_EQ(metrics.hits, 1);
+    EXPECT_EQ(metrics.misses, 1);
+    EXPECT_EQ(metrics.num_entries, 1);
+    EXPECT_EQ(metrics.num_compilations, 1);
+}
+
+TEST(StaticShapesCacheTest, LeastRecentlyUsedShapesAreEvicted) {
+    std::atomic<size_t> num_created{0};
+    StaticShapesCache cache(make_factory(num_created), "CPU", {}, 2);
+
+    auto a = cache.get(make_config(256, 256));
+    cache.get(make_config(512, 512));
+    // 'a' becomes the most recently used one
+    EXPECT_EQ(cache.get(make_config(256, 256)), a);
+
+    cache.get(make_config(768, 768));
+    EXPECT_EQ(cache.get(make_config(256, 256)), a);
+    EXPECT_EQ(num_created, 3);
+
+    // 512x512 was evicted and is compiled again
+    cache.get(make_config(512, 512));
+    EXPECT_EQ(num_created, 4);
+
+    auto metrics = cache.get_metrics();
+    EXPECT_EQ(metrics.evictions, 2);
+    EXPECT_EQ(metrics.num_entries, 2);
+    EXPECT_EQ(cache.get_last_used(), cache.get(make_config(512, 512)));
+}
+
+TEST(StaticShapesCacheTest, PrecompiledShapesAreHits) {
+    std::atomic<size_t> num_created{0};
+    StaticShapesCache cache(make_factory(num_created), "CPU", {}, 4);
+
+    cache.precompile(make_config(512, 512));
+    cache.precompile(make_config(1024, 1024));
+    // already cached shapes are not compiled twice
+    cache.precompile(make_config(512, 512));
+
+    cache.get(make_config(512, 512));
+    cache.get(make_config(1024, 1024));
+
+    auto metrics = cache.get_metrics();
+    EXPECT_EQ(num_created, 2);
+    EXPECT_EQ(metrics.hits, 2);
+    EXPECT_EQ(metrics.misses, 0);
+    EXPECT_EQ(metrics.num_compilations, 2);
+}
+
+TEST(StaticShapesCacheTest, CompilationErrorIsRethrown) {
+    std::atomic<size_t> num_created{0};
+    StaticShapesCache cache(make_factory(num_created), "FAIL", {}, 2);
+
+    EXPECT_THROW(cache.get(make_config(512, 512)), ov::Exception);
+    EXPECT_EQ(cache.get_metrics().num_compilations, 0);
+}
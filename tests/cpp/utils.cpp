@@ -18,4 +18,31 @@ TEST(TestIsContainer, test_is_container) {
     EXPECT_EQ(is_container<std::vector<float>>, true);
     EXPECT_EQ(is_container<map_type>, true);
     EXPECT_EQ(is_container<std::set<int64_t>>, true);
-}
\ No newline at end of file
+}
+
+TEST(TestAppendedChatTokens, finds_tokens_after_window) {
+    std::vector<int64_t> tail{1, 2, 3}, window{1, 2, 3, 10, 11, 20, 21};
+    std::vector<int64_t> answer{10, 11};
+    ov::Tensor tail_tensor(ov::element::i64, {1, tail.size()}, tail.data());
+    ov::Tensor window_tensor(ov::element::i64, {1, window.size()}, window.data());
+    EXPECT_EQ(get_appended_tokens_offset(window_tensor, tail_tensor, answer), 5);
+
+    // the last answer token is merged with the appended text
+    window = {1, 2, 3, 10, 12, 21};
+    window_tensor = ov::Tensor(ov::element::i64, {1, window.size()}, window.data());
+    EXPECT_FALSE(get_appended_tokens_offset(window_tensor, tail_tensor, answer).has_value());
+
+    // nothing is appended
+    window = {1, 2, 3, 10, 11};
+    window_tensor = ov::Tensor(ov::element::i64, {1, window.size()}, window.data());
+    EXPECT_FALSE(get_appended_tokens_offset(window_tensor, tail_tensor, answer).has_value());
+}
+
+TEST(TestAppendedChatTokens, text_tail_does_not_split_characters) {
+    const std::string text = "ab\xD0\x96\xD0\x96";  // "abЖЖ"
+    EXPECT_EQ(get_text_tail_start(text, text.size(), 2), 4);
+    EXPECT_EQ(get_text_tail_start(text, text.size(), 3), 4);
+    EXPECT_EQ(get_text_tail_start(text, text.size(), 4), 2);
+    EXPECT_EQ(get_text_tail_start(text, text.size(), 5), 1);
+    EXPECT_EQ(get_text_tail_start(text, 2, 10), 0);
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "openvino/genai/visual_language/vision_embedding_cache.hpp"
+
+using ov::genai::VisionEmbeddingCache;
+
+namespace {
+
+ov::Tensor make_embedding(float value, size_t size) {
+    ov::Tensor tensor(ov::element::f32, {1, size});
+    std::fill_n(tensor.data<float>(), size, value);
+    return tensor;
+}
+
+ov::Tensor make_image(uint8_t value) {
+    ov::Tensor image(ov::element::u8, {1, 4, 4, 3});
+    std::fill_n(image.data<uint8_t>(), image.get_size(), value);
+    return image;
+}
+
+class VisionEmbeddingCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        m_capacity = cache().get_capacity();
+        cache().clear();
+        m_statistics = cache().get_statistics();
+    }
+
+    void TearDown() override {
+        cache().clear();
+        cache().set_capacity(m_capacity);
+    }
+
+    VisionEmbeddingCache& cache() {
+        return VisionEmbeddingCache::instance();
+    }
+
+    VisionEmbeddingCache::Key make_key(size_t encoder_id, const ov::Tensor& image, const std::string& processor_config = "") {
+        return {encoder_id, VisionEmbeddingCache::hash_image(image), image.get_shape(), processor_config};
+    }
+
+    size_t m_capacity = 0;
+    VisionEmbeddingCache::Statistics m_statistics;
+};
+
+}  // namespace
+
+TEST_F(VisionEmbeddingCacheTest, StoresCopiesAndKeepsEmptyTensors) {
+    const size_t encoder_id = cache().get_encoder_id({});
+    const auto key = make_key(encoder_id, make_image(1));
+
+    EXPECT_FALSE(cache().find(key).has_value());
+
+    ov::Tensor resized_source = make_embedding(1.0f, 8);
+    // an image which wasn't sliced has no slices tensor
+    cache().insert(key, {resized_source, ov::Tensor{}});
+
+    // vision encoder output buffers are overwritten by the next inference
+    resized_source.data<float>()[0] = 100.0f;
+
+    auto embeddings = cache().find(make_key(encoder_id, make_image(1)));
+    ASSERT_TRUE(embeddings.has_value());
+    ASSERT_EQ(embeddings->size(), 2);
+    EXPECT_EQ(embeddings->at(0).data<float>()[0], 1.0f);
+    EXPECT_FALSE(embeddings->at(1));
+
+    const auto statistics = cache().get_statistics();
+    EXPECT_EQ(statistics.hits - m_statistics.hits, 1);
+    EXPECT_EQ(statistics.misses - m_statistics.misses, 1);
+    EXPECT_EQ(statistics.num_entries, 1);
+    EXPECT_EQ(statistics.size_bytes, 8 * sizeof(float));
+}
+
+TEST_F(VisionEmbeddingCacheTest, KeyDistinguishesModelsContentAndConfig) {
+    const size_t encoder_id = cache().get_encoder_id({});
+    const ov::Tensor image = make_image(1);
+    cache().insert(make_key(encoder_id, image, "448"), {make_embedding(1.0f, 4)});
+
+    EXPECT_FALSE(cache().find(make_key(cache().get_encoder_id({}), image, "448")).has_value());
+    EXPECT_FALSE(cache().find(make_key(encoder_id, make_image(2), "448")).has_value());
+    EXPECT_FALSE(cache().find(make_key(encoder_id, image, "336")).has_value());
+
+    // the same bytes in another layout is another image
+    ov::Tensor reshaped = make_image(1);
+    reshaped.set_shape({1, 2, 8, 3});
+    EXPECT_FALSE(cache().find(make_key(encoder_id, reshaped, "448")).has_value());
+
+    EXPECT_TRUE(cache().find(make_key(encoder_id, image, "448")).has_value());
+}
+
+TEST_F(VisionEmbeddingCacheTest, HashesImagesWithSha256) {
+    ov::Tensor abc(ov::element::u8, {1, 1, 1, 3});
+    std::copy_n("abc", 3, abc.data<char>());
+    EXPECT_EQ(VisionEmbeddingCache::hash_image(abc), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    // more than one 64 byte block
+    ov::Tensor image(ov::element::u8, {1, 10, 10, 3});
+    std::fill_n(image.data<uint8_t>(), image.get_size(), 'a');
+    EXPECT_EQ(VisionEmbeddingCache::hash_image(image), "9835fa6bf4e20a9b9ea812506302e98982721a6cf8d2cae67af57129bf21ae90");
+}
+
+TEST_F(VisionEmbeddingCacheTest, EncoderIdsAreSharedBySameModels) {
+    const size_t id = cache().get_encoder_id("/models/minicpm|CPU");
+    EXPECT_EQ(cache().get_encoder_id("/models/minicpm|CPU"), id);
+    EXPECT_NE(cache().get_encoder_id("/models/minicpm|GPU"), id);
+    EXPECT_NE(cache().get_encoder_id({}), cache().get_encoder_id({}));
+}
+
+TEST_F(VisionEmbeddingCacheTest, EvictsLeastRecentlyUsedOverBudget) {
+    const size_t encoder_id = cache().get_encoder_id({});
+    const size_t entry_bytes = 16 * sizeof(float);
+    cache().set_capacity(2 * entry_bytes);
+
+    cache().insert(make_key(encoder_id, make_image(1)), {make_embedding(1.0f, 16)});
+    cache().insert(make_key(encoder_id, make_image(2)), {make_embedding(2.0f, 16)});
+    // touch the first one, so the second one is the least recently used
+    ASSERT_TRUE(cache().find(make_key(encoder_id, make_image(1))).has_value());
+    cache().insert(make_key(encoder_id, make_image(3)), {make_embedding(3.0f, 16)});
+
+    EXPECT_TRUE(cache().find(make_key(encoder_id, make_image(1))).has_value());
+    EXPECT_FALSE(cache().find(make_key(encoder_id, make_image(2))).has_value());
+    EXPECT_TRUE(cache().find(make_key(encoder_id, make_image(3))).has_value());
+
+    const auto statistics = cache().get_statistics();
+    EXPECT_EQ(statistics.evictions - m_statistics.evictions, 1);
+    EXPECT_LE(statistics.size_bytes, statistics.capacity_bytes);
+
+    // entries larger than the whole budget are not stored, zero capacity disables the cache
+    cache().insert(make_key(encoder_id, make_image(4)), {make_embedding(4.0f, 64)});
+    EXPECT_FALSE(cache().find(make_key(encoder_id, make_image(4))).has_value());
+
+    cache().set_capacity(0);
+    EXPECT_EQ(cache().get_statistics().num_entries, 0);
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "whisper/whisper_feature_extractor.hpp"
+
+using ov::genai::WhisperFeatureExtractor;
+using ov::genai::WhisperStreamingFeatures;
+
+namespace {
+
+std::vector<float> random_audio(size_t n) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-0.5f, 0.5f);
+    std::vector<float> audio(n);
+    for (auto& value : audio) {
+        value = distribution(generator);
+    }
+    return audio;
+}
+
+std::vector<float> extract_streaming(WhisperFeatureExtractor& feature_extractor,
+                                     const std::vector<float>& audio,
+                                     const std::vector<size_t>& chunk_sizes) {
+    WhisperStreamingFeatures state;
+    size_t begin = 0;
+    for (size_t i = 0; begin < audio.size(); i++) {
+        const size_t end = std::min(begin + chunk_sizes[i % chunk_sizes.size()], audio.size());
+        feature_extractor.extract_incremental(state, {audio.begin() + begin, audio.begin() + end});
+        begin = end;
+    }
+    feature_extractor.extract_incremental(state, {}, true);
+    return feature_extractor.get_streaming_window(state, 0);
+}
+
+}  // namespace
+
+// preprocessor config doesn't exist, so default Whisper parameters are used
+TEST(WhisperFeatureExtractorTest, IncrementalMatchesOffline) {
+    WhisperFeatureExtractor feature_extractor("");
+    // 1.3 seconds, not a multiple of hop_length
+    const std::vector<float> audio = random_audio(20837);
+    const std::vector<float> offline = feature_extractor.extract(audio).data;
+    ASSERT_EQ(offline.size(), feature_extractor.feature_size * feature_extractor.nb_max_frames);
+
+    // chunks shorter than the reflect padding, than a hop and than a frame, and the whole audio at once
+    for (const std::vector<size_t>& chunk_sizes : std::vector<std::vector<size_t>>{{50, 137}, {160}, {399, 1601, 7}, {audio.size()}}) {
+        const std::vector<float> streaming = extract_streaming(feature_extractor, audio, chunk_sizes);
+        ASSERT_EQ(streaming.size(), offline.size());
+        for (size_t i = 0; i < offline.size(); i++) {
+            ASSERT_NEAR(streaming[i], offline[i], 1e-4f) << "feature " << i / feature_extractor.nb_max_frames
+                                                         << ", frame " << i % feature_extractor.nb_max_frames;
+        }
+    }
+}
@@ -349,6 +349,41 @@ def test_chat_compare_with_HF(model_descr, generation_config_kwargs: Dict):
     assert chat_history_ov == chat_history_hf
 
 
+@pytest.mark.parametrize("model_descr", get_chat_models_list())
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_chat_snapshot_restores_chat(model_descr, tmp_path):
+    model_id, path, tokenizer, opt_model, ov_pipe = read_model((model_descr[0], model_descr[1] / '_test_chat'))
+    generation_config = GenerationConfig(max_new_tokens=20)
+
+    def continue_chat():
+        return [ov_pipe.generate(prompt, generation_config=generation_config) for prompt in questions[2:]]
+
+    # a prefix snapshot holds the processed system message
+    ov_pipe.start_chat('You are a helpful assistant.')
+    prefix_snapshot = ov_pipe.get_chat_snapshot()
+    assert prefix_snapshot.get_kv_cache_length() > 0
+    for prompt in questions[:2]:
+        ov_pipe.generate(prompt, generation_config=generation_config)
+    snapshot = ov_pipe.get_chat_snapshot()
+    reference_answers = continue_chat()
+    ov_pipe.finish_chat()
+
+    snapshot.save(tmp_path / 'chat.bin')
+    loaded_snapshot = ov_genai.ChatSnapshot.load(tmp_path / 'chat.bin')
+    assert loaded_snapshot.get_history() == snapshot.get_history()
+    for restored_snapshot in [snapshot, loaded_snapshot]:
+        ov_pipe.restore_chat(restored_snapshot)
+        assert continue_chat() == reference_answers
+    ov_pipe.finish_chat()
+
+    ov_pipe.start_chat('You are a helpful assistant.')
+    reference_answers = [ov_pipe.generate(prompt, generation_config=generation_config) for prompt in questions]
+    ov_pipe.restore_chat(prefix_snapshot)
+    assert [ov_pipe.generate(prompt, generation_config=generation_config) for prompt in questions] == reference_answers
+    ov_pipe.finish_chat()
+
+
 #
 # Streaming with callback
 #
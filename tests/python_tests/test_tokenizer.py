@@ -118,6 +118,37 @@ def test_encode(model_descr, prompt):
         assert np.all(encoded_hf == encoded_ov[0])
 
 
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_encode_large_batch():
+    model_id, path, hf_tokenizer, opt_model, ov_pipe = read_model(get_models_list()[0])
+    ov_tokenizer = ov_pipe.get_tokenizer()
+
+    # large enough to be split across several infer requests
+    batch = [f'{prompts[i % 4]} {i}' * (i % 7 + 1) for i in range(200)]
+    expected = [hf_tokenizer.encode(prompt) for prompt in batch]
+
+    def check_left_padded(encoded, first_prompt):
+        input_ids, attention_mask = encoded.input_ids.data, encoded.attention_mask.data
+        for row in range(input_ids.shape[0]):
+            num_tokens = len(expected[first_prompt + row])
+            assert np.all(attention_mask[row, :-num_tokens] == 0) and np.all(attention_mask[row, -num_tokens:] == 1)
+            assert np.all(input_ids[row, -num_tokens:] == expected[first_prompt + row])
+
+    check_left_padded(ov_tokenizer.encode(batch), 0)
+
+    first_prompts = []
+    def callback(first_prompt, encoded):
+        check_left_padded(encoded, first_prompt)
+        first_prompts.append(first_prompt)
+    ov_tokenizer.encode_batches(batch, 32, callback)
+    assert first_prompts == list(range(0, len(batch), 32))
+
+    first_prompts = []
+    ov_tokenizer.encode_batches(batch, 32, lambda first_prompt, encoded: first_prompts.append(first_prompt) or True)
+    assert first_prompts == [0]
+
+
 encoded_prompts = [
     [1, 1591, 338, 1754, 310],
     [1, 17102,   323,  3864,   471,   263],
@@ -148,6 +179,27 @@ def test_decode(model_descr, encoded_prompt):
         assert decoded_hf == decoded_ov
 
 
+@pytest.mark.parametrize("model_descr", get_models_list())
+@pytest.mark.parametrize("skip_special_tokens", [True, False])
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_decode_single_sequence_matches_model(model_descr, skip_special_tokens):
+    model_id, path, hf_tokenizer, opt_model, ov_pipe = read_model(model_descr)
+    ov_tokenizer = ov_pipe.get_tokenizer()
+
+    # decode of a single sequence can be done without the detokenizer model, batched decode always infers the model
+    rng = np.random.default_rng(42)
+    special_tokens = list(hf_tokenizer.all_special_ids)
+    random_sequences = [[int(token) for token in rng.integers(0, hf_tokenizer.vocab_size, length)] for length in [1, 2, 3, 5, 8, 13, 64]]
+    sequences = random_sequences + [[token] for token in special_tokens] + [special_tokens + random_sequences[-1]]
+    # streamers decode growing prefixes, which may end with incomplete UTF-8 characters
+    sequences += [random_sequences[-1][:length] for length in range(1, len(random_sequences[-1]))]
+
+    for tokens in sequences:
+        decoded_batch = ov_tokenizer.decode([tokens], skip_special_tokens=skip_special_tokens)[0]
+        assert ov_tokenizer.decode(tokens, skip_special_tokens=skip_special_tokens) == decoded_batch
+
+
 conversation = [
     {'role': 'user', 'content': '1+1='},
     {'role': 'assistant', 'content': '1 + 1 = 2'},
@@ -205,6 +257,34 @@ def test_set_chat_template():
     assert prompt == templated_prompt
 
 
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_apply_chat_template_alternating_templates():
+    model_descr = get_chat_models_list()[0]
+    model_id, path, hf_tokenizer, opt_model, ov_pipe = read_model((model_descr[0], model_descr[1] / '_test_chat'))
+    ov_tokenizer = ov_pipe.get_tokenizer()
+
+    conversation = [
+        {'role': 'user', 'content': 'how are you?'},
+        {'role': 'assistant', 'content': 'fine'},
+    ]
+    # parsed templates are cached per template string, so each call must still use its own template
+    templates = {
+        "{% for message in messages %}{{ message['content'] }}{% endfor %}": 'how are you?fine',
+        "{% for message in messages %}{{ message['role'] }}{% endfor %}": 'userassistant',
+        "{% for message in messages %}[{{ message['content'] }}]{% endfor %}": '[how are you?][fine]',
+    }
+    default_templated = ov_tokenizer.apply_chat_template(conversation, add_generation_prompt=False)
+    for _ in range(3):
+        for chat_template, expected in templates.items():
+            assert ov_tokenizer.apply_chat_template(conversation, add_generation_prompt=False, chat_template=chat_template) == expected
+        assert ov_tokenizer.apply_chat_template(conversation, add_generation_prompt=False) == default_templated
+
+    chat_template, expected = next(iter(templates.items()))
+    ov_tokenizer.set_chat_template(chat_template)
+    assert ov_tokenizer.apply_chat_template(conversation, add_generation_prompt=False) == expected
+
+
 prompts = [
     '1+1=',
     'What is the previous answer?',
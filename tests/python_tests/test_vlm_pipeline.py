@@ -121,3 +121,57 @@ def test_perf_metrics(cache):
     mean_dur, std_dur = perf_metrics.get_prepare_embeddings_duration()
     assert np.allclose(mean_dur, np.mean(raw_dur))
     assert np.allclose(std_dur, np.std(raw_dur))
+
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_vision_embedding_cache(cache):
+    from openvino_genai import VisionEmbeddingCache
+    models_path = get_ov_model(cache)
+    image = get_image_by_link(image_links[0])
+
+    embedding_cache = VisionEmbeddingCache.instance()
+    embedding_cache.clear()
+
+    pipe = VLMPipeline(models_path, "CPU")
+    first = pipe.generate(prompts[0], image=image, generation_config=get_greedy())
+    assert first.perf_metrics.vlm_raw_metrics.vision_embedding_cache_misses == 1
+    assert first.perf_metrics.vlm_raw_metrics.vision_embedding_cache_hits == 0
+    assert first.perf_metrics.vlm_raw_metrics.vision_embedding_cache_size_bytes > 0
+
+    # another pipeline for the same models reuses embeddings and produces the same answer
+    other_pipe = VLMPipeline(models_path, "CPU")
+    second = other_pipe.generate(prompts[0], image=image, generation_config=get_greedy())
+    assert second.perf_metrics.vlm_raw_metrics.vision_embedding_cache_hits == 1
+    assert second.perf_metrics.vlm_raw_metrics.vision_embedding_cache_misses == 0
+    assert first.texts == second.texts
+
+    capacity = embedding_cache.get_capacity()
+    embedding_cache.set_capacity(0)
+    third = pipe.generate(prompts[0], image=image, generation_config=get_greedy())
+    assert third.perf_metrics.vlm_raw_metrics.vision_embedding_cache_misses == 1
+    assert first.texts == third.texts
+    embedding_cache.set_capacity(capacity)
+
+
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_continuous_batching_vlm(cache):
+    from openvino_genai import ContinuousBatchingPipeline
+    from common import get_scheduler_config
+    models_path = get_ov_model(cache)
+
+    vlm_pipe = VLMPipeline(models_path, "CPU")
+    scheduler_config = get_scheduler_config({"enable_prefix_caching": True, "cache_size": 1})
+    cb_pipe = ContinuousBatchingPipeline(models_path, scheduler_config, "CPU")
+
+    for links in image_links_for_testing:
+        images = [get_image_by_link(link) for link in links]
+        reference = vlm_pipe.generate(prompts[0], images=images, generation_config=get_greedy())
+
+        results = cb_pipe.generate([prompts[0], prompts[1]], [images, images], [get_greedy(), get_greedy()])
+        assert results[0].m_generation_ids[0] == reference.texts[0]
+
+        # the same images and prompt reuse KV cache blocks of the previous request, which must not change the answer
+        results = cb_pipe.generate([prompts[0]], [images], [get_greedy()])
+        assert results[0].m_generation_ids[0] == reference.texts[0]
@@ -662,3 +662,113 @@ def test_perf_metrics(model_descr, test_sample):
     mean_dur, std_dur = perf_metrics.get_features_extraction_duration()
     assert np.allclose(mean_dur, np.mean(raw_dur))
     assert np.allclose(std_dur, np.std(raw_dur))
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("return_timestamps", [False, True])
+@pytest.mark.precommit
+def test_batched_generate(model_descr, return_timestamps):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    samples = [
+        *get_samples_from_dataset(language="en", length=3),
+        *get_samples_from_dataset(language="en", length=1, long_form=True),
+    ]
+
+    batched_results = pipe.generate(samples, return_timestamps=return_timestamps)
+
+    assert len(batched_results) == len(samples)
+
+    for sample, batched_result in zip(samples, batched_results):
+        expected = pipe.generate(sample, return_timestamps=return_timestamps)
+
+        assert batched_result.texts[0] == expected.texts[0]
+
+        if not return_timestamps:
+            assert batched_result.chunks == None
+            continue
+
+        assert len(batched_result.chunks) == len(expected.chunks)
+        for batched_chunk, expected_chunk in zip(batched_result.chunks, expected.chunks):
+            assert batched_chunk.text == expected_chunk.text
+            assert batched_chunk.start_ts == expected_chunk.start_ts
+            assert batched_chunk.end_ts == expected_chunk.end_ts
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("return_timestamps", [False, True])
+@pytest.mark.precommit
+def test_streaming_transcription(model_descr, return_timestamps):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    sample = get_samples_from_dataset(language="en", length=1, long_form=True)[0]
+
+    streamed_text = []
+
+    def streamer(text):
+        streamed_text.append(text)
+        return False
+
+    pipe.start_stream(return_timestamps=return_timestamps, streamer=streamer)
+
+    # 0.25 seconds of 16k Hz audio per push
+    for start in range(0, len(sample), 4000):
+        pipe.push_audio(sample[start : start + 4000])
+
+    result = pipe.finish_stream()
+
+    assert result.texts[0]
+    assert "".join(streamed_text) == result.texts[0]
+
+    if not return_timestamps:
+        assert result.chunks == None
+        return
+
+    assert result.chunks
+    for prev_chunk, chunk in zip(result.chunks, result.chunks[1:]):
+        assert prev_chunk.start_ts <= chunk.start_ts
+    for chunk in result.chunks:
+        assert chunk.start_ts <= chunk.end_ts
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("test_sample", get_samples_from_dataset(language="en", length=1))
+@pytest.mark.precommit
+def test_beam_search(model_descr, test_sample):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    expected = opt_pipe(test_sample, generate_kwargs={"num_beams": 3})["text"]
+
+    genai_result = pipe.generate(test_sample, num_beams=3)
+
+    assert genai_result.texts[0] == expected
+
+    # single beam is greedy decoding
+    assert pipe.generate(test_sample, num_beams=1).texts[0] == pipe.generate(test_sample).texts[0]
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("test_sample", get_samples_from_dataset(language="en", length=1, long_form=True))
+@pytest.mark.precommit
+def test_temperature_fallback(model_descr, test_sample):
+    model_id, path, opt_pipe, pipe = read_whisper_model(model_descr)
+
+    config = pipe.get_generation_config()
+    config.num_beams = 2
+    config.temperatures = [0.0, 0.2, 0.4, 0.6, 0.8, 1.0]
+    config.compression_ratio_threshold = 1.35
+    config.logprob_threshold = -1.0
+    config.rng_seed = 42
+
+    result = pipe.generate(test_sample, config)
+    assert result.texts[0]
+
+    # sampled fallback candidates are reproducible with the same seed
+    assert pipe.generate(test_sample, config).texts[0] == result.texts[0]
+
+    # thresholds which are never exceeded keep the first temperature result
+    config.compression_ratio_threshold = None
+    config.logprob_threshold = None
+    greedy_config = pipe.get_generation_config()
+    greedy_config.num_beams = 2
+    assert pipe.generate(test_sample, config).texts[0] == pipe.generate(test_sample, greedy_config).texts[0]
@@ -0,0 +1,67 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace {
+
+const std::string CHATML_TEMPLATE =
+    "{% for message in messages %}"
+    "<|im_start|>{{ message['role'] }} {{ message['content'] }}<|im_end|>"
+    "{% endfor %}"
+    "{% if add_generation_prompt %}<|im_start|>assistant {% endif %}";
+
+ov::genai::ChatHistory make_history(size_t num_exchanges) {
+    ov::genai::ChatHistory history = {{{"role", "system"}, {"content", "You are a helpful assistant."}}};
+    for (size_t i = 0; i < num_exchanges; ++i) {
+        history.push_back({{"role", "user"}, {"content", "Question number " + std::to_string(i) + ": why is the sun yellow?"}});
+        history.push_back({{"role", "assistant"}, {"content", "Because of the way its light is scattered by the atmosphere."}});
+    }
+    return history;
+}
+
+} // namespace
+
+// Compares apply_chat_template() with a compiled template cached against parsing the template on each call
+int main(int argc, char* argv[]) try {
+    if (argc != 2) {
+        throw std::runtime_error(std::string{"Usage: "} + argv[0] + " <TOKENIZER_DIR>");
+    }
+    constexpr size_t num_iter = 200;
+    ov::genai::Tokenizer tokenizer(argv[1]);
+
+    for (size_t num_exchanges : {1, 16, 128}) {
+        const ov::genai::ChatHistory history = make_history(num_exchanges);
+        const std::string expected = tokenizer.apply_chat_template(history, true, CHATML_TEMPLATE);
+
+        // a unique comment makes each template string a cache miss, which parses the template like before caching
+        const auto start_parsed = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < num_iter; ++i) {
+            const std::string unique_template = CHATML_TEMPLATE + "{# " + std::to_string(i) + " #}";
+            OPENVINO_ASSERT(tokenizer.apply_chat_template(history, true, unique_template) == expected, "Template with a comment produced a different prompt");
+        }
+        const auto start_cached = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < num_iter; ++i) {
+            OPENVINO_ASSERT(tokenizer.apply_chat_template(history, true, CHATML_TEMPLATE) == expected, "Cached template produced a different prompt");
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        std::cout << "History of " << history.size() << " messages" << std::endl;
+        std::cout << "Parsed on each call: " << std::chrono::duration<double, std::micro>(start_cached - start_parsed).count() / num_iter << " us/call" << std::endl;
+        std::cout << "Cached: " << std::chrono::duration<double, std::micro>(end - start_cached).count() / num_iter << " us/call" << std::endl;
+    }
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "visual_language/clip.hpp"
+
+namespace {
+
+clip_image_u8 make_image(int width, int height) {
+    clip_image_u8 image{width, height, std::vector<uint8_t>(3 * width * height)};
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    for (uint8_t& value : image.buf) {
+        value = static_cast<uint8_t>(distribution(generator));
+    }
+    return image;
+}
+
+// per pixel bicubic interpolation, which was used before the separable implementation
+clip_image_u8 reference_bicubic_resize(const clip_image_u8& img, int target_width, int target_height) {
+    clip_image_u8 dst{target_width, target_height, std::vector<uint8_t>(3 * target_width * target_height)};
+    auto pixel = [&img](int y, int x, int c) -> float {
+        y = std::max(0, std::min(y, img.ny - 1));
+        x = std::max(0, std::min(x, img.nx - 1));
+        return img.buf[(y * img.nx + x) * 3 + c];
+    };
+    auto cubic = [](float p_1, float p0, float p1, float p2, float d) {
+        float d0 = p_1 - p0, d2 = p1 - p0, d3 = p2 - p0;
+        float a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
+        float a2 = 1.0 / 2 * d0 + 1.0 / 2 * d2;
+        float a3 = -1.0 / 6 * d0 - 1.0 / 2 * d2 + 1.0 / 6 * d3;
+        return p0 + a1 * d + a2 * d * d + a3 * d * d * d;
+    };
+
+    const float tx = (float)img.nx / target_width, ty = (float)img.ny / target_height;
+    for (int i = 0; i < target_height; i++) {
+        for (int j = 0; j < target_width; j++) {
+            int x = (int)(tx * j), y = (int)(ty * i);
+            float dx = tx * j - x, dy = ty * i - y;
+            for (int k = 0; k < 3; k++) {
+                float C[4];
+                for (int jj = 0; jj < 4; jj++) {
+                    int row = y - 1 + jj;
+                    C[jj] = cubic(pixel(row, x - 1, k), pixel(row, x, k), pixel(row, x + 1, k), pixel(row, x + 2, k), dx);
+                }
+                float Cc = cubic(C[0], C[1], C[2], C[3], dy);
+                dst.buf[(i * target_width + j) * 3 + k] = std::min(std::max(std::round(Cc), 0.0f), 255.0f);
+            }
+        }
+    }
+    return dst;
+}
+
+template <typename Callable>
+double measure_ms(Callable&& callable, size_t num_iter) {
+    // the first call isn't timed to exclude thread pool creation
+    callable();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_iter; ++i) {
+        callable();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / num_iter;
+}
+
+} // namespace
+
+// Prints timings of preprocessing a 4K photo
+int main(int argc, char* argv[]) try {
+    const size_t num_iter = argc > 1 ? std::stoul(argv[1]) : 5;
+    const clip_image_u8 image = make_image(3840, 2160);
+    clip_ctx ctx;
+
+    const double reference_ms = measure_ms([&] {
+        clip_image_u8 resized = reference_bicubic_resize(image, 448, 448);
+        clip_image_preprocess(ctx, resized);
+    }, num_iter);
+    const double separate_ms = measure_ms([&] {
+        clip_image_u8 resized;
+        bicubic_resize(image, resized, 448, 448);
+        clip_image_preprocess(ctx, resized);
+    }, num_iter);
+    const double fused_ms = measure_ms([&] {
+        bicubic_resize_normalize(ctx, image, 448, 448, 0, 0, 448, 448);
+    }, num_iter);
+    // MiniCPM like slicing: 2x3 grid of slices of a refined image
+    const double slices_ms = measure_ms([&] {
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 3; ++x) {
+                bicubic_resize_normalize(ctx, image, 1344, 896, x * 448, y * 448, 448, 448);
+            }
+        }
+    }, num_iter);
+
+    std::cout << "Per pixel bicubic resize + normalize: " << reference_ms << " ms" << std::endl;
+    std::cout << "Separable bicubic resize + normalize: " << separate_ms << " ms" << std::endl;
+    std::cout << "Fused resize and normalize: " << fused_ms << " ms" << std::endl;
+    std::cout << "Fused resize and normalize of 6 slices: " << slices_ms << " ms" << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
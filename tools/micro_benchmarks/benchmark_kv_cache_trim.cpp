@@ -0,0 +1,101 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/util/variable.hpp"
+
+#include "utils.hpp"
+
+namespace {
+
+// KV cache like states of [BATCH_SIZE, num_kv_heads, seq_len, head_size] layout
+ov::InferRequest make_stateful_request(size_t num_states, size_t num_heads, size_t head_size) {
+    ov::PartialShape shape{1, num_heads, ov::Dimension::dynamic(), head_size};
+
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    ov::ResultVector results;
+    ov::SinkVector sinks;
+    for (size_t i = 0; i < num_states; ++i) {
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "past_key_values." + std::to_string(i)});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+        auto present = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, input}, 2);
+        sinks.push_back(std::make_shared<ov::op::v6::Assign>(present, variable));
+        results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v3::ShapeOf>(present)));
+    }
+    auto model = std::make_shared<ov::Model>(results, sinks, ov::ParameterVector{input});
+    return ov::genai::utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+}
+
+void fill_states(ov::InferRequest& request, const ov::Shape& shape) {
+    for (auto& state : request.query_state()) {
+        ov::Tensor tensor(ov::element::f32, shape);
+        float* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            data[i] = static_cast<float>(i);
+        }
+        state.set_state(tensor);
+    }
+}
+
+// the implementation which copied ROI of each state into a new tensor
+void reference_trim_kv_cache(ov::InferRequest& request, uint64_t remove_from_end, size_t seq_length_axis) {
+    for (auto& state : request.query_state()) {
+        ov::Tensor old_tensor = state.get_state();
+        auto shape = old_tensor.get_shape();
+        shape[seq_length_axis] -= remove_from_end;
+        ov::Tensor trimmed_tensor(old_tensor, ov::Coordinate(shape.size(), 0), ov::Coordinate{shape});
+        ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
+        trimmed_tensor.copy_to(new_tensor);
+        state.set_state(new_tensor);
+    }
+}
+
+} // namespace
+
+// Prints timings of trimming KV cache of a long chat history
+int main(int argc, char* argv[]) try {
+    // keys and values of 4 layers of a 7B model with grouped query attention
+    const size_t num_states = 8, num_heads = 8, head_size = 128, remove_from_end = 64;
+    const size_t seq_len = argc > 1 ? std::stoul(argv[1]) : 32 * 1024;
+    constexpr size_t num_iter = 3;
+    ov::InferRequest request = make_stateful_request(num_states, num_heads, head_size);
+
+    auto measure = [&](auto&& trim) {
+        double total_ms = 0;
+        for (size_t i = 0; i < num_iter; ++i) {
+            fill_states(request, {1, num_heads, seq_len, head_size});
+            const auto start = std::chrono::steady_clock::now();
+            trim();
+            total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        return total_ms / num_iter;
+    };
+
+    const double reference_ms = measure([&] { reference_trim_kv_cache(request, remove_from_end, 2); });
+    const double trim_ms = measure([&] { ov::genai::utils::trim_kv_cache(request, remove_from_end, 2, std::nullopt); });
+
+    std::cout << "KV cache of " << seq_len << " tokens, " << num_states << " states of "
+              << num_heads * seq_len * head_size * sizeof(float) / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "Copy of ROI into new tensors: " << reference_ms << " ms" << std::endl;
+    std::cout << "Parallel copy into a reused buffer: " << trim_ms << " ms" << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
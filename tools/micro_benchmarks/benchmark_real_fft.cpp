@@ -0,0 +1,133 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "whisper/real_fft.hpp"
+
+using ov::genai::RealFFT;
+
+namespace {
+
+std::vector<float> random_signal(size_t n) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> signal(n);
+    for (auto& value : signal) {
+        value = distribution(generator);
+    }
+    return signal;
+}
+
+// Recursive implementation previously used by WhisperFeatureExtractor, kept as a baseline
+void recursive_fft(const std::vector<float>& in, std::vector<float>& out, const std::vector<float>& sin_vals,
+                   const std::vector<float>& cos_vals, const size_t n_fft) {
+    const int N = in.size();
+    out.resize(N * 2);
+
+    if (N == 1) {
+        out[0] = in[0];
+        out[1] = 0;
+        return;
+    }
+
+    if (N % 2 == 1) {
+        const int sin_cos_step = n_fft / N;
+        for (int k = 0; k < N; k++) {
+            float re = 0;
+            float im = 0;
+            for (int n = 0; n < N; n++) {
+                int idx = (k * n * sin_cos_step) % (n_fft);
+                re += in[n] * cos_vals[idx];
+                im -= in[n] * sin_vals[idx];
+            }
+            out[k * 2 + 0] = re;
+            out[k * 2 + 1] = im;
+        }
+        return;
+    }
+
+    std::vector<float> even, odd, even_fft, odd_fft;
+    for (int i = 0; i < N; i++) {
+        (i % 2 == 0 ? even : odd).push_back(in[i]);
+    }
+
+    recursive_fft(even, even_fft, sin_vals, cos_vals, n_fft);
+    recursive_fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
+
+    const int sin_cos_step = n_fft / N;
+    for (int k = 0; k < N / 2; k++) {
+        int idx = k * sin_cos_step;
+        float re = cos_vals[idx];
+        float im = -sin_vals[idx];
+
+        float re_odd = odd_fft[2 * k + 0];
+        float im_odd = odd_fft[2 * k + 1];
+
+        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
+        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
+
+        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
+        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+    }
+}
+
+}  // namespace
+
+// Compares RealFFT against the recursive implementation on a Whisper window
+int main(int argc, char* argv[]) try {
+    const size_t n_fft = argc > 1 ? std::stoul(argv[1]) : 400;
+    const size_t iterations = 20000;
+    const auto signal = random_signal(n_fft);
+
+    std::vector<float> sin_vals(n_fft), cos_vals(n_fft);
+    for (size_t i = 0; i < n_fft; i++) {
+        sin_vals[i] = sinf((2 * M_PI * i) / n_fft);
+        cos_vals[i] = cosf((2 * M_PI * i) / n_fft);
+    }
+
+    std::vector<float> recursive_out;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        recursive_fft(signal, recursive_out, sin_vals, cos_vals, n_fft);
+    }
+    const std::chrono::duration<double, std::micro> recursive_time = std::chrono::steady_clock::now() - start;
+
+    RealFFT fft(n_fft);
+    auto workspace = fft.create_workspace();
+    std::vector<RealFFT::Complex> spectrum(fft.bins());
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        fft.transform(signal.data(), spectrum.data(), workspace);
+    }
+    const std::chrono::duration<double, std::micro> real_fft_time = std::chrono::steady_clock::now() - start;
+
+    float max_diff = 0.0f;
+    for (size_t k = 0; k < fft.bins(); k++) {
+        max_diff = std::max({max_diff, std::abs(spectrum[k].real() - recursive_out[2 * k]), std::abs(spectrum[k].imag() - recursive_out[2 * k + 1])});
+    }
+
+    std::cout << "n_fft: " << n_fft << std::endl;
+    std::cout << "recursive fft: " << recursive_time.count() / iterations << " us/frame" << std::endl;
+    std::cout << "real fft: " << real_fft_time.count() / iterations << " us/frame" << std::endl;
+    std::cout << "max abs difference: " << max_diff << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace {
+
+std::vector<std::string> make_corpus(size_t num_documents) {
+    const std::vector<std::string> sentences = {
+        "The Sun is yellow because of the way its light is scattered by the atmosphere. ",
+        "Alan Turing was a mathematician, computer scientist and cryptanalyst. ",
+        "Table is made of wood, metal or plastic, depending on its purpose. ",
+    };
+    std::vector<std::string> corpus(num_documents);
+    for (size_t i = 0; i < num_documents; ++i) {
+        // documents of different lengths to exercise padding
+        for (size_t j = 0; j < 8 + i % 32; ++j) {
+            corpus[i] += sentences[(i + j) % sentences.size()];
+        }
+    }
+    return corpus;
+}
+
+template <typename Callable>
+double measure_ms(Callable&& callable) {
+    const auto start = std::chrono::steady_clock::now();
+    callable();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) try {
+    if (argc < 2 || argc > 3) {
+        throw std::runtime_error(std::string{"Usage: "} + argv[0] + " <TOKENIZER_DIR> [NUM_DOCUMENTS]");
+    }
+    const size_t num_documents = argc > 2 ? std::stoul(argv[2]) : 10000, batch_size = 16;
+    ov::genai::Tokenizer tokenizer(argv[1]);
+    const std::vector<std::string> corpus = make_corpus(num_documents);
+
+    // batches small enough to be tokenized by one infer request each
+    const double sequential_ms = measure_ms([&] {
+        for (size_t begin = 0; begin < corpus.size(); begin += batch_size) {
+            std::vector<std::string> batch(corpus.begin() + begin, corpus.begin() + std::min(begin + batch_size, corpus.size()));
+            tokenizer.encode(batch);
+        }
+    });
+    const double sharded_ms = measure_ms([&] {
+        std::vector<std::string> batch = corpus;
+        tokenizer.encode(batch);
+    });
+    size_t num_batches = 0;
+    const double streamed_ms = measure_ms([&] {
+        tokenizer.encode_batches(corpus, batch_size, [&](size_t, ov::genai::TokenizedInputs) {
+            ++num_batches;
+            return false;
+        });
+    });
+    OPENVINO_ASSERT(num_batches == (num_documents + batch_size - 1) / batch_size, "encode_batches produced ", num_batches, " batches");
+
+    std::cout << "Tokenization of " << num_documents << " documents" << std::endl;
+    std::cout << "Sequential batches of " << batch_size << ": " << num_documents * 1000.0 / sequential_ms << " documents/s" << std::endl;
+    std::cout << "Single batch split across infer requests: " << num_documents * 1000.0 / sharded_ms << " documents/s" << std::endl;
+    std::cout << "encode_batches with batches of " << batch_size << ": " << num_documents * 1000.0 / streamed_ms << " documents/s" << std::endl;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}